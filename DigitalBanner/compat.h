@@ -0,0 +1,450 @@
+/*Just enough of the Win32 API for the render core to build headless on
+* Linux (see CMakeLists.txt). Threads, events and slim reader/writer locks
+* map onto pthreads, the process heap onto malloc, sections onto mmap and
+* the Interlocked family onto the compiler's atomics. Handles are a small
+* tagged struct; only what digitalbanner.cpp actually calls is here.
+*/
+#ifndef NNB_COMPAT_H
+#define NNB_COMPAT_H
+
+#ifndef NNB_HEADLESS
+#error "compat.h is only for the headless build"
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+typedef int BOOL;
+typedef uint32_t DWORD;
+typedef int32_t LONG;
+typedef int64_t LONG64;
+typedef int64_t LONGLONG;
+typedef uint32_t ULONG;
+typedef uint64_t ULONGLONG;
+typedef unsigned short USHORT;
+typedef void* LPVOID;
+typedef void* HANDLE;
+typedef void* HMODULE;
+typedef const wchar_t* LPCWSTR;
+typedef DWORD (*LPTHREAD_START_ROUTINE)(LPVOID);
+
+#define WINAPI
+#define TRUE 1
+#define FALSE 0
+#define MAX_PATH 260
+#define INFINITE 0xFFFFFFFF
+#define WAIT_OBJECT_0 0
+#define WAIT_TIMEOUT 258
+#define INVALID_HANDLE_VALUE ((HANDLE)(intptr_t)-1)
+#define HEAP_ZERO_MEMORY 0x8
+#define GENERIC_READ 0x80000000
+#define GENERIC_WRITE 0x40000000
+#define FILE_SHARE_READ 0x1
+#define OPEN_EXISTING 3
+#define CREATE_ALWAYS 2
+#define FILE_ATTRIBUTE_NORMAL 0x80
+#define PAGE_READONLY 0x2
+#define PAGE_READWRITE 0x4
+#define FILE_MAP_READ 0x4
+#define FILE_MAP_ALL_ACCESS 0xF001F
+
+typedef union largeInteger {
+    LONGLONG QuadPart;
+} LARGE_INTEGER;
+
+typedef struct systemInfo {
+    DWORD dwNumberOfProcessors;
+} SYSTEM_INFO;
+
+typedef struct fileTime {
+    DWORD dwLowDateTime;
+    DWORD dwHighDateTime;
+} FILETIME;
+
+typedef struct fileAttributeData {
+    FILETIME ftLastWriteTime;
+    DWORD nFileSizeHigh;
+    DWORD nFileSizeLow;
+} WIN32_FILE_ATTRIBUTE_DATA;
+
+enum { GetFileExInfoStandard };
+
+#define C_THREAD 1
+#define C_EVENT 2
+#define C_FILE 3
+#define C_MAPPING 4
+
+typedef struct compatHandle {
+    int kind;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int signaled;
+    int fd;
+    size_t size;
+    int writable;
+} CHANDLE;
+
+typedef struct compatStart {
+    LPTHREAD_START_ROUTINE start;
+    LPVOID param;
+} CSTART;
+
+//munmap wants the length back, so views remember theirs
+typedef struct compatView {
+    void* base;
+    size_t size;
+    struct compatView* next;
+} CVIEW;
+
+static CVIEW* compatViews = NULL;
+static pthread_mutex_t compatViewLock = PTHREAD_MUTEX_INITIALIZER;
+
+//Memory
+
+static inline HANDLE GetProcessHeap() {
+    return NULL;
+}
+
+static inline void* HeapAlloc(HANDLE heap, DWORD flags, size_t bytes) {
+    return flags & HEAP_ZERO_MEMORY ? calloc(1, bytes) : malloc(bytes);
+}
+
+static inline void* HeapReAlloc(HANDLE heap, DWORD flags, void* block, size_t bytes) {
+    return realloc(block, bytes);
+}
+
+static inline BOOL HeapFree(HANDLE heap, DWORD flags, void* block) {
+    free(block);
+    return TRUE;
+}
+
+#define RtlZeroMemory(p, n) memset((p), 0, (n))
+
+//Atomics. LONG is 32 bits as on Windows; every call is a full barrier
+
+static inline LONG InterlockedExchange(volatile LONG* target, LONG value) {
+    return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG InterlockedIncrement(volatile LONG* target) {
+    return __atomic_add_fetch(target, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG InterlockedDecrement(volatile LONG* target) {
+    return __atomic_sub_fetch(target, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG InterlockedExchangeAdd(volatile LONG* target, LONG value) {
+    return __atomic_fetch_add(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG InterlockedCompareExchange(volatile LONG* target, LONG exchange, LONG comparand) {
+    __atomic_compare_exchange_n(target, &comparand, exchange, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return comparand;
+}
+
+static inline LONG64 InterlockedExchange64(volatile LONG64* target, LONG64 value) {
+    return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG64 InterlockedIncrement64(volatile LONG64* target) {
+    return __atomic_add_fetch(target, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG64 InterlockedExchangeAdd64(volatile LONG64* target, LONG64 value) {
+    return __atomic_fetch_add(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG64 InterlockedCompareExchange64(volatile LONG64* target, LONG64 exchange, LONG64 comparand) {
+    __atomic_compare_exchange_n(target, &comparand, exchange, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return comparand;
+}
+
+#define MemoryBarrier() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define YieldProcessor() sched_yield()
+
+//Locks
+
+typedef pthread_rwlock_t SRWLOCK;
+#define SRWLOCK_INIT PTHREAD_RWLOCK_INITIALIZER
+
+static inline void AcquireSRWLockExclusive(SRWLOCK* lock) { pthread_rwlock_wrlock(lock); }
+static inline void ReleaseSRWLockExclusive(SRWLOCK* lock) { pthread_rwlock_unlock(lock); }
+static inline void AcquireSRWLockShared(SRWLOCK* lock) { pthread_rwlock_rdlock(lock); }
+static inline void ReleaseSRWLockShared(SRWLOCK* lock) { pthread_rwlock_unlock(lock); }
+
+//Threads and auto-reset events
+
+static inline CHANDLE* compatHandle(int kind) {
+    CHANDLE* h = (CHANDLE*)calloc(1, sizeof(CHANDLE));
+    h->kind = kind;
+    h->fd = -1;
+    return h;
+}
+
+static inline void* compatThread(void* param) {
+    CSTART start = *(CSTART*)param;
+    free(param);
+    return (void*)(uintptr_t)start.start(start.param);
+}
+
+static inline HANDLE CreateThread(void* attributes, size_t stack, LPTHREAD_START_ROUTINE start, LPVOID param, DWORD flags, DWORD* id) {
+    CHANDLE* h = compatHandle(C_THREAD);
+    CSTART* s = (CSTART*)malloc(sizeof(CSTART));
+    s->start = start;
+    s->param = param;
+    if (pthread_create(&h->thread, NULL, compatThread, s) != 0) {
+        free(s);
+        free(h);
+        return NULL;
+    }
+    if (id != NULL) *id = 0;
+    return h;
+}
+
+static inline HANDLE CreateEventA(void* attributes, BOOL manual, BOOL initial, const char* name) {
+    CHANDLE* h = compatHandle(C_EVENT);
+    pthread_mutex_init(&h->lock, NULL);
+    pthread_cond_init(&h->cond, NULL);
+    h->signaled = initial;
+    return h;
+}
+
+static inline BOOL SetEvent(HANDLE handle) {
+    CHANDLE* h = (CHANDLE*)handle;
+    pthread_mutex_lock(&h->lock);
+    h->signaled = 1;
+    pthread_cond_signal(&h->cond);
+    pthread_mutex_unlock(&h->lock);
+    return TRUE;
+}
+
+static inline DWORD WaitForSingleObject(HANDLE handle, DWORD ms) {
+    CHANDLE* h = (CHANDLE*)handle;
+    if (h->kind == C_THREAD) {
+        //Only ever used to join
+        pthread_join(h->thread, NULL);
+        h->kind = 0;
+        return WAIT_OBJECT_0;
+    }
+    struct timespec until;
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_sec += ms / 1000;
+    until.tv_nsec += (long)(ms % 1000) * 1000000;
+    if (until.tv_nsec >= 1000000000) {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000;
+    }
+    pthread_mutex_lock(&h->lock);
+    int result = 0;
+    while (!h->signaled && result == 0) {
+        if (ms == INFINITE) result = pthread_cond_wait(&h->cond, &h->lock);
+        else result = pthread_cond_timedwait(&h->cond, &h->lock, &until);
+    }
+    DWORD status = h->signaled ? WAIT_OBJECT_0 : WAIT_TIMEOUT;
+    h->signaled = 0;
+    pthread_mutex_unlock(&h->lock);
+    return status;
+}
+
+//Only the wait-for-all form, over auto-reset events or threads
+static inline DWORD WaitForMultipleObjects(DWORD count, const HANDLE* handles, BOOL all, DWORD ms) {
+    for (DWORD i = 0; i < count; i++) WaitForSingleObject(handles[i], ms);
+    return WAIT_OBJECT_0;
+}
+
+static inline BOOL CloseHandle(HANDLE handle) {
+    CHANDLE* h = (CHANDLE*)handle;
+    if (h == NULL || handle == INVALID_HANDLE_VALUE) return FALSE;
+    if (h->kind == C_THREAD) pthread_detach(h->thread);
+    if (h->kind == C_EVENT) {
+        pthread_mutex_destroy(&h->lock);
+        pthread_cond_destroy(&h->cond);
+    }
+    if (h->kind == C_FILE && h->fd >= 0) close(h->fd);
+    free(h);
+    return TRUE;
+}
+
+#define THREAD_PRIORITY_BELOW_NORMAL -1
+#define THREAD_PRIORITY_NORMAL 0
+#define THREAD_PRIORITY_HIGHEST 2
+
+static inline HANDLE GetCurrentThread() {
+    return (HANDLE)(intptr_t)-2;
+}
+
+//Only for the calling thread, as a nice value; raising it needs privileges Linux usually won't give
+static inline BOOL SetThreadPriority(HANDLE thread, int priority) {
+    if (thread != GetCurrentThread()) return FALSE;
+    return setpriority(PRIO_PROCESS, (id_t)gettid(), -priority * 5) == 0;
+}
+
+static inline void Sleep(DWORD ms) {
+    usleep((useconds_t)ms * 1000);
+}
+
+static inline void ExitProcess(int code) {
+    exit(code);
+}
+
+static inline void GetSystemInfo(SYSTEM_INFO* info) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    info->dwNumberOfProcessors = count > 0 ? (DWORD)count : 1;
+}
+
+//Clocks
+
+static inline DWORD GetTickCount() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (DWORD)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+static inline BOOL QueryPerformanceCounter(LARGE_INTEGER* count) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    count->QuadPart = (LONGLONG)now.tv_sec * 1000000000 + now.tv_nsec;
+    return TRUE;
+}
+
+static inline BOOL QueryPerformanceFrequency(LARGE_INTEGER* frequency) {
+    frequency->QuadPart = 1000000000;
+    return TRUE;
+}
+
+//Files and sections
+
+static inline HANDLE CreateFileA(const char* path, DWORD access, DWORD share, void* security, DWORD disposition, DWORD attributes, HANDLE templateFile) {
+    int flags = (access & GENERIC_WRITE) ? ((access & GENERIC_READ) ? O_RDWR : O_WRONLY) : O_RDONLY;
+    if (disposition == CREATE_ALWAYS) flags |= O_CREAT | O_TRUNC;
+    int fd = open(path, flags, 0644);
+    if (fd < 0) return INVALID_HANDLE_VALUE;
+    CHANDLE* h = compatHandle(C_FILE);
+    h->fd = fd;
+    h->writable = (access & GENERIC_WRITE) != 0;
+    return h;
+}
+
+static inline BOOL GetFileSizeEx(HANDLE file, LARGE_INTEGER* size) {
+    struct stat st;
+    if (fstat(((CHANDLE*)file)->fd, &st) != 0) return FALSE;
+    size->QuadPart = (LONGLONG)st.st_size;
+    return TRUE;
+}
+
+//INVALID_HANDLE_VALUE asks for anonymous memory, as with the pagefile on Windows
+static inline HANDLE CreateFileMappingA(HANDLE file, void* security, DWORD protect, DWORD sizeHigh, DWORD sizeLow, const char* name) {
+    CHANDLE* h = compatHandle(C_MAPPING);
+    h->size = ((size_t)sizeHigh << 32) | sizeLow;
+    h->writable = protect == PAGE_READWRITE;
+    if (file != INVALID_HANDLE_VALUE) {
+        h->fd = ((CHANDLE*)file)->fd;
+        struct stat st;
+        if (h->size == 0 && fstat(h->fd, &st) == 0) h->size = (size_t)st.st_size;
+    }
+    if (h->size == 0) {
+        free(h);
+        return NULL;
+    }
+    return h;
+}
+
+static inline void* MapViewOfFile(HANDLE mapping, DWORD access, DWORD offsetHigh, DWORD offsetLow, size_t bytes) {
+    CHANDLE* h = (CHANDLE*)mapping;
+    size_t size = bytes > 0 ? bytes : h->size;
+    int prot = PROT_READ | (h->writable ? PROT_WRITE : 0);
+    void* base = h->fd >= 0 ? mmap(NULL, size, prot, MAP_SHARED, h->fd, 0) : mmap(NULL, size, prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) return NULL;
+    CVIEW* view = (CVIEW*)malloc(sizeof(CVIEW));
+    view->base = base;
+    view->size = size;
+    pthread_mutex_lock(&compatViewLock);
+    view->next = compatViews;
+    compatViews = view;
+    pthread_mutex_unlock(&compatViewLock);
+    return base;
+}
+
+static inline BOOL UnmapViewOfFile(const void* base) {
+    pthread_mutex_lock(&compatViewLock);
+    CVIEW** link = &compatViews;
+    while (*link != NULL && (*link)->base != base) link = &(*link)->next;
+    CVIEW* view = *link;
+    if (view != NULL) *link = view->next;
+    pthread_mutex_unlock(&compatViewLock);
+    if (view == NULL) return FALSE;
+    munmap(view->base, view->size);
+    free(view);
+    return TRUE;
+}
+
+static inline BOOL GetFileAttributesExA(const char* path, int level, WIN32_FILE_ATTRIBUTE_DATA* info) {
+    struct stat st;
+    if (stat(path, &st) != 0) return FALSE;
+    ULONGLONG stamp = (ULONGLONG)st.st_mtim.tv_sec * 10000000 + st.st_mtim.tv_nsec / 100;
+    info->ftLastWriteTime.dwLowDateTime = (DWORD)stamp;
+    info->ftLastWriteTime.dwHighDateTime = (DWORD)(stamp >> 32);
+    info->nFileSizeHigh = (DWORD)((ULONGLONG)st.st_size >> 32);
+    info->nFileSizeLow = (DWORD)st.st_size;
+    return TRUE;
+}
+
+static inline LONG CompareFileTime(const FILETIME* a, const FILETIME* b) {
+    ULONGLONG x = ((ULONGLONG)a->dwHighDateTime << 32) | a->dwLowDateTime;
+    ULONGLONG y = ((ULONGLONG)b->dwHighDateTime << 32) | b->dwLowDateTime;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static inline BOOL CreateDirectoryA(const char* path, void* security) {
+    return mkdir(path, 0755) == 0;
+}
+
+//CRT
+
+static inline int compatPrint(char* buffer, size_t size, const char* format, va_list args) {
+    int length = vsnprintf(buffer, size, format, args);
+    //Like the secure CRT, never report more than was written, so appends stay in bounds
+    if (length < 0) return -1;
+    return (size_t)length >= size ? (int)size - 1 : length;
+}
+
+static inline int sprintf_s(char* buffer, size_t size, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int length = compatPrint(buffer, size, format, args);
+    va_end(args);
+    return length;
+}
+
+template <size_t N>
+static inline int sprintf_s(char (&buffer)[N], const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int length = compatPrint(buffer, N, format, args);
+    va_end(args);
+    return length;
+}
+
+static inline int localtime_s(struct tm* out, const time_t* t) {
+    return localtime_r(t, out) == NULL ? EINVAL : 0;
+}
+
+#define _stricmp strcasecmp
+#define _strnicmp strncasecmp
+
+#endif
@@ -38,6 +38,8 @@ SOFTWARE.
 #define F_AUTOSTART 0x02
 #define F_BASELIGHT 0x04
 #define F_METAPOSTS 0x08
+#define F_PREVIEW 0x10
+#define F_HUD 0x20
 
 #define C_BLACK 0
 #define C_RED 1
@@ -59,6 +61,266 @@ SOFTWARE.
 #define T_STOPPING 3
 #define T_STOPPED 4
 
+#define PREVIEW_SCALE 3
+#define PREVIEW_SLOTS 3
+#define PREVIEW_FRESH 0x4
+
+#define SLIDE_DIR "./http/slides"
+#define SLIDE_MAX 32
+
+#define CLIP_RING 4
+#define CLIP_FPS 30
+#define CLIP_HEADER 32
+#define CLIP_SIDE 16384
+#define CLIP_GIF 1
+#define CLIP_RAW 2
+#define CLIP_SEQUENCE 3
+
+#define S_FREE 0
+#define S_READY 1
+#define S_UPLOADING 2
+
+#define R_OPENGL 0
+#define R_VULKAN 1
+#define R_SOFTWARE 2
+
+#define PASS_LIGHT 0
+#define PASS_BLOOM 1
+#define PASS_ASSEMBLY 2
+#define PASS_DOTS 3
+#define PASS_SLIDES 4
+#define PASS_OVERLAY 5
+#define PASS_TEXT 6
+#define PASS_WALL 7
+#define PASS_PLUGINS 8
+#define PASS_COUNT 9
+#define BLOOM_PASSES 6
+
+#define TIMER_FRAMES 3
+#define TIMER_MARKS 24
+#define TIMER_START -1
+#define TIMER_BRIGHT PASS_COUNT
+#define TIMER_BLUR (PASS_COUNT + 1)
+#define TIMER_SECTIONS (PASS_COUNT + 1 + BLOOM_PASSES)
+#define TIMER_HISTORY 240
+
+#define VK_FRAMES 2
+#define VK_WORKERS 3
+#define VK_JOB_LIGHT 0
+#define VK_JOB_BLOOM 1
+#define VK_JOB_COMPOSITE 2
+#define VK_TEXT_CHARS 512
+
+#define GLYPH_ATLAS 1024
+
+#define SW_TILE 16
+#define SW_MAX_WORKERS 16
+#define SW_LIGHT 0
+#define SW_BLUR_H 1
+#define SW_BLUR_V 2
+#define SW_ASSEMBLY 3
+#define SW_SLIDESHOW 4
+#define SW_BAKE 5
+
+#define EXPORT_PNG 1
+#define EXPORT_RAW 2
+#define EXPORT_SLOTS 8
+
+#define SHM_NAME "Local\\NNBFrames"
+#define SHM_VERSION 1
+#define SHM_SLOTS 3
+#define SHM_PBOS 3
+#define SHM_BGRA8 1
+#define SHM_BOTTOM_UP 0x100
+
+#define UDP_BATCH 64
+#define UDP_PACKET 1472
+#define PACER_SPIN 500
+
+#define LED_MAP "./ledmap.json"
+#define LED_PORT 4048
+#define LED_MAX 16384
+#define LED_ROW 256
+#define LED_RATE 60
+#define LED_SIZE 0.01f
+#define LED_SCALE 4
+#define LED_PBOS 3
+#define LED_SLOTS 3
+#define LED_FRESH 0x4
+#define LED_PER_PACKET 480
+
+#define DMX_PATCH "./fixtures.json"
+#define DMX_ARTNET 0
+#define DMX_SACN 1
+#define DMX_ARTNET_PORT 6454
+#define DMX_SACN_PORT 5568
+#define DMX_RATE 44
+#define DMX_CHANNELS 32
+#define DMX_PROFILES 16
+#define DMX_FIXTURES 128
+#define DMX_UNIVERSES 16
+#define DMX_SLOTS 3
+#define DMX_FRESH 0x4
+#define DMX_SYNC_UNIVERSE 63999
+
+#define DMXIN_MAP "./console.json"
+#define DMXIN_PARAMETERS 12
+#define DMXIN_MASTER 9
+#define DMXIN_MODE 10
+#define DMXIN_PRESET 11
+#define DMXIN_CHANNELS 64
+#define DMXIN_SLOTS 3
+#define DMXIN_FRESH 0x4
+#define DMXIN_HOLD 3.0f
+
+#define OSC_PORT 9000
+#define OSC_PACKET 8192
+#define OSC_SLOTS 3
+#define OSC_FRESH 0x4
+#define OSC_DEPTH 4
+#define OSC_COLOR 0
+#define OSC_RGB 3
+#define OSC_MODE 6
+#define OSC_VENUE 7
+#define OSC_SHOWTIME 8
+#define OSC_PRESET 9
+#define OSC_SLIDE 10
+#define OSC_FIELDS 11
+
+#define GAMEPAD_RATE 1000
+#define GAMEPAD_BUTTONS 32
+#define GAMEPAD_NEXT 0
+#define GAMEPAD_PREVIOUS 1
+#define GAMEPAD_MODE 2
+#define GAMEPAD_PRESET 3
+#define GAMEPAD_ACTIONS 4
+
+#define SYNC_GROUP "239.255.78.66"
+#define SYNC_PORT 7800
+#define SYNC_RATE 30
+#define SYNC_PING 250
+#define SYNC_SAMPLES 8
+#define SYNC_SLOTS 3
+#define SYNC_FRESH 0x4
+#define SYNC_AHEAD 60
+#define SYNC_NODES 16
+#define SYNC_STATE 1
+#define SYNC_PING_REQUEST 2
+#define SYNC_PONG 3
+#define SYNC_REPORT 4
+
+#define ASSET_DIR "./http/assets"
+#define ASSET_MANIFEST ASSET_DIR "/manifest.json"
+#define ASSET_STAGE "./http/slides-"
+#define ASSET_CHUNK (1 << 20)
+#define ASSET_WORKERS 4
+#define ASSET_POLL 5000
+#define ASSET_FILES 1024
+
+#define JOURNAL_FILE "./journal.nnbj"
+#define JOURNAL_VERSION 1
+#define JOURNAL_BUFFER (1 << 20)
+#define JOURNAL_FLUSH 250
+#define J_SNAPSHOT 1
+#define J_DATA 2
+#define J_ANIM 3
+#define J_SCENE 4
+#define J_THEME 5
+#define J_FRAME 6
+#define J_CLI 1
+#define J_HTTP 2
+#define J_AUTOSTART 3
+#define J_CONTROL 4
+#define REPLAY_OUT BENCH_DIR "/replay.csv"
+#define REPLAY_SLOWEST 5
+
+#define BENCH_FRAMES 300
+#define BENCH_WARMUP 10
+#define BENCH_LAG 3
+#define BENCH_SIZES 8
+#define BENCH_CLOCK 1700000000
+#define BENCH_DIR "./bench"
+#define BENCH_OUT "./bench.json"
+#define BENCH_BANNER 0
+#define BENCH_SLIDESHOW 1
+#define BENCH_SLIDES 2
+#define BENCH_TEXT 3
+#define BENCH_WALL 4
+#define BENCH_SCENES 5
+#define BENCH_BURST 50
+#define BENCH_BUDGET (1000.0f / 60)
+#define BENCH_WALL_CORES 2
+#define BENCH_CLIP_W 512
+#define BENCH_CLIP_H 288
+#define BENCH_CLIP_FRAMES 24
+#define BENCH_SLOWER 25
+#define BENCH_NOISE 0.25f
+#define BASELINE_MAX 64
+#define GOLDEN_W 480
+#define GOLDEN_H 270
+#define GOLDEN_CASES 7
+#define GOLDEN_DELTA 8.0f
+#define GOLDEN_SPREAD 0.002f
+#define GOLDEN_SOFTWARE 0.04f
+
+#define INSTANCE_MAX 4
+
+#define THEME_MAX 8
+#define THEME_MAPS 3
+#define THEME_BUDGET (128 * 1024 * 1024)
+#define THEME_FADE 1.5
+
+#define WALL_CARD_W 512
+#define WALL_CARD_H 256
+#define WALL_COLUMNS 4
+#define WALL_CARDS 32
+#define WALL_STAGING 4
+#define WALL_VISIBLE 8
+#define WALL_PENDING 64
+#define WALL_SEEN 1024
+#define WALL_POLL 2000
+#define WALL_SPEED 160.0f
+#define WALL_FEED "./http/feed.json"
+
+#define PRESET_MAX 32
+#define PRESET_FILE "./presets.json"
+#define PRESET_FLAGS (F_SLIDESHOW_MODE | F_BASELIGHT | F_METAPOSTS)
+#define SCENE_FADE 1.5f
+
+#define GPU_TEXTURE 0
+#define GPU_BUFFER 1
+#define GPU_RENDERBUFFER 2
+#define GPU_FRAMEBUFFER 3
+#define GPU_VERTEXARRAY 4
+#define GPU_PROGRAM 5
+#define GPU_QUERY 6
+#define GPU_KINDS 7
+#define GPU_OWNERS 24
+#define GPU_BUCKETS 1024
+#define GPU_BUDGET ((size_t)1024 * 1024 * 1024)
+#define IMAGE_CACHE GPU_BUDGET
+#define RECOVERY_TARGET 500
+#define SW_TARGET_FPS 30
+#define SW_TARGET_CORES 4
+
+#define GLDEBUG_SLOTS 256
+#define GLDEBUG_TEXT 128
+
+#define PLUGIN_DIR "./plugins/"
+#define PLUGIN_MAX 16
+#define PLUGIN_QUERIES 4
+#define PLUGIN_BUDGET 1.0f
+#define PLUGIN_STRIKES 3
+#define PLUGIN_RECOVER 120
+#define PLUGIN_COOLDOWN 300
+#define PLUGIN_FAULTED -1
+#define PLUGIN_SKIPPED 0
+#define PLUGIN_CREATE 0
+#define PLUGIN_RESIZE 1
+#define PLUGIN_UPDATE 2
+#define PLUGIN_DRAW 3
+#define PLUGIN_DESTROY 4
+
 #ifndef _WIN32_WINNT
 #define _WIN32_WINNT 0x0600
 #endif
@@ -74,12 +336,35 @@ SOFTWARE.
 #include <map>
 #include <string>
 #include <stdlib.h>
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
 #include <windows.h>
 #include <http.h>
+#include <winhttp.h>
+#include <mmsystem.h>
+#include <bcrypt.h>
+#pragma comment(lib, "winmm.lib")
+#pragma comment(lib, "bcrypt.lib")
+#else
+#include "compat.h"
+#endif
 #include <math.h>
+#include <immintrin.h>
 
 #include <glad/glad.h>
+#ifndef NNB_HEADLESS
+#include <glad/vulkan.h>
+#endif
 #include <GLFW/glfw3.h>
+#ifdef _WIN32
+#define GLFW_EXPOSE_NATIVE_WIN32
+#include <GLFW/glfw3native.h>
+#endif
+#ifdef NNB_HEADLESS
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -87,11 +372,16 @@ SOFTWARE.
 #define STB_IMAGE_IMPLEMENTATION
 #define STBI_FAILURE_USERMSG
 #include "stb_image.h"
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+#include "plugin.h"
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
+#ifdef _WIN32
 #include <Audioclient.h>
 #include <Audiopolicy.h>
+#endif
 
 #define INITIALIZE_HTTP_RESPONSE( resp, status, reason )    \
     do                                                      \
@@ -147,8 +437,8 @@ const char* colorNames[8] = {
 
 #define URL_COUNT 2
 const LPCWSTR urls[URL_COUNT] = {
-    L"http://localhost:80/",
-    L"http://127.0.0.1:80/"
+    L"http://localhost:%d/",
+    L"http://127.0.0.1:%d/"
 };
 
 typedef struct threadData {
@@ -156,30 +446,105 @@ typedef struct threadData {
     char data[256];
 } TDATA;
 
-int SCR_WIDTH, SCR_HEIGHT;
+/*One banner per stage. Each instance has its own window, state block and
+* control endpoint (port 80 + index); decoded images, glyphs, static
+* textures and linked programs are shared between them.
+*/
+typedef struct instance {
+    int index;
+    TDATA* glData;
+    TDATA* httpData;
+    volatile int themeRequest;
+    volatile LONG presetRequest;
+    int preset;
+    volatile LONG journalSource; //Who made the next change, for the show journal
+    int width; //Output size, kept up to date by resizeCanvas
+    int height;
+} INSTANCE;
+INSTANCE instances[INSTANCE_MAX];
+int instanceCount = 1;
+volatile int cliStage = 0;
+
+//GLFW's window list and hints are process-wide, so instance threads take turns with them
+SRWLOCK glfwLock = SRWLOCK_INIT;
+GLFWwindow* shareRoot = NULL;
+
+//Counters shared by every thread. Served at /metrics.json and by the STATS command.
+//GPU memory has its own registry, served at /memory.json and by the MEMORY command.
+typedef struct metricsData {
+    volatile LONG clipFrames;
+    volatile LONG clipDropped;
+    volatile LONG clipLate;
+    volatile float uploadMBps;
+    volatile float uploadLatencyMs;
+    volatile float exportFps;
+    volatile LONG shmFrames;
+    volatile LONG shmDropped;
+    volatile LONG recoveries;
+    volatile float recoveryMs;
+    volatile LONG wallPosts;
+    volatile float wallBakeMs;
+    volatile LONG gpuLeaks;
+    volatile LONG glMessages;
+    volatile LONG glErrors;
+    volatile LONG glPerformance;
+    volatile LONG glDropped;
+    volatile LONG ledFrames;
+    volatile LONG ledPackets;
+    volatile LONG ledDropped;
+    volatile LONG ledLate;
+    volatile float ledLatencyMs;
+    volatile LONG dmxFrames;
+    volatile LONG dmxPackets;
+    volatile LONG dmxLate;
+    volatile float dmxJitterMs;
+    volatile LONG dmxInPackets;
+    volatile LONG dmxInLate;
+    volatile float dmxInLatencyMs;
+    volatile float dmxInLatencyMaxMs;
+    volatile LONG oscMessages;
+    volatile LONG oscBundles;
+    volatile LONG oscDropped;
+    volatile LONG oscApplied;
+    volatile LONG gamepadPresses;
+    volatile LONG gamepadLate;
+    volatile float gamepadLatencyMs;
+    volatile float gamepadLatencyMaxMs;
+    volatile LONG syncPackets;
+    volatile LONG syncStale;
+    volatile float syncOffsetMs;
+    volatile float syncDelayMs;
+    volatile float syncErrorMs;
+    volatile LONG assetChecks;
+    volatile LONG assetChunks;
+    volatile LONG64 assetBytes;
+    volatile LONG assetFailed;
+    volatile LONG assetSwaps;
+    volatile float assetSyncMs;
+    volatile LONG journalRecords;
+    volatile LONG64 journalBytes;
+    volatile LONG journalDropped;
+} METRICS;
+METRICS metrics = {};
 
 void errorCallback(int code, const char* desc) {
     std::cout << "\033[0;91m" << desc << std::endl << "Error Code: " << std::hex << code << "\033[0m" << std::endl;
 }
 
+//Each stage's window carries its INSTANCE; the bench has no window
 void resizeCanvas(GLFWwindow* window, int w, int h) {
     glViewport(0, 0, w, h);
-    SCR_WIDTH = w;
-    SCR_HEIGHT = h;
+    INSTANCE* instance = window != NULL ? (INSTANCE*)glfwGetWindowUserPointer(window) : NULL;
+    if (instance == NULL) return;
+    instance->width = w;
+    instance->height = h;
 }
 
-void processInput(GLFWwindow* window) {
+void processInput(GLFWwindow* window, char* flags, int* hudKey) {
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) glfwSetWindowShouldClose(window, true);
-}
-
-unsigned char* loadImage(const char* path, int* w, int* h, int* c) {
-    unsigned char* data = stbi_load(path, w, h, c, 0);
-    if (!data) {
-        errorCallback(-1, "Unable to load texture!");
-        glfwTerminate();
-        return NULL;
-    }
-    return data;
+    int hud = glfwGetKey(window, GLFW_KEY_F3) == GLFW_PRESS;
+    if (hud && !*hudKey) *flags ^= F_HUD;
+    *hudKey = hud;
 }
 
 char* readFile(const char* path, std::streamsize* size) {
@@ -208,7 +573,628 @@ char* readFileStr(const char* path) {
     return readFileStr(path, &size);
 }
 
+/*Just enough JSON for the flat feeds and config files the banner reads:
+* strings come out as UTF-8, numbers as their text.
+*/
+unsigned int fnv1a(const char* s, unsigned int hash) {
+    while (*s) hash = (hash ^ (unsigned char)*s++) * 16777619u;
+    return hash;
+}
+
+int utf8Encode(unsigned int cp, char* out) {
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }else if (cp < 0x800) {
+        out[0] = (char)(0xC0 | cp >> 6);
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }else if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | cp >> 12);
+        out[1] = (char)(0x80 | (cp >> 6 & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | cp >> 18);
+    out[1] = (char)(0x80 | (cp >> 12 & 0x3F));
+    out[2] = (char)(0x80 | (cp >> 6 & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+unsigned int utf8Decode(const char** s) {
+    const unsigned char* p = (const unsigned char*)*s;
+    unsigned int cp = *p++;
+    int more = cp >= 0xF0 ? 3 : cp >= 0xE0 ? 2 : cp >= 0xC0 ? 1 : 0;
+    if (more) cp &= 0x3F >> more;
+    for (; more > 0 && (*p & 0xC0) == 0x80; more--) cp = cp << 6 | (*p++ & 0x3F);
+    *s = (const char*)p;
+    return cp;
+}
+
+//Copies the JSON string starting at the opening quote into out as UTF-8; returns the character after the closing quote
+const char* jsonString(const char* p, const char* end, char* out, int size) {
+    int n = 0;
+    for (p++; p < end && *p != '"'; p++) {
+        char buf[4];
+        int len = 1;
+        buf[0] = *p;
+        if (*p == '\\' && p + 1 < end) {
+            p++;
+            switch (*p) {
+                case 'n': buf[0] = '\n'; break;
+                case 't': buf[0] = ' '; break;
+                case 'r': buf[0] = ' '; break;
+                case 'u':
+                    if (p + 4 < end) {
+                        unsigned int cp = strtoul(std::string(p + 1, 4).c_str(), NULL, 16);
+                        p += 4;
+                        if (cp >= 0xD800 && cp < 0xDC00 && p + 6 < end && p[1] == '\\' && p[2] == 'u') {
+                            unsigned int low = strtoul(std::string(p + 3, 4).c_str(), NULL, 16);
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                            p += 6;
+                        }
+                        len = utf8Encode(cp, buf);
+                    }
+                    break;
+                default: buf[0] = *p; break;
+            }
+        }
+        if (n + len < size) {
+            memcpy(out + n, buf, len);
+            n += len;
+        }
+    }
+    if (size > 0) out[n] = '\0';
+    return p < end ? p + 1 : end;
+}
+
+//Finds the next object with no objects inside it; returns its closing brace, or NULL at the end
+const char* jsonObject(const char* p, const char* end, const char** object) {
+    *object = NULL;
+    for (; p < end; p++) {
+        if (*p == '"') {
+            char skip[1];
+            p = jsonString(p, end, skip, 0) - 1;
+        }else if (*p == '{') *object = p;
+        else if (*p == '}' && *object != NULL) return p;
+    }
+    return NULL;
+}
+
+//Reads a string or number member of a flat object
+int jsonField(const char* obj, const char* end, const char* key, char* out, int size) {
+    char quoted[32];
+    sprintf_s(quoted, "\"%s\"", key);
+    size_t keyLength = strlen(quoted);
+    for (const char* p = obj; p + keyLength < end; p++) {
+        if (*p == '\\') {
+            p++;
+            continue;
+        }
+        if (memcmp(p, quoted, keyLength) != 0) continue;
+        const char* v = p + keyLength;
+        while (v < end && (*v == ' ' || *v == '\t' || *v == '\r' || *v == '\n')) v++;
+        if (v >= end || *v != ':') continue;
+        for (v++; v < end && (*v == ' ' || *v == '\t' || *v == '\r' || *v == '\n'); v++) {}
+        if (v < end && *v == '"') {
+            jsonString(v, end, out, size);
+            return 1;
+        }
+        int n = 0;
+        for (; v < end && n + 1 < size && *v != ',' && *v != '}' && *v != ' '; v++) out[n++] = *v;
+        out[n] = '\0';
+        return n > 0;
+    }
+    if (size > 0) out[0] = '\0';
+    return 0;
+}
+
+//GETs a URL into a heap buffer, zero terminated
+char* fetchUrl(const char* url, size_t* size) {
+#ifndef _WIN32
+    errorCallback(-1, "URL feeds need WinHTTP; use a feed file instead.");
+    return NULL;
+#else
+    wchar_t wide[512];
+    MultiByteToWideChar(CP_UTF8, 0, url, -1, wide, 512);
+    wchar_t host[256], path[256], query[256], object[512];
+    URL_COMPONENTS parts = {};
+    parts.dwStructSize = sizeof(parts);
+    parts.lpszHostName = host;
+    parts.dwHostNameLength = 256;
+    parts.lpszUrlPath = path;
+    parts.dwUrlPathLength = 256;
+    parts.lpszExtraInfo = query;
+    parts.dwExtraInfoLength = 256;
+    if (!WinHttpCrackUrl(wide, 0, 0, &parts)) return NULL;
+    wsprintf(object, L"%s%s", path, query);
+    char* result = NULL;
+    size_t length = 0;
+    HINTERNET session = WinHttpOpen(L"NNBDigitalBanner", WINHTTP_ACCESS_TYPE_DEFAULT_PROXY, WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
+    HINTERNET connection = session ? WinHttpConnect(session, host, parts.nPort, 0) : NULL;
+    HINTERNET request = connection ? WinHttpOpenRequest(connection, L"GET", object, NULL, WINHTTP_NO_REFERER,
+        WINHTTP_DEFAULT_ACCEPT_TYPES, parts.nScheme == INTERNET_SCHEME_HTTPS ? WINHTTP_FLAG_SECURE : 0) : NULL;
+    if (request && WinHttpSendRequest(request, WINHTTP_NO_ADDITIONAL_HEADERS, 0, WINHTTP_NO_REQUEST_DATA, 0, 0, 0)
+        && WinHttpReceiveResponse(request, NULL)) {
+        DWORD available = 0;
+        while (WinHttpQueryDataAvailable(request, &available) && available > 0) {
+            char* grown = (char*)(result == NULL ? HeapAlloc(GetProcessHeap(), 0, length + available + 1)
+                : HeapReAlloc(GetProcessHeap(), 0, result, length + available + 1));
+            if (grown == NULL) break;
+            result = grown;
+            DWORD read = 0;
+            if (!WinHttpReadData(request, result + length, available, &read)) break;
+            length += read;
+        }
+        if (result != NULL) result[length] = '\0';
+    }
+    if (request) WinHttpCloseHandle(request);
+    if (connection) WinHttpCloseHandle(connection);
+    if (session) WinHttpCloseHandle(session);
+    if (size != NULL) *size = length;
+    return result;
+#endif
+}
+
+int isUrl(const char* path) {
+    return _strnicmp(path, "http://", 7) == 0 || _strnicmp(path, "https://", 8) == 0;
+}
+
+/*Decoded images keyed by path. Pixels live in pagefile-backed sections, so
+* the OS can page out what isn't being used, and re-creating the GL objects
+* after a device reset is a straight upload rather than another PNG decode.
+* Everything is stored as RGBA. findImage and cacheImage hand out a reference
+* that releaseImage gives back; once the cache holds more than IMAGE_CACHE
+* (no more than the GPU could ever need re-uploaded), the least recently used
+* images nobody holds are dropped and decoded again if they are asked for.
+*/
+typedef struct cachedImage {
+    char path[MAX_PATH];
+    int width;
+    int height;
+    int frames;
+    int* delays;
+    unsigned char* pixels;
+    HANDLE mapping;
+    size_t bytes;
+    volatile LONG users;
+    volatile LONG used;
+    struct cachedImage* next;
+} CIMAGE;
+
+CIMAGE* imageCache = NULL;
+SRWLOCK imageCacheLock = SRWLOCK_INIT;
+size_t imageCacheBytes = 0;
+volatile LONG imageClock = 0;
+
+void freeImage(CIMAGE* image) {
+    UnmapViewOfFile(image->pixels);
+    CloseHandle(image->mapping);
+    if (image->delays != NULL) HeapFree(GetProcessHeap(), 0, image->delays);
+    HeapFree(GetProcessHeap(), 0, image);
+}
+
+//Caller holds the lock exclusively; unlinks the least recently used idle images until under the cap
+CIMAGE* evictImages() {
+    CIMAGE* evicted = NULL;
+    while (imageCacheBytes > IMAGE_CACHE) {
+        CIMAGE** oldest = NULL;
+        for (CIMAGE** link = &imageCache; *link != NULL; link = &(*link)->next) {
+            if ((*link)->users == 0 && (oldest == NULL || (*link)->used - (*oldest)->used < 0)) oldest = link;
+        }
+        if (oldest == NULL) break;
+        CIMAGE* image = *oldest;
+        *oldest = image->next;
+        imageCacheBytes -= image->bytes;
+        image->next = evicted;
+        evicted = image;
+    }
+    return evicted;
+}
+
+CIMAGE* findImage(const char* path) {
+    AcquireSRWLockShared(&imageCacheLock);
+    CIMAGE* image = imageCache;
+    while (image != NULL && strcmp(image->path, path) != 0) image = image->next;
+    if (image != NULL) {
+        InterlockedIncrement(&image->users);
+        InterlockedExchange(&image->used, InterlockedIncrement(&imageClock));
+    }
+    ReleaseSRWLockShared(&imageCacheLock);
+    return image;
+}
+
+void releaseImage(CIMAGE* image) {
+    if (image == NULL || InterlockedDecrement(&image->users) > 0) return;
+    AcquireSRWLockExclusive(&imageCacheLock);
+    CIMAGE* evicted = evictImages();
+    ReleaseSRWLockExclusive(&imageCacheLock);
+    while (evicted != NULL) {
+        CIMAGE* next = evicted->next;
+        freeImage(evicted);
+        evicted = next;
+    }
+}
+
+//Decodes outside the lock; if two threads race on one path the loser's copy is dropped
+CIMAGE* cacheImage(const char* path, int animated) {
+    CIMAGE* image = findImage(path);
+    if (image != NULL) return image;
+    int w, h, c, frames = 1;
+    int* delays = NULL;
+    unsigned char* data;
+    if (animated) {
+        std::streamsize size;
+        char* gif = readFile(path, &size);
+        if (gif == NULL) return NULL;
+        data = stbi_load_gif_from_memory((stbi_uc*)gif, (int)size - 1, &delays, &w, &h, &frames, &c, STBI_rgb_alpha);
+        HeapFree(GetProcessHeap(), 0, gif);
+    }else data = stbi_load(path, &w, &h, &c, STBI_rgb_alpha);
+    if (data == NULL) return NULL;
+
+    size_t bytes = (size_t)w * h * 4 * frames;
+    image = (CIMAGE*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(CIMAGE));
+    image->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((ULONGLONG)bytes >> 32), (DWORD)bytes, NULL);
+    image->pixels = image->mapping ? (unsigned char*)MapViewOfFile(image->mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0) : NULL;
+    if (image->pixels == NULL) {
+        errorCallback(-1, "Unable to cache image!");
+        if (image->mapping != NULL) CloseHandle(image->mapping);
+        HeapFree(GetProcessHeap(), 0, image);
+        stbi_image_free(data);
+        if (delays != NULL) stbi_image_free(delays);
+        return NULL;
+    }
+    memcpy(image->pixels, data, bytes);
+    stbi_image_free(data);
+    if (delays != NULL) {
+        image->delays = (int*)HeapAlloc(GetProcessHeap(), 0, sizeof(int) * frames);
+        memcpy(image->delays, delays, sizeof(int) * frames);
+        stbi_image_free(delays);
+    }
+    sprintf_s(image->path, "%s", path);
+    image->width = w;
+    image->height = h;
+    image->frames = frames;
+    image->bytes = bytes;
+    image->users = 1;
+    image->used = InterlockedIncrement(&imageClock);
+
+    AcquireSRWLockExclusive(&imageCacheLock);
+    CIMAGE* existing = imageCache;
+    while (existing != NULL && strcmp(existing->path, path) != 0) existing = existing->next;
+    CIMAGE* evicted = NULL;
+    if (existing == NULL) {
+        image->next = imageCache;
+        imageCache = image;
+        imageCacheBytes += bytes;
+        evicted = evictImages();
+    }else InterlockedIncrement(&existing->users);
+    ReleaseSRWLockExclusive(&imageCacheLock);
+    while (evicted != NULL) {
+        CIMAGE* next = evicted->next;
+        freeImage(evicted);
+        evicted = next;
+    }
+    if (existing != NULL) {
+        freeImage(image);
+        return existing;
+    }
+    return image;
+}
+
+CIMAGE* loadImage(const char* path, int* w, int* h, int* c) {
+    CIMAGE* image = cacheImage(path, 0);
+    if (!image) {
+        errorCallback(-1, "Unable to load texture!");
+        glfwTerminate();
+        return NULL;
+    }
+    *w = image->width;
+    *h = image->height;
+    *c = 4;
+    return image;
+}
+
+/*The context GL objects are registered against, and where GL entry points
+* come from. Windowed builds get both from GLFW; the headless bench makes its
+* own EGL context and only falls back to a GLFW (OSMesa) one.
+*/
+void* glContext() {
+#ifdef NNB_HEADLESS
+    EGLContext context = eglGetCurrentContext();
+    if (context != EGL_NO_CONTEXT) return context;
+#endif
+    return glfwGetCurrentContext();
+}
+
+void* glProcAddress(const char* name) {
+#ifdef NNB_HEADLESS
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT) return (void*)eglGetProcAddress(name);
+#endif
+    return (void*)glfwGetProcAddress(name);
+}
+
+/*Every GL object the banner makes goes through gpuCreate and gpuDelete, so
+* each one is on the books with its size, format and the subsystem that owns
+* it. Textures, buffers, renderbuffers and programs live in the share group;
+* vertex arrays, framebuffers and queries belong to the context that made
+* them. Anything a context made that is still registered once its instance
+* has shut down is a leak: it is reported, and shared objects stay on the
+* books since they hold memory until the next device reset. Objects are
+* hashed by kind and name, and bytes are totalled per owner as they change,
+* so a lookup or a budget check never walks the whole registry. Optional
+* memory (prefetched themes, cached images) is kept under GPU_BUDGET.
+*/
+typedef struct gpuObject {
+    int kind;
+    unsigned int name;
+    void* context;
+    const char* owner;
+    GLenum format;
+    size_t bytes;
+    LONG generation;
+    int leaked;
+    struct gpuObject* next;
+} GOBJECT;
+
+typedef struct gpuTotals {
+    int count[GPU_KINDS];
+    size_t bytes[GPU_KINDS];
+    const char* owner[GPU_OWNERS];
+    int ownerCount[GPU_OWNERS];
+    size_t ownerBytes[GPU_OWNERS];
+    int owners;
+    int objects;
+    size_t total;
+    int leaked;
+    size_t leakedBytes;
+} GTOTALS;
+
+const char* gpuKindNames[GPU_KINDS] = { "textures", "buffers", "renderbuffers", "framebuffers", "vertexArrays", "programs", "queries" };
+GOBJECT* gpuObjects[GPU_BUCKETS] = {};
+const char* gpuOwners[GPU_OWNERS] = {};
+size_t gpuOwnerBytes[GPU_OWNERS] = {};
+size_t gpuTotalBytes = 0;
+SRWLOCK gpuObjectLock = SRWLOCK_INIT;
+volatile LONG gpuGeneration = 0;
+
+int gpuShared(int kind) {
+    return kind == GPU_TEXTURE || kind == GPU_BUFFER || kind == GPU_RENDERBUFFER || kind == GPU_PROGRAM;
+}
+
+GOBJECT** gpuBucket(int kind, unsigned int name) {
+    return &gpuObjects[(name * GPU_KINDS + kind) & (GPU_BUCKETS - 1)];
+}
+
+//Caller holds gpuObjectLock
+void gpuCharge(const char* owner, size_t add, size_t remove) {
+    gpuTotalBytes += add - remove;
+    int o = 0;
+    while (o < GPU_OWNERS && gpuOwners[o] != NULL && strcmp(gpuOwners[o], owner) != 0) o++;
+    if (o == GPU_OWNERS) return;
+    gpuOwners[o] = owner;
+    gpuOwnerBytes[o] += add - remove;
+}
+
+//Caller holds gpuObjectLock
+GOBJECT** gpuFind(int kind, unsigned int name) {
+    void* context = gpuShared(kind) ? NULL : glContext();
+    GOBJECT** link = gpuBucket(kind, name);
+    while (*link != NULL && ((*link)->kind != kind || (*link)->name != name || (context != NULL && (*link)->context != context))) link = &(*link)->next;
+    return link;
+}
+
+void gpuCreate(int kind, int count, unsigned int* names, const char* owner) {
+    switch (kind) {
+    case GPU_TEXTURE: glGenTextures(count, names); break;
+    case GPU_BUFFER: glGenBuffers(count, names); break;
+    case GPU_RENDERBUFFER: glGenRenderbuffers(count, names); break;
+    case GPU_FRAMEBUFFER: glGenFramebuffers(count, names); break;
+    case GPU_VERTEXARRAY: glGenVertexArrays(count, names); break;
+    case GPU_PROGRAM: for (int i = 0; i < count; i++) names[i] = glCreateProgram(); break;
+    case GPU_QUERY: glGenQueries(count, names); break;
+    }
+    void* context = glContext();
+    AcquireSRWLockExclusive(&gpuObjectLock);
+    for (int i = 0; i < count; i++) {
+        GOBJECT* object = (GOBJECT*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(GOBJECT));
+        object->kind = kind;
+        object->name = names[i];
+        object->context = context;
+        object->owner = owner;
+        object->generation = gpuGeneration;
+        GOBJECT** bucket = gpuBucket(kind, names[i]);
+        object->next = *bucket;
+        *bucket = object;
+    }
+    ReleaseSRWLockExclusive(&gpuObjectLock);
+}
+
+//Record the storage behind an object after glTexImage2D, glBufferData and the like
+void gpuStorage(int kind, unsigned int name, GLenum format, size_t bytes) {
+    AcquireSRWLockExclusive(&gpuObjectLock);
+    GOBJECT* object = *gpuFind(kind, name);
+    if (object != NULL) {
+        gpuCharge(object->owner, bytes, object->bytes);
+        object->format = format;
+        object->bytes = bytes;
+    }
+    ReleaseSRWLockExclusive(&gpuObjectLock);
+}
+
+//Objects shared between instances (the asset cache, glyphs) outlive the context that made them
+void gpuShare(int kind, unsigned int name) {
+    AcquireSRWLockExclusive(&gpuObjectLock);
+    GOBJECT* object = *gpuFind(kind, name);
+    if (object != NULL) object->context = NULL;
+    ReleaseSRWLockExclusive(&gpuObjectLock);
+}
+
+void gpuDelete(int kind, int count, unsigned int* names) {
+    switch (kind) {
+    case GPU_TEXTURE: glDeleteTextures(count, names); break;
+    case GPU_BUFFER: glDeleteBuffers(count, names); break;
+    case GPU_RENDERBUFFER: glDeleteRenderbuffers(count, names); break;
+    case GPU_FRAMEBUFFER: glDeleteFramebuffers(count, names); break;
+    case GPU_VERTEXARRAY: glDeleteVertexArrays(count, names); break;
+    case GPU_PROGRAM: for (int i = 0; i < count; i++) glDeleteProgram(names[i]); break;
+    case GPU_QUERY: glDeleteQueries(count, names); break;
+    }
+    AcquireSRWLockExclusive(&gpuObjectLock);
+    for (int i = 0; i < count; i++) {
+        if (names[i] == 0) continue;
+        GOBJECT** link = gpuFind(kind, names[i]);
+        GOBJECT* object = *link;
+        if (object == NULL) continue;
+        *link = object->next;
+        gpuCharge(object->owner, 0, object->bytes);
+        HeapFree(GetProcessHeap(), 0, object);
+    }
+    ReleaseSRWLockExclusive(&gpuObjectLock);
+}
+
+size_t gpuTextureBytes(GLenum format, int width, int height, int mipmapped) {
+    size_t texel = 4;
+    switch (format) {
+    case GL_RED: case GL_R8: texel = 1; break;
+    case GL_RG8: case GL_R16F: texel = 2; break;
+    case GL_RGBA16F: texel = 8; break;
+    case GL_RGBA32F: texel = 16; break;
+    }
+    size_t bytes = (size_t)width * height * texel;
+    //A full mip chain adds a third
+    return mipmapped ? bytes + bytes / 3 : bytes;
+}
+
+//Bytes currently held by one subsystem, or by everything with NULL
+size_t gpuUsage(const char* owner) {
+    size_t bytes = 0;
+    AcquireSRWLockShared(&gpuObjectLock);
+    if (owner == NULL) bytes = gpuTotalBytes;
+    else for (int o = 0; o < GPU_OWNERS && gpuOwners[o] != NULL; o++) if (strcmp(gpuOwners[o], owner) == 0) bytes = gpuOwnerBytes[o];
+    ReleaseSRWLockShared(&gpuObjectLock);
+    return bytes;
+}
+
+//Whether [bytes] more of optional memory still fit under GPU_BUDGET
+int gpuBudget(size_t bytes) {
+    return gpuUsage(NULL) + bytes <= GPU_BUDGET;
+}
+
+void gpuTotals(GTOTALS* totals) {
+    *totals = {};
+    AcquireSRWLockShared(&gpuObjectLock);
+    for (int b = 0; b < GPU_BUCKETS; b++) for (GOBJECT* object = gpuObjects[b]; object != NULL; object = object->next) {
+        totals->objects++;
+        totals->total += object->bytes;
+        totals->count[object->kind]++;
+        totals->bytes[object->kind] += object->bytes;
+        if (object->leaked) {
+            totals->leaked++;
+            totals->leakedBytes += object->bytes;
+        }
+        int o = 0;
+        while (o < totals->owners && strcmp(totals->owner[o], object->owner) != 0) o++;
+        if (o == totals->owners) {
+            if (o == GPU_OWNERS) continue;
+            totals->owner[totals->owners++] = object->owner;
+        }
+        totals->ownerCount[o]++;
+        totals->ownerBytes[o] += object->bytes;
+    }
+    ReleaseSRWLockShared(&gpuObjectLock);
+}
+
+int writeMemory(char* buffer, int size) {
+    GTOTALS totals;
+    gpuTotals(&totals);
+    int length = sprintf_s(buffer, size, "{\"objects\":%d,\"bytes\":%zu,\"leaked\":%d,\"leakedBytes\":%zu,\"kinds\":{",
+        totals.objects, totals.total, totals.leaked, totals.leakedBytes);
+    for (int k = 0; k < GPU_KINDS; k++) {
+        length += sprintf_s(buffer + length, size - length, "%s\"%s\":{\"count\":%d,\"bytes\":%zu}",
+            k > 0 ? "," : "", gpuKindNames[k], totals.count[k], totals.bytes[k]);
+    }
+    length += sprintf_s(buffer + length, size - length, "},\"owners\":{");
+    for (int o = 0; o < totals.owners; o++) {
+        length += sprintf_s(buffer + length, size - length, "%s\"%s\":{\"count\":%d,\"bytes\":%zu}",
+            o > 0 ? "," : "", totals.owner[o], totals.ownerCount[o], totals.ownerBytes[o]);
+    }
+    length += sprintf_s(buffer + length, size - length, "}}");
+    return length;
+}
+
+//Called once an instance has released everything it knows about, with its context still current
+int gpuLeaks(void* context) {
+    int leaks = 0;
+    AcquireSRWLockExclusive(&gpuObjectLock);
+    for (int b = 0; b < GPU_BUCKETS; b++) for (GOBJECT** link = &gpuObjects[b]; *link != NULL; ) {
+        GOBJECT* object = *link;
+        if (object->context != context || object->leaked || object->generation != gpuGeneration) {
+            link = &object->next;
+            continue;
+        }
+        leaks++;
+        std::cout << "\033[0;93mLeaked " << gpuKindNames[object->kind] << " " << object->name << " (" << object->owner
+            << ", " << object->bytes / 1048576.0 << " MB, format 0x" << std::hex << object->format << std::dec << ")\033[0m" << std::endl;
+        if (gpuShared(object->kind)) {
+            object->leaked = 1;
+            link = &object->next;
+        }else {
+            //Went down with the context
+            *link = object->next;
+            gpuCharge(object->owner, 0, object->bytes);
+            HeapFree(GetProcessHeap(), 0, object);
+        }
+    }
+    ReleaseSRWLockExclusive(&gpuObjectLock);
+    if (leaks > 0) InterlockedExchangeAdd(&metrics.gpuLeaks, leaks);
+    return leaks;
+}
+
+//A device reset takes every object from the old generation with it
+void gpuPurge() {
+    AcquireSRWLockExclusive(&gpuObjectLock);
+    for (int b = 0; b < GPU_BUCKETS; b++) for (GOBJECT** link = &gpuObjects[b]; *link != NULL; ) {
+        GOBJECT* object = *link;
+        if (object->generation == gpuGeneration) {
+            link = &object->next;
+            continue;
+        }
+        *link = object->next;
+        gpuCharge(object->owner, 0, object->bytes);
+        HeapFree(GetProcessHeap(), 0, object);
+    }
+    ReleaseSRWLockExclusive(&gpuObjectLock);
+}
+
+//Linked program binaries, so rebuilding after a device reset skips the compiler
+typedef struct cachedProgram {
+    char paths[2][MAX_PATH];
+    GLenum format;
+    GLint length;
+    void* binary;
+    struct cachedProgram* next;
+} CPROGRAM;
+CPROGRAM* programCache = NULL;
+
 unsigned int initShader(const char* vpath, const char* fpath) {
+    CPROGRAM* cached = programCache;
+    while (cached != NULL && (strcmp(cached->paths[0], vpath) != 0 || strcmp(cached->paths[1], fpath) != 0)) cached = cached->next;
+    if (cached != NULL) {
+        unsigned int program;
+        gpuCreate(GPU_PROGRAM, 1, &program, "shaders");
+        glProgramBinary(program, cached->format, cached->binary, cached->length);
+        int linked;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked) {
+            gpuStorage(GPU_PROGRAM, program, cached->format, cached->length);
+            return program;
+        }
+        //The driver can reject binaries across a reset; fall back to compiling
+        gpuDelete(GPU_PROGRAM, 1, &program);
+    }
+
     char* vSource = readFileStr(vpath);
     char* fSource = readFileStr(fpath);
 
@@ -238,9 +1224,11 @@ unsigned int initShader(const char* vpath, const char* fpath) {
     HeapFree(GetProcessHeap(), 0, vSource);
     HeapFree(GetProcessHeap(), 0, fSource);
 
-    unsigned int program = glCreateProgram();
+    unsigned int program;
+    gpuCreate(GPU_PROGRAM, 1, &program, "shaders");
     glAttachShader(program, vShader);
     glAttachShader(program, fShader);
+    if (GLAD_GL_VERSION_4_1) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(program);
 
     glGetProgramiv(program, GL_LINK_STATUS, &success);
@@ -250,6 +1238,19 @@ unsigned int initShader(const char* vpath, const char* fpath) {
         ExitProcess(-1);
     }
 
+    GLint length = 0;
+    if (GLAD_GL_VERSION_4_1 && cached == NULL) glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length > 0) {
+        cached = (CPROGRAM*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(CPROGRAM));
+        cached->binary = HeapAlloc(GetProcessHeap(), 0, length);
+        glGetProgramBinary(program, length, &cached->length, &cached->format, cached->binary);
+        gpuStorage(GPU_PROGRAM, program, cached->format, cached->length);
+        sprintf_s(cached->paths[0], "%s", vpath);
+        sprintf_s(cached->paths[1], "%s", fpath);
+        cached->next = programCache;
+        programCache = cached;
+    }
+
     glDeleteShader(vShader);
     glDeleteShader(fShader);
     std::cout << vpath << " and " << fpath << " compiled successfully." << std::endl;
@@ -263,7 +1264,7 @@ struct texture {
     int channels;
 };
 
-struct texture generateTexture(const char* path, unsigned int active) {
+struct texture generateTexture(const char* path, unsigned int active, const char* owner) {
     glActiveTexture(active);
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -272,17 +1273,107 @@ struct texture generateTexture(const char* path, unsigned int active) {
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
     struct texture texture;
-    glGenTextures(1, &texture.texture);
+    gpuCreate(GPU_TEXTURE, 1, &texture.texture, owner);
     glActiveTexture(active);
     glBindTexture(GL_TEXTURE_2D, texture.texture);
-    unsigned char* data = loadImage(path, &texture.width, &texture.height, &texture.channels);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texture.width, texture.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+    CIMAGE* image = loadImage(path, &texture.width, &texture.height, &texture.channels);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texture.width, texture.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image != NULL ? image->pixels : NULL);
+    releaseImage(image);
     glGenerateMipmap(GL_TEXTURE_2D);
-    stbi_image_free(data);
+    gpuStorage(GPU_TEXTURE, texture.texture, GL_RGBA8, gpuTextureBytes(GL_RGBA8, texture.width, texture.height, 1));
+    return texture;
+}
+
+/*GL objects shared by every banner instance. Instance windows all share one
+* hidden root context, so a texture or program made by one is usable by the
+* rest. Entries are refcounted; a device reset takes the whole share group
+* down, so resetAssets drops the table and bumps gpuGeneration instead.
+*/
+typedef struct gpuAsset {
+    char key[2][MAX_PATH];
+    unsigned int name;
+    int width;
+    int height;
+    LONG refs;
+    struct gpuAsset* next;
+} GASSET;
+
+GASSET* gpuAssets = NULL;
+SRWLOCK gpuAssetLock = SRWLOCK_INIT;
+
+GASSET* findAsset(const char* key0, const char* key1) {
+    GASSET* asset = gpuAssets;
+    while (asset != NULL && (strcmp(asset->key[0], key0) != 0 || strcmp(asset->key[1], key1) != 0)) asset = asset->next;
+    return asset;
+}
+
+GASSET* addAsset(const char* key0, const char* key1, unsigned int name) {
+    GASSET* asset = (GASSET*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(GASSET));
+    sprintf_s(asset->key[0], "%s", key0);
+    sprintf_s(asset->key[1], "%s", key1);
+    asset->name = name;
+    asset->next = gpuAssets;
+    gpuAssets = asset;
+    gpuShare(strlen(key1) > 0 ? GPU_PROGRAM : GPU_TEXTURE, name);
+    //Another context may only use the object once it has landed
+    glFinish();
+    return asset;
+}
+
+struct texture acquireTexture(const char* path, const char* owner) {
+    AcquireSRWLockExclusive(&gpuAssetLock);
+    GASSET* asset = findAsset(path, "");
+    if (asset == NULL) {
+        struct texture texture = generateTexture(path, GL_TEXTURE0, owner);
+        asset = addAsset(path, "", texture.texture);
+        asset->width = texture.width;
+        asset->height = texture.height;
+    }
+    asset->refs++;
+    struct texture texture = { asset->name, asset->width, asset->height, 4 };
+    ReleaseSRWLockExclusive(&gpuAssetLock);
     return texture;
 }
 
-float textColor[3] = { 1.0f, 1.0f, 1.0f };
+unsigned int acquireProgram(const char* vpath, const char* fpath) {
+    AcquireSRWLockExclusive(&gpuAssetLock);
+    GASSET* asset = findAsset(vpath, fpath);
+    if (asset == NULL) asset = addAsset(vpath, fpath, initShader(vpath, fpath));
+    asset->refs++;
+    unsigned int program = asset->name;
+    ReleaseSRWLockExclusive(&gpuAssetLock);
+    return program;
+}
+
+//Textures and programs have separate name spaces, so the caller says which it is
+void releaseAsset(unsigned int name, int program, LONG generation) {
+    if (generation != gpuGeneration) return;
+    AcquireSRWLockExclusive(&gpuAssetLock);
+    GASSET** link = &gpuAssets;
+    while (*link != NULL && ((*link)->name != name || (strlen((*link)->key[1]) > 0) != program)) link = &(*link)->next;
+    GASSET* asset = *link;
+    if (asset != NULL && --asset->refs == 0) {
+        gpuDelete(program ? GPU_PROGRAM : GPU_TEXTURE, 1, &asset->name);
+        *link = asset->next;
+        HeapFree(GetProcessHeap(), 0, asset);
+    }
+    ReleaseSRWLockExclusive(&gpuAssetLock);
+}
+
+void resetAssets() {
+    AcquireSRWLockExclusive(&gpuAssetLock);
+    while (gpuAssets != NULL) {
+        GASSET* next = gpuAssets->next;
+        HeapFree(GetProcessHeap(), 0, gpuAssets);
+        gpuAssets = next;
+    }
+    InterlockedIncrement(&gpuGeneration);
+    gpuPurge();
+    ReleaseSRWLockExclusive(&gpuAssetLock);
+}
+
+//Per thread, since every instance's GL thread sets it before drawing text
+thread_local float textColor[3] = { 1.0f, 1.0f, 1.0f };
 void setTextColor(float r, float g, float b) {
     textColor[0] = r;
     textColor[1] = g;
@@ -296,15 +1387,20 @@ struct Glyph {
     unsigned int advance;
 };
 std::map<char, Glyph> charMap;
+//Every stage draws from charMap, and whichever rebuilds the share group after a reset rewrites it
+SRWLOCK glyphLock = SRWLOCK_INIT;
 
 void drawText(char* message, float x, float y, float size, unsigned int vbo) {
     float xinit = x;
+    AcquireSRWLockShared(&glyphLock);
     for (char* c = message; *c != '\0'; c++) {
         if (*c == '\n') {
             x = xinit;
             y += 68;
         }
-        Glyph g = charMap[*c];
+        std::map<char, Glyph>::iterator found = charMap.find(*c);
+        if (found == charMap.end()) continue;
+        Glyph g = found->second;
         float xpos = x + g.bearing.x * size;
         float ypos = y - (g.size.y - g.bearing.y) * size;
         float w = g.size.x * size;
@@ -324,6 +1420,7 @@ void drawText(char* message, float x, float y, float size, unsigned int vbo) {
         glDrawArrays(GL_TRIANGLES, 0, 6);
         x += (g.advance >> 6) * size;
     }
+    ReleaseSRWLockShared(&glyphLock);
 }
 
 const float IDENTITY_MATRIX_4X4_BECAUSE_I_CANT_TRUST_GLM_IMPLEMENTATION_FOR_SHIT[16] = {
@@ -341,513 +1438,9280 @@ void writeFlags(char* elByte, char mask, char content) {
     *elByte = ((~mask & *elByte) | (mask & content));
 }
 
-DWORD WINAPI GLmain (LPVOID lpParam) {
-    TDATA* threadData = (TDATA*) lpParam;
-    std::cout << "GL thread initialized" << std::endl;
-    threadData->status = T_LOADING;
-    char* COLOR1 = threadData->data + D_COLOR1;
-    char* COLOR2 = threadData->data + D_COLOR2;
-    char* COLOR3 = threadData->data + D_COLOR3;
-    char* FLAGS = threadData->data +  D_FLAGS;
-    int* SHOWTIME = (int*)(threadData->data + D_DOWNBEAT);
-    char* VENUE_NAME = threadData->data + D_VENUENAME;
-    /*Map of thread data:
-    * 0 [ COLOR1 ][ COLOR2 ][ COLOR3 ][0000MBAS]
-    * 4 [            SHOWTIME (int)            ]
-    * 8 [ VENUE N][AME GOES][HERE ...][  etc...]
-    */
+volatile int previewRate = 10;
+int rendererType = R_OPENGL;
+char* exportDir = NULL;
+int exportSeconds = 10;
+int exportFps = 30;
+int exportFormat = EXPORT_PNG;
+int shmOutput = 0;
+const char* ledMap = NULL;
+const char* dmxPatch = NULL;
+const char* dmxInput = NULL;
+int oscPort = 0;
+int gamepadInput = 0;
+const char* gamepadMap = NULL;
+const char* syncRole = NULL;
+const char* syncGroup = NULL;
+int syncPort = 0;
+const char* assetSource = NULL;
+const char* journalPath = NULL;
+const char* wallFeed = WALL_FEED;
+const char* slideDir = SLIDE_DIR;
 
-    glfwSetErrorCallback(errorCallback);
-    if (!glfwInit()) {
-        glfwTerminate();
-        return glfwGetError(NULL);
-    };
-    std::cout << "GLFW: Initialized" << std::endl;
+/*Operator preview window. The show thread blits a downscaled copy of the
+* final frame into one of three shared textures and hands it over through
+* [exchange]; the preview thread owns its own context and does the rest, so
+* the show only ever pays for the blit.
+*/
+typedef struct previewData {
+    GLFWwindow* window;
+    HANDLE thread;
+    HANDLE signal;
+    volatile int running;
+    volatile LONG exchange;
+    unsigned int textures[PREVIEW_SLOTS];
+    GLsync fences[PREVIEW_SLOTS];
+    unsigned int fbo;
+    int back;
+    int width;
+    int height;
+    unsigned int textprog;
+    GLint tP;
+    GLint tC;
+    volatile float frameMs;
+    volatile float renderMs;
+    volatile int slideshow;
+} PDATA;
+
+DWORD WINAPI PreviewMain(LPVOID lpParam) {
+    PDATA* preview = (PDATA*)lpParam;
+    glfwMakeContextCurrent(preview->window);
+    glfwSwapInterval(0);
+
+    //FBOs and VAOs are not shared between contexts, so the preview keeps its own
+    unsigned int readFBO;
+    gpuCreate(GPU_FRAMEBUFFER, 1, &readFBO, "preview");
+    unsigned int pVBO;
+    gpuCreate(GPU_BUFFER, 1, &pVBO, "preview");
+    unsigned int pVAO;
+    gpuCreate(GPU_VERTEXARRAY, 1, &pVAO, "preview");
+    glBindVertexArray(pVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, pVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
+    gpuStorage(GPU_BUFFER, pVBO, 0, sizeof(float) * 6 * 4);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    int front = 2;
+    while (preview->running) {
+        WaitForSingleObject(preview->signal, 100);
+        if (!(preview->exchange & PREVIEW_FRESH)) continue;
+        front = InterlockedExchange(&preview->exchange, front) & ~PREVIEW_FRESH;
+        glWaitSync(preview->fences[front], 0, GL_TIMEOUT_IGNORED);
 
+        //Window state belongs to the thread that created it; everyone else asks under the lock
+        int w, h;
+        AcquireSRWLockExclusive(&glfwLock);
+        glfwGetFramebufferSize(preview->window, &w, &h);
+        ReleaseSRWLockExclusive(&glfwLock);
+        glViewport(0, 0, w, h);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, readFBO);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, preview->textures[front], 0);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(0, 0, preview->width, preview->height, 0, 0, w, h, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glm::mat4 orth = glm::ortho(0.0f, (float)w, 0.0f, (float)h, -1.f, 1.f);
+        float hudColor[3] = { 0.2f, 1.0f, 0.2f };
+        glUseProgram(preview->textprog);
+        glUniformMatrix4fv(preview->tP, 1, GL_FALSE, &orth[0][0]);
+        glUniform3fv(preview->tC, 1, hudColor);
+        glActiveTexture(GL_TEXTURE0);
+        glBindVertexArray(pVAO);
+        char message[64];
+        float frameMs = preview->frameMs;
+        sprintf_s(message, "%.2f ms (%.1f fps) render %.2f ms", frameMs, frameMs > 0 ? 1000 / frameMs : 0, preview->renderMs);
+        drawText(message, 10, h - 30, 0.25f, pVBO);
+        drawText((char*)(preview->slideshow ? "Mode: SLIDESHOW" : "Mode: BANNER"), 10, h - 58, 0.25f, pVBO);
+        glfwSwapBuffers(preview->window);
+    }
+
+    gpuDelete(GPU_VERTEXARRAY, 1, &pVAO);
+    gpuDelete(GPU_BUFFER, 1, &pVBO);
+    gpuDelete(GPU_FRAMEBUFFER, 1, &readFBO);
+    glfwMakeContextCurrent(NULL);
+    return 0;
+}
+
+GLFWwindow* openPreview(PDATA* preview, GLFWwindow* show, int w, int h) {
+    AcquireSRWLockExclusive(&glfwLock);
+    int monitorCount;
+    GLFWmonitor** monitors = glfwGetMonitors(&monitorCount);
+    GLFWmonitor* target = monitors[0];
+    for (int i = 0; i < monitorCount; i++) if (monitors[i] != glfwGetPrimaryMonitor()) target = monitors[i];
+    int mx, my, mw, mh;
+    glfwGetMonitorWorkarea(target, &mx, &my, &mw, &mh);
+
+    glfwDefaultWindowHints();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_FLOATING, GLFW_TRUE);
+    glfwWindowHint(GLFW_FOCUS_ON_SHOW, GLFW_FALSE);
+    preview->width = w / PREVIEW_SCALE;
+    preview->height = h / PREVIEW_SCALE;
+    preview->window = glfwCreateWindow(preview->width, preview->height, "Banner Preview", NULL, show);
+    ReleaseSRWLockExclusive(&glfwLock);
+    if (!preview->window) return NULL;
+    glfwSetWindowPos(preview->window, mx + 32, my + 32);
 
-    const GLFWvidmode* mode = glfwGetVideoMode(glfwGetPrimaryMonitor());
-    glfwWindowHint(GLFW_RED_BITS, mode->redBits);
-    glfwWindowHint(GLFW_GREEN_BITS, mode->greenBits);
-    glfwWindowHint(GLFW_BLUE_BITS, mode->blueBits);
-    glfwWindowHint(GLFW_REFRESH_RATE, mode->refreshRate);
-    glfwWindowHint(GLFW_AUTO_ICONIFY, GLFW_FALSE);
-    GLFWwindow* window = glfwCreateWindow(mode->width, mode->height, "Nashville Nights Band Digital Banner", glfwGetPrimaryMonitor(), NULL);
-    if (!window) {
-        glfwTerminate();
-        return glfwGetError(NULL);
+    gpuCreate(GPU_TEXTURE, PREVIEW_SLOTS, preview->textures, "preview");
+    for (int i = 0; i < PREVIEW_SLOTS; i++) {
+        glBindTexture(GL_TEXTURE_2D, preview->textures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, preview->width, preview->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        gpuStorage(GPU_TEXTURE, preview->textures[i], GL_RGBA8, gpuTextureBytes(GL_RGBA8, preview->width, preview->height, 0));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        preview->fences[i] = NULL;
+    }
+    gpuCreate(GPU_FRAMEBUFFER, 1, &preview->fbo, "preview");
+    preview->back = 0;
+    preview->exchange = 1;
+    preview->running = 1;
+    preview->signal = CreateEventA(NULL, FALSE, FALSE, NULL);
+    DWORD previewID;
+    preview->thread = CreateThread(NULL, 0, PreviewMain, preview, 0, &previewID);
+    std::cout << "Preview window opened." << std::endl;
+    return preview->window;
+}
+
+//Called from the show thread right before swapping; this is the one blit the preview adds.
+void blitPreview(PDATA* preview, int w, int h) {
+    int slot = preview->back;
+    if (preview->fences[slot]) glDeleteSync(preview->fences[slot]);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, preview->fbo);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, preview->textures[slot], 0);
+    glBlitFramebuffer(0, 0, w, h, 0, 0, preview->width, preview->height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    preview->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    preview->back = InterlockedExchange(&preview->exchange, slot | PREVIEW_FRESH) & ~PREVIEW_FRESH;
+    SetEvent(preview->signal);
+}
+
+void closePreview(PDATA* preview) {
+    preview->running = 0;
+    SetEvent(preview->signal);
+    WaitForSingleObject(preview->thread, INFINITE);
+    CloseHandle(preview->thread);
+    CloseHandle(preview->signal);
+    for (int i = 0; i < PREVIEW_SLOTS; i++) if (preview->fences[i]) glDeleteSync(preview->fences[i]);
+    gpuDelete(GPU_TEXTURE, PREVIEW_SLOTS, preview->textures);
+    gpuDelete(GPU_FRAMEBUFFER, 1, &preview->fbo);
+    AcquireSRWLockExclusive(&glfwLock);
+    glfwDestroyWindow(preview->window);
+    ReleaseSRWLockExclusive(&glfwLock);
+    preview->window = NULL;
+    std::cout << "Preview window closed." << std::endl;
+}
+
+/*Animated slide. Frames are decoded ahead by StreamMain into a ring of
+* pixel buffer slots; the render thread only ever issues the PBO->texture copy.
+* s#.gif    animated GIF; the first frame is the poster and StreamMain decodes the rest
+* s#.raw    uncompressed RGBA frames behind a CLIP_HEADER byte header, memory-mapped
+* s#/####.png  numbered PNG frames, decoded one at a time on the worker
+*/
+typedef struct clip {
+    int kind;
+    int width;
+    int height;
+    int frameCount;
+    size_t frameBytes;
+    int* delays;
+    unsigned char* frames;
+    unsigned char* poster;
+    CIMAGE* image; //Holds a decoded GIF in the cache
+    volatile LONG decoded;
+    HANDLE file;
+    HANDLE mapping;
+    char path[MAX_PATH];
+    unsigned int texture;
+    unsigned int pbo;
+    unsigned char* mapped;
+    int persistent;
+    volatile LONG state[CLIP_RING];
+    volatile LONG seq[CLIP_RING];
+    GLsync fences[CLIP_RING];
+    double submitted[CLIP_RING];
+    int read;
+    int write;
+    volatile LONG active;
+    volatile LONG want;
+    LONG decodeSeq;
+    LONG shown;
+    double time;
+    double due;
+} CLIP;
+
+typedef struct streamData {
+    CLIP** clips;
+    int count;
+    HANDLE signal;
+    HANDLE thread;
+    volatile int running;
+} SDATA;
+
+typedef struct clipHeader {
+    char magic[4];
+    unsigned int width;
+    unsigned int height;
+    unsigned int frames;
+    unsigned int fps;
+} CLIPHEADER;
+
+double frameDelay(CLIP* clip, LONG seq) {
+    if (clip->delays != NULL && clip->delays[seq % clip->frameCount] > 0) return clip->delays[seq % clip->frameCount] / 1000.0;
+    return 1.0 / CLIP_FPS;
+}
+
+int decodeFrame(CLIP* clip, int frame, unsigned char* dest) {
+    if (clip->kind == CLIP_SEQUENCE) {
+        char framePath[MAX_PATH];
+        int w, h, c;
+        sprintf_s(framePath, "%s/%04d.png", clip->path, frame);
+        unsigned char* data = stbi_load(framePath, &w, &h, &c, STBI_rgb_alpha);
+        if (data == NULL) return 0;
+        if (w == clip->width && h == clip->height) memcpy(dest, data, clip->frameBytes);
+        stbi_image_free(data);
+        return w == clip->width && h == clip->height;
+    }
+    memcpy(dest, clip->frames + frame * clip->frameBytes, clip->frameBytes);
+    return 1;
+}
+
+CLIP* loadClip(const char* dir, int slide) {
+    CLIP* clip = (CLIP*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(CLIP));
+    char clipPath[MAX_PATH];
+    int comp;
+
+    sprintf_s(clipPath, "%s/s%d.gif", dir, slide);
+    std::ifstream gifFile(clipPath);
+    if (gifFile.is_open()) {
+        gifFile.close();
+        clip->kind = CLIP_GIF;
+        sprintf_s(clip->path, "%s", clipPath);
+        CIMAGE* gif = findImage(clipPath);
+        if (gif != NULL) {
+            clip->image = gif;
+            clip->frames = gif->pixels;
+            clip->delays = gif->delays;
+            clip->width = gif->width;
+            clip->height = gif->height;
+            clip->frameCount = gif->frames;
+            clip->decoded = 1;
+        }else {
+            //Only the first frame is decoded here; the whole animation is left to the stream thread
+            clip->poster = stbi_load(clipPath, &clip->width, &clip->height, &comp, STBI_rgb_alpha);
+            if (clip->poster != NULL) {
+                clip->frames = clip->poster;
+                clip->frameCount = 1;
+            }else errorCallback(-1, stbi_failure_reason());
+        }
+    }
+
+    sprintf_s(clipPath, "%s/s%d.raw", dir, slide);
+    if (clip->kind == 0) clip->file = CreateFileA(clipPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (clip->kind == 0 && clip->file != INVALID_HANDLE_VALUE) {
+        clip->kind = CLIP_RAW;
+        clip->mapping = CreateFileMappingA(clip->file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CLIPHEADER* header = clip->mapping ? (CLIPHEADER*)MapViewOfFile(clip->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+        //The frames are read straight out of the mapping, so the header has to account for every byte of it
+        LARGE_INTEGER size = {};
+        int valid = header != NULL && GetFileSizeEx(clip->file, &size) && size.QuadPart >= CLIP_HEADER && memcmp(header->magic, "NNBF", 4) == 0
+            && header->width > 0 && header->height > 0 && header->frames > 0 && header->width <= CLIP_SIDE && header->height <= CLIP_SIDE
+            && (ULONGLONG)header->width * header->height * 4 * header->frames == (ULONGLONG)size.QuadPart - CLIP_HEADER;
+        if (valid) {
+            clip->width = header->width;
+            clip->height = header->height;
+            clip->frameCount = header->frames;
+            if (header->fps > 0) {
+                clip->delays = (int*)HeapAlloc(GetProcessHeap(), 0, sizeof(int) * clip->frameCount);
+                for (int i = 0; i < clip->frameCount; i++) clip->delays[i] = 1000 / header->fps;
+            }
+            clip->frames = (unsigned char*)header + CLIP_HEADER;
+        }else {
+            errorCallback(-1, "Invalid raw slide file!");
+            if (header != NULL) UnmapViewOfFile(header);
+            if (clip->mapping != NULL) CloseHandle(clip->mapping);
+            CloseHandle(clip->file);
+        }
+    }
+
+    sprintf_s(clipPath, "%s/s%d/0000.png", dir, slide);
+    if (clip->kind == 0) {
+        unsigned char* first = stbi_load(clipPath, &clip->width, &clip->height, &comp, STBI_rgb_alpha);
+        if (first != NULL) {
+            clip->kind = CLIP_SEQUENCE;
+            stbi_image_free(first);
+            sprintf_s(clip->path, "%s/s%d", dir, slide);
+            std::ifstream frameFile;
+            for (clip->frameCount = 1; ; clip->frameCount++) {
+                sprintf_s(clipPath, "%s/%04d.png", clip->path, clip->frameCount);
+                frameFile.open(clipPath);
+                if (!frameFile.is_open()) break;
+                frameFile.close();
+            }
+        }
+    }
+
+    if (clip->kind == 0 || clip->frameCount <= 0 || (clip->kind != CLIP_SEQUENCE && clip->frames == NULL)) {
+        HeapFree(GetProcessHeap(), 0, clip);
+        return NULL;
+    }
+    clip->frameBytes = (size_t)clip->width * clip->height * 4;
+
+    gpuCreate(GPU_BUFFER, 1, &clip->pbo, "clips");
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, clip->pbo);
+    gpuStorage(GPU_BUFFER, clip->pbo, 0, clip->frameBytes * CLIP_RING);
+    clip->persistent = GLAD_GL_VERSION_4_4;
+    if (clip->persistent) {
+        GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, clip->frameBytes * CLIP_RING, NULL, access);
+        clip->mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, clip->frameBytes * CLIP_RING, access);
+    }else {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, clip->frameBytes * CLIP_RING, NULL, GL_STREAM_DRAW);
+        clip->mapped = (unsigned char*)HeapAlloc(GetProcessHeap(), 0, clip->frameBytes * CLIP_RING);
+    }
+
+    //Frame 0 goes up synchronously as the poster frame; the worker starts at frame 1
+    decodeFrame(clip, 0, clip->mapped);
+    gpuCreate(GPU_TEXTURE, 1, &clip->texture, "clips");
+    glBindTexture(GL_TEXTURE_2D, clip->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, clip->width, clip->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+    gpuStorage(GPU_TEXTURE, clip->texture, GL_RGBA8, gpuTextureBytes(GL_RGBA8, clip->width, clip->height, 0));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    if (!clip->persistent) glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, clip->frameBytes, clip->mapped);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, clip->width, clip->height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    clip->fences[0] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    clip->state[0] = S_UPLOADING;
+    clip->write = 1;
+    clip->read = 1;
+    clip->decodeSeq = 1;
+    clip->due = frameDelay(clip, 0);
+    std::cout << "Animated slide " << slide << ": " << clip->frameCount << " frames at " << clip->width << "x" << clip->height << std::endl;
+    return clip;
+}
+
+DWORD WINAPI StreamMain(LPVOID lpParam) {
+    SDATA* stream = (SDATA*)lpParam;
+    while (stream->running) {
+        int idle = 1;
+        for (int i = 0; i < stream->count; i++) {
+            CLIP* clip = stream->clips[i];
+            if (clip != NULL && clip->kind == CLIP_GIF && !clip->decoded) {
+                //Until this lands the clip holds its poster frame; frames are only read on this thread
+                CIMAGE* gif = cacheImage(clip->path, 1);
+                if (gif != NULL && gif->width == clip->width && gif->height == clip->height) {
+                    clip->image = gif;
+                    clip->frames = gif->pixels;
+                    clip->delays = gif->delays;
+                    MemoryBarrier();
+                    clip->frameCount = gif->frames;
+                }else {
+                    releaseImage(gif);
+                    errorCallback(-1, "Unable to decode animated slide!");
+                }
+                InterlockedExchange(&clip->decoded, 1);
+                idle = 0;
+            }
+            if (clip == NULL || !clip->active) continue;
+            int slot = clip->write;
+            if (clip->state[slot] != S_FREE) continue;
+            LONG want = clip->want;
+            if (clip->decodeSeq < want) {
+                //Fell behind; skip straight to the frame the render thread wants next
+                InterlockedExchangeAdd(&metrics.clipDropped, want - clip->decodeSeq);
+                clip->decodeSeq = want;
+            }
+            if (!decodeFrame(clip, clip->decodeSeq % clip->frameCount, clip->mapped + slot * clip->frameBytes)) {
+                errorCallback(-1, "Unable to decode slide frame!");
+                clip->active = 0;
+                continue;
+            }
+            clip->seq[slot] = clip->decodeSeq++;
+            InterlockedExchange(&clip->state[slot], S_READY);
+            clip->write = (slot + 1) % CLIP_RING;
+            idle = 0;
+        }
+        if (idle) WaitForSingleObject(stream->signal, 10);
+    }
+    return 0;
+}
+
+//Render thread side: retire finished uploads and kick off the copy for the frame that is due.
+int streamClip(CLIP* clip, SDATA* stream, double dt, int visible) {
+    for (int i = 0; i < CLIP_RING; i++) {
+        if (clip->state[i] != S_UPLOADING) continue;
+        GLenum status = glClientWaitSync(clip->fences[i], 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) continue;
+        glDeleteSync(clip->fences[i]);
+        clip->fences[i] = NULL;
+        metrics.uploadLatencyMs = (float)((glfwGetTime() - clip->submitted[i]) * 1000);
+        InterlockedExchange(&clip->state[i], S_FREE);
+        SetEvent(stream->signal);
+    }
+    if (!visible) return 0;
+
+    clip->time += dt;
+    while (clip->time >= clip->due) {
+        clip->want++;
+        clip->due += frameDelay(clip, clip->want);
+    }
+    int chosen = -1;
+    while (clip->state[clip->read] == S_READY && clip->seq[clip->read] <= clip->want) {
+        if (chosen >= 0) {
+            InterlockedIncrement(&metrics.clipDropped);
+            InterlockedExchange(&clip->state[chosen], S_FREE);
+        }
+        chosen = clip->read;
+        clip->read = (clip->read + 1) % CLIP_RING;
+    }
+    if (chosen < 0) {
+        if (clip->shown < clip->want) InterlockedIncrement(&metrics.clipLate);
+        return 0;
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, clip->pbo);
+    if (!clip->persistent) glBufferSubData(GL_PIXEL_UNPACK_BUFFER, chosen * clip->frameBytes, clip->frameBytes, clip->mapped + chosen * clip->frameBytes);
+    glBindTexture(GL_TEXTURE_2D, clip->texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, clip->width, clip->height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)(chosen * clip->frameBytes));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    clip->fences[chosen] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    clip->submitted[chosen] = glfwGetTime();
+    clip->shown = clip->seq[chosen];
+    InterlockedExchange(&clip->state[chosen], S_UPLOADING);
+    InterlockedIncrement(&metrics.clipFrames);
+    return (int)clip->frameBytes;
+}
+
+/*Banner themes. Each theme is a diffuse/normal/specular triple; a NULL map
+* falls back to a flat normal or no specular. ThemeLoader decodes on its own
+* thread into a staging buffer, prefetching in table order while themes fit
+* in THEME_BUDGET, and the render thread copies one map a frame out of it.
+* A requested theme that isn't resident yet jumps the queue, evicting the
+* themes shown longest ago if it needs room, and the crossfade starts once
+* it has landed, so a switch mid-show never waits on a decode. A slot's state
+* tracks only its trip through staging; whether its textures are in is the
+* separate resident flag. Storage for all of a theme's maps is allocated
+* when the first one goes up, and every map after that is a sub-image copy.
+*/
+typedef struct themeInfo {
+    const char* name;
+    const char* maps[THEME_MAPS];
+} THEMEINFO;
+
+THEMEINFO themeTable[THEME_MAX] = {
+    { "nnb", { "./img/nnb.png", "./img/normal.png", "./img/alpha.png" } },
+    { "bois", { "./img/bois.png", NULL, NULL } }
+};
+int themeCount = 2;
+
+int findTheme(char* name) {
+    for (int i = 0; i < themeCount; i++) if (streq(name, themeTable[i].name, 0, D_NAMESIZE)) return i;
+    return -1;
+}
+
+typedef struct themeSlot {
+    volatile LONG state;
+    volatile LONG resident;
+    LONG64 bytes;
+    int width[THEME_MAPS];
+    int height[THEME_MAPS];
+    unsigned int maps[THEME_MAPS];
+    int uploaded;
+    GLsync fence;
+    double shown;
+} THEMESLOT;
+
+typedef struct themeData {
+    THEMESLOT slots[THEME_MAX];
+    unsigned int flat[THEME_MAPS];
+    unsigned int pbo;
+    unsigned char* mapped;
+    int persistent;
+    size_t mapBytes;
+    volatile LONG staged;
+    volatile LONG wanted;
+    volatile LONG64 residentBytes;
+    int current;
+    int previous;
+    float fade;
+    volatile int* request;
+    HANDLE signal;
+    HANDLE thread;
+    volatile LONG running;
+} THEMES;
+
+int decodeTheme(THEMES* themes, int index) {
+    THEMESLOT* slot = &themes->slots[index];
+    for (int k = 0; k < THEME_MAPS; k++) {
+        if (themeTable[index].maps[k] == NULL) continue;
+        CIMAGE* image = cacheImage(themeTable[index].maps[k], 0);
+        if (image == NULL || image->width != slot->width[k] || image->height != slot->height[k]) {
+            releaseImage(image);
+            errorCallback(-1, "Unable to decode theme map!");
+            return -1;
+        }
+        memcpy(themes->mapped + k * themes->mapBytes, image->pixels, (size_t)image->width * image->height * 4);
+        releaseImage(image);
+    }
+    return 0;
+}
+
+//Render thread side: texture storage for every map of the theme, allocated once before its first upload
+void allocTheme(THEMES* themes, int index) {
+    THEMESLOT* slot = &themes->slots[index];
+    for (int k = 0; k < THEME_MAPS; k++) {
+        if (themeTable[index].maps[k] == NULL) {
+            slot->maps[k] = themes->flat[k];
+            continue;
+        }
+        gpuCreate(GPU_TEXTURE, 1, &slot->maps[k], "themes");
+        glBindTexture(GL_TEXTURE_2D, slot->maps[k]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        if (GLAD_GL_VERSION_4_2) glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, slot->width[k], slot->height[k]);
+        else glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, slot->width[k], slot->height[k], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        gpuStorage(GPU_TEXTURE, slot->maps[k], GL_RGBA8, gpuTextureBytes(GL_RGBA8, slot->width[k], slot->height[k], 0));
+    }
+}
+
+//Render thread side: one map from staging into its texture, a plain PBO copy
+void uploadTheme(THEMES* themes, int index, int k) {
+    THEMESLOT* slot = &themes->slots[index];
+    if (themeTable[index].maps[k] == NULL) return;
+    size_t offset = k * themes->mapBytes;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, themes->pbo);
+    if (!themes->persistent) glBufferSubData(GL_PIXEL_UNPACK_BUFFER, offset, (size_t)slot->width[k] * slot->height[k] * 4, themes->mapped + offset);
+    glBindTexture(GL_TEXTURE_2D, slot->maps[k]);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, slot->width[k], slot->height[k], GL_RGBA, GL_UNSIGNED_BYTE, (void*)offset);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void evictTheme(THEMES* themes, int index) {
+    THEMESLOT* slot = &themes->slots[index];
+    for (int k = 0; k < THEME_MAPS; k++) if (slot->maps[k] != themes->flat[k]) gpuDelete(GPU_TEXTURE, 1, &slot->maps[k]);
+    slot->uploaded = 0;
+    InterlockedExchangeAdd64(&themes->residentBytes, -slot->bytes);
+    InterlockedExchange(&slot->resident, 0);
+    std::cout << "Theme " << themeTable[index].name << " evicted." << std::endl;
+}
+
+DWORD WINAPI ThemeLoader(LPVOID lpParam) {
+    THEMES* themes = (THEMES*)lpParam;
+    while (themes->running) {
+        int next = -1;
+        if (themes->staged < 0) {
+            LONG wanted = themes->wanted;
+            if (wanted >= 0) {
+                //Nothing else is prefetched until the theme being waited on is in
+                THEMESLOT* slot = &themes->slots[wanted];
+                if (slot->state == S_FREE && !slot->resident && themes->residentBytes + slot->bytes <= THEME_BUDGET) next = wanted;
+            }else for (int i = 0; i < themeCount && next < 0; i++) {
+                THEMESLOT* slot = &themes->slots[i];
+                //Prefetching is optional, so it also stops at the GPU budget
+                if (slot->state == S_FREE && !slot->resident && themes->residentBytes + slot->bytes <= THEME_BUDGET && gpuBudget(slot->bytes)) next = i;
+            }
+        }
+        if (next < 0) {
+            WaitForSingleObject(themes->signal, 10);
+            continue;
+        }
+        THEMESLOT* slot = &themes->slots[next];
+        InterlockedExchangeAdd64(&themes->residentBytes, slot->bytes);
+        if (decodeTheme(themes, next)) {
+            InterlockedExchangeAdd64(&themes->residentBytes, -slot->bytes);
+            InterlockedExchange(&slot->state, T_ERROR);
+            continue;
+        }
+        themes->staged = next;
+        InterlockedExchange(&slot->state, S_READY);
+    }
+    return 0;
+}
+
+int openThemes(THEMES* themes) {
+    unsigned char flat[THEME_MAPS][4] = { { 255, 255, 255, 255 }, { 128, 128, 255, 255 }, { 0, 0, 0, 255 } };
+    gpuCreate(GPU_TEXTURE, THEME_MAPS, themes->flat, "themes");
+    for (int k = 0; k < THEME_MAPS; k++) {
+        glBindTexture(GL_TEXTURE_2D, themes->flat[k]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, flat[k]);
+        gpuStorage(GPU_TEXTURE, themes->flat[k], GL_RGBA8, 4);
+    }
+
+    //Only the headers are read here; sizes drive the budget and the staging buffer
+    for (int i = 0; i < themeCount; i++) {
+        THEMESLOT* slot = &themes->slots[i];
+        for (int k = 0; k < THEME_MAPS; k++) {
+            if (themeTable[i].maps[k] == NULL) continue;
+            int c;
+            if (!stbi_info(themeTable[i].maps[k], &slot->width[k], &slot->height[k], &c)) {
+                errorCallback(-1, "Unable to read theme map!");
+                slot->state = T_ERROR;
+                break;
+            }
+            size_t bytes = (size_t)slot->width[k] * slot->height[k] * 4;
+            slot->bytes += bytes;
+            if (bytes > themes->mapBytes) themes->mapBytes = bytes;
+        }
+    }
+    int first = *themes->request;
+    if (first < 0 || first >= themeCount || themes->slots[first].state != S_FREE) first = 0;
+
+    gpuCreate(GPU_BUFFER, 1, &themes->pbo, "themes");
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, themes->pbo);
+    gpuStorage(GPU_BUFFER, themes->pbo, 0, themes->mapBytes * THEME_MAPS);
+    themes->persistent = GLAD_GL_VERSION_4_4;
+    if (themes->persistent) {
+        GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, themes->mapBytes * THEME_MAPS, NULL, access);
+        themes->mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, themes->mapBytes * THEME_MAPS, access);
+    }else {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, themes->mapBytes * THEME_MAPS, NULL, GL_STREAM_DRAW);
+        themes->mapped = (unsigned char*)HeapAlloc(GetProcessHeap(), 0, themes->mapBytes * THEME_MAPS);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    if (themes->mapped == NULL) return -1;
+
+    //The opening theme goes up synchronously, before the show starts
+    if (decodeTheme(themes, first)) return -1;
+    allocTheme(themes, first);
+    for (int k = 0; k < THEME_MAPS; k++) uploadTheme(themes, first, k);
+    themes->slots[first].uploaded = THEME_MAPS;
+    themes->slots[first].resident = 1;
+    themes->residentBytes = themes->slots[first].bytes;
+    themes->current = first;
+    themes->previous = first;
+    themes->fade = 1.0f;
+    *themes->request = first;
+    themes->staged = -1;
+    themes->wanted = -1;
+    themes->signal = CreateEventA(NULL, FALSE, FALSE, NULL);
+    themes->running = 1;
+    DWORD loaderID;
+    themes->thread = CreateThread(NULL, 0, ThemeLoader, themes, 0, &loaderID);
+    return 0;
+}
+
+//Called once a frame by the GL backend, in either mode, so loading carries on during the slideshow
+void themeFrame(THEMES* themes, double dt) {
+    int staged = themes->staged;
+    if (staged >= 0) {
+        THEMESLOT* slot = &themes->slots[staged];
+        if (slot->state == S_READY) {
+            if (slot->uploaded == 0) allocTheme(themes, staged);
+            uploadTheme(themes, staged, slot->uploaded++);
+            if (slot->uploaded == THEME_MAPS) {
+                slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                InterlockedExchange(&slot->state, S_UPLOADING);
+            }
+        }else if (slot->state == S_UPLOADING && glClientWaitSync(slot->fence, 0, 0) != GL_TIMEOUT_EXPIRED) {
+            //Staging is only reused once the copies out of it have finished
+            glDeleteSync(slot->fence);
+            //Resident before free, so the loader never sees a free slot that still needs loading
+            InterlockedExchange(&slot->resident, 1);
+            InterlockedExchange(&slot->state, S_FREE);
+            themes->staged = -1;
+            SetEvent(themes->signal);
+        }
+    }
+
+    int request = *themes->request;
+    if (request >= 0 && request < themeCount && request != themes->current) {
+        THEMESLOT* slot = &themes->slots[request];
+        if (slot->resident) {
+            themes->previous = themes->current;
+            themes->current = request;
+            themes->fade = 0.0f;
+            themes->wanted = -1;
+            std::cout << "Theme switched to " << themeTable[request].name << std::endl;
+        }else if (slot->state == T_ERROR) {
+            *themes->request = themes->current;
+        }else if (themes->wanted != request) {
+            themes->wanted = request;
+            while (slot->state == S_FREE && themes->residentBytes + slot->bytes > THEME_BUDGET) {
+                int oldest = -1;
+                for (int i = 0; i < themeCount; i++) {
+                    if (!themes->slots[i].resident || i == themes->current || i == themes->previous) continue;
+                    if (oldest < 0 || themes->slots[i].shown < themes->slots[oldest].shown) oldest = i;
+                }
+                if (oldest < 0) break;
+                evictTheme(themes, oldest);
+            }
+            SetEvent(themes->signal);
+        }
+    }
+    if (themes->fade < 1.0f) {
+        themes->fade += (float)(dt / THEME_FADE);
+        if (themes->fade >= 1.0f) {
+            themes->fade = 1.0f;
+            themes->previous = themes->current;
+        }
+    }
+    themes->slots[themes->current].shown = glfwGetTime();
+}
+
+#define Q_BANNER 0
+#define Q_OVERLAY 1
+#define Q_SLIDE 2
+#define Q_DOTS 3
+#define SLIDE_Y 0.7657407407f
+
+float quadVertices[4][20] = {
+    {
+        //POSITIONAL VERTICES       TEXTURE COORDS
+        -1.0f,  -1.0f,  -1.0f,      0.0f,   1.0f,   //0
+        -1.0f,  1.0f,   -1.0f,      0.0f,   0.0f,   //1
+        1.0f,   1.0f,   -1.0f,      1.0f,   0.0f,   //2
+        1.0f,   -1.0f,  -1.0f,      1.0f,   1.0f    //3
+    },
+    {
+        -1.0f,  -1.0f,  1.0f,       0.0f,   0.0f,   //0
+        -1.0f,  1.0f,   1.0f,       0.0f,   1.0f,   //1
+        1.0f,   1.0f,   1.0f,       1.0f,   1.0f,   //2
+        1.0f,   -1.0f,  1.0f,       1.0f,   0.0f    //3
+    },
+    {
+        -1.0f,  -SLIDE_Y, 0.0f,     0.0f,   0.0f,   //0
+        -1.0f,  SLIDE_Y,  0.0f,     0.0f,   1.0f,   //1
+        1.0f,   SLIDE_Y,  0.0f,     1.0f,   1.0f,   //2
+        1.0f,   -SLIDE_Y, 0.0f,     1.0f,   0.0f    //3
+    },
+    {
+        0.0f,   -1.0f,  0.0f,       0.0f,   0.0f,   //0
+        0.0f,   1.0f,   0.0f,       0.0f,   1.0f,   //1
+        2.0f,   1.0f,   0.0f,       1.0f,   1.0f,   //2
+        2.0f,   -1.0f,  0.0f,       1.0f,   0.0f    //3
+    }
+};
+unsigned int quadIndices[6] = {
+    1, 0, 2,
+    3, 2, 0
+};
+
+glm::mat4 dotRotation(double angle, int w, int h) {
+    glm::mat4 rotation = glm::rotate(glm::mat4(1.0), (float)angle, glm::vec3(0, 0, 1));
+    for (int i = 0; i < 4; i++) rotation[i][1] = rotation[i][1] * w / h;
+    return rotation;
+}
+
+/*Scenes. The lighting look is a packed block (three light colours plus the
+* shading constants) that light.fs reads from a uniform buffer holding the
+* block being left, the block being entered and the fade length; the shader
+* does the crossfade itself, so a transition costs one buffer upload when it
+* starts and a clock uniform each frame. Presets are named looks compiled to
+* a block once, when they are loaded or saved, so recalling one is a single
+* request to the render thread however much changes.
+*/
+typedef struct sceneBlock {
+    float red[4];
+    float green[4];
+    float blue[4];
+    float look[4]; //specular intensity, ambience, bloom threshold
+} SCENEBLOCK;
+
+//The first 144 bytes are the Scene uniform block, std140
+typedef struct scene {
+    SCENEBLOCK from;
+    SCENEBLOCK to;
+    float timing[4]; //fade length in seconds
+    double start;
+    double now;
+    int version;
+    int live; //Lights held by the console, one bit each
+    float liveLights[3][3];
+} SCENE;
+
+typedef struct preset {
+    char name[32];
+    char colors[3];
+    char flags;
+    int theme; //-1 leaves the theme alone
+    char venue[D_NAMESIZE];
+    float fade;
+    float look[4];
+    SCENEBLOCK block;
+} PRESET;
+
+PRESET presets[PRESET_MAX];
+int presetCount = 0;
+SRWLOCK presetLock = SRWLOCK_INIT;
+const float defaultLook[4] = { 1.5f, 0.1f, 0.9f, 0.0f };
+
+void compilePreset(PRESET* preset) {
+    float* lights[3] = { preset->block.red, preset->block.green, preset->block.blue };
+    for (int l = 0; l < 3; l++) {
+        for (int i = 0; i < 3; i++) lights[l][i] = colors[preset->colors[l] & 7][i];
+        lights[l][3] = 1.0f;
+    }
+    for (int i = 0; i < 4; i++) preset->block.look[i] = preset->look[i];
+}
+
+int findPreset(const char* name) {
+    for (int i = 0; i < presetCount; i++) if (_stricmp(name, presets[i].name) == 0) return i;
+    return -1;
+}
+
+void scenePosition(SCENE* scene, SCENEBLOCK* out) {
+    float t = scene->timing[0] > 0.0f ? (float)((scene->now - scene->start) / scene->timing[0]) : 1.0f;
+    if (t > 1.0f) t = 1.0f;
+    if (t < 0.0f) t = 0.0f;
+    t = t * t * (3.0f - 2.0f * t); //Matches the smoothstep in light.fs
+    float* a = (float*)&scene->from;
+    float* b = (float*)&scene->to;
+    float* o = (float*)out;
+    for (int i = 0; i < 16; i++) o[i] = a[i] + (b[i] - a[i]) * t;
+}
+
+//Starts a crossfade from wherever the current one has got to
+void sceneTo(SCENE* scene, SCENEBLOCK* to, float fade) {
+    SCENEBLOCK at;
+    scenePosition(scene, &at);
+    scene->from = at;
+    scene->to = *to;
+    scene->timing[0] = fade;
+    scene->start = scene->now;
+    scene->version++;
+}
+
+//Render thread side; the block goes over in one piece, so nothing is seen half-applied
+void startScene(SCENE* scene) {
+    *scene = {};
+    for (int i = 0; i < 4; i++) scene->to.look[i] = defaultLook[i];
+    scene->from = scene->to;
+}
+
+//The lights a stage's data asks for: dark in the slideshow, else the console's or the chosen colours
+void sceneLights(SCENE* scene, char* data, SCENEBLOCK* target) {
+    float* lights[3] = { target->red, target->green, target->blue };
+    int slideshow = readFlags(data + D_FLAGS, F_SLIDESHOW_MODE) != 0;
+    for (int l = 0; l < 3; l++) for (int i = 0; i < 3; i++) {
+        if (slideshow) lights[l][i] = 0.0f;
+        else lights[l][i] = scene->live & (1 << l) ? scene->liveLights[l][i] : colors[data[D_COLOR1 + l]][i];
+    }
+}
+
+//The lights come from the data the preset has just written, so buildFrame
+//finds nothing left to change and the whole recall runs on the preset's fade
+void applyPreset(PRESET* preset, TDATA* threadData, INSTANCE* instance, SCENE* scene) {
+    for (int l = 0; l < 3; l++) threadData->data[D_COLOR1 + l] = preset->colors[l];
+    writeFlags(threadData->data + D_FLAGS, PRESET_FLAGS, preset->flags);
+    if (preset->venue[0] != '\0') sprintf_s(threadData->data + D_VENUENAME, D_NAMESIZE, "%s", preset->venue);
+    if (preset->theme >= 0) instance->themeRequest = preset->theme;
+    SCENEBLOCK target = preset->block;
+    sceneLights(scene, threadData->data, &target);
+    sceneTo(scene, &target, preset->fade);
+}
+
+void jsonEscape(const char* in, char* out, int size) {
+    int n = 0;
+    for (; *in && n + 2 < size; in++) {
+        if (*in == '"' || *in == '\\') out[n++] = '\\';
+        out[n++] = *in == '\n' ? ' ' : *in;
+    }
+    out[n] = '\0';
+}
+
+int savePresets() {
+    std::ofstream file(PRESET_FILE, std::ios::trunc);
+    if (!file.is_open()) return -1;
+    file << "[" << std::endl;
+    for (int i = 0; i < presetCount; i++) {
+        PRESET* p = &presets[i];
+        char name[64], venue[2 * D_NAMESIZE], line[1024];
+        jsonEscape(p->name, name, sizeof(name));
+        jsonEscape(p->venue, venue, sizeof(venue));
+        sprintf_s(line, "    {\"name\":\"%s\",\"color1\":%d,\"color2\":%d,\"color3\":%d,\"slideshow\":%d,\"baselight\":%d,\"metaposts\":%d,"
+            "\"theme\":\"%s\",\"venue\":\"%s\",\"fade\":%.2f,\"specular\":%.3f,\"ambience\":%.3f,\"threshold\":%.3f}%s",
+            name, p->colors[0], p->colors[1], p->colors[2],
+            !!(p->flags & F_SLIDESHOW_MODE), !!(p->flags & F_BASELIGHT), !!(p->flags & F_METAPOSTS),
+            p->theme >= 0 ? themeTable[p->theme].name : "", venue, p->fade, p->look[0], p->look[1], p->look[2],
+            i + 1 < presetCount ? "," : "");
+        file << line << std::endl;
+    }
+    file << "]" << std::endl;
+    return 0;
+}
+
+void loadPresets() {
+    std::streamsize size;
+    char* json = readFile(PRESET_FILE, &size);
+    if (json == NULL) return;
+    const char* end = json + size - 1;
+    const char* object;
+    char value[D_NAMESIZE];
+    for (const char* close = jsonObject(json, end, &object); close != NULL && presetCount < PRESET_MAX; close = jsonObject(close + 1, end, &object)) {
+        PRESET* p = &presets[presetCount];
+        *p = {};
+        if (!jsonField(object, close, "name", p->name, sizeof(p->name))) continue;
+        const char* colorKeys[3] = { "color1", "color2", "color3" };
+        for (int l = 0; l < 3; l++) p->colors[l] = jsonField(object, close, colorKeys[l], value, sizeof(value)) ? atoi(value) & 7 : l + 1;
+        const char* flagKeys[3] = { "slideshow", "baselight", "metaposts" };
+        const char flagBits[3] = { F_SLIDESHOW_MODE, F_BASELIGHT, F_METAPOSTS };
+        for (int f = 0; f < 3; f++) if (jsonField(object, close, flagKeys[f], value, sizeof(value)) && atoi(value)) p->flags |= flagBits[f];
+        p->theme = jsonField(object, close, "theme", value, sizeof(value)) ? findTheme(value) : -1;
+        jsonField(object, close, "venue", p->venue, sizeof(p->venue));
+        p->fade = jsonField(object, close, "fade", value, sizeof(value)) ? (float)atof(value) : SCENE_FADE;
+        const char* lookKeys[3] = { "specular", "ambience", "threshold" };
+        for (int i = 0; i < 4; i++) p->look[i] = defaultLook[i];
+        for (int i = 0; i < 3; i++) if (jsonField(object, close, lookKeys[i], value, sizeof(value))) p->look[i] = (float)atof(value);
+        compilePreset(p);
+        presetCount++;
+    }
+    HeapFree(GetProcessHeap(), 0, json);
+    std::cout << "Loaded " << presetCount << " presets." << std::endl;
+}
+
+//Captures a stage's current look under [name], replacing a preset of the same name
+int capturePreset(const char* name, INSTANCE* instance) {
+    AcquireSRWLockExclusive(&presetLock);
+    int index = findPreset(name);
+    if (index < 0 && presetCount < PRESET_MAX) index = presetCount++;
+    if (index < 0) {
+        ReleaseSRWLockExclusive(&presetLock);
+        return -1;
+    }
+    PRESET* p = &presets[index];
+    float look[4];
+    for (int i = 0; i < 4; i++) look[i] = instance->preset >= 0 ? presets[instance->preset].look[i] : defaultLook[i];
+    *p = {};
+    sprintf_s(p->name, "%s", name);
+    for (int l = 0; l < 3; l++) p->colors[l] = instance->glData->data[D_COLOR1 + l];
+    p->flags = instance->glData->data[D_FLAGS] & PRESET_FLAGS;
+    p->theme = instance->themeRequest;
+    sprintf_s(p->venue, "%s", instance->glData->data + D_VENUENAME);
+    p->fade = SCENE_FADE;
+    for (int i = 0; i < 4; i++) p->look[i] = look[i];
+    compilePreset(p);
+    instance->preset = index;
+    int result = savePresets();
+    ReleaseSRWLockExclusive(&presetLock);
+    if (result) errorCallback(-1, "Unable to write " PRESET_FILE "!");
+    return index;
+}
+
+/*Everything a backend needs to draw one frame. GLmain fills this in from the
+* thread data and the animation state, then hands it to the active renderer.
+*/
+typedef struct frameState {
+    int width;
+    int height;
+    int slideshow;
+    int metaposts;
+    double dt;
+    float rl[3];
+    float gl[3];
+    float bl[3];
+    float wl[3];
+    float rc[3];
+    float gc[3];
+    float bc[3];
+    int slide;
+    int nextSlide;
+    float slideTransition;
+    float dotOffset;
+    char clock[32];
+    char showtime[32];
+    char* venue;
+    SCENE* scene;
+    int hud;
+    int timing; //Per-pass GPU timing without the HUD
+    float cpuMs;
+} FRAME;
+
+typedef struct renderer {
+    const char* name;
+    void* data;
+    int (*init)(void* data, GLFWwindow* window, int width, int height);
+    void (*draw)(void* data, FRAME* frame);
+    void (*present)(void* data, GLFWwindow* window);
+} RENDERER;
+
+const char* passNames[PASS_COUNT] = {
+    "light",
+    "bloom",
+    "assembly",
+    "dots",
+    "slides",
+    "overlay",
+    "text",
+    "wall",
+    "plugins"
+};
+
+/*Animation state for one banner: light positions, the slideshow's current
+* slide and transition, and the phase they are all driven from. GLmain steps
+* it on the wall clock; export and the bench step it on a fixed one, so the
+* same frame count always lands on the same picture.
+*/
+typedef struct animation {
+    float rl[3];
+    float gl[3];
+    float bl[3];
+    float wl[3];
+    double phase;
+    float slideTransition;
+    unsigned int slideID;
+    unsigned int frameCount;
+} ANIMATION;
+
+void startAnimation(ANIMATION* anim) {
+    float start[4][3] = { { 5.0f, 1.5f, -0.1f }, { -5.0f, 1.5f, -0.1f }, { 0.0f, 1.5f, -0.1f }, { 0.0f, -2.0f, -0.1f } };
+    *anim = {};
+    for (int i = 0; i < 3; i++) {
+        anim->rl[i] = start[0][i];
+        anim->gl[i] = start[1][i];
+        anim->bl[i] = start[2][i];
+        anim->wl[i] = start[3][i];
+    }
+}
+
+/*Fills in everything but hud and cpuMs from a stage's thread data (see the
+* map in GLmain). [now] is the time of day shown in the slideshow.
+*/
+void buildFrame(FRAME* frame, ANIMATION* anim, char* data, SCENE* scene, unsigned int slideCount, double dt, std::time_t now) {
+    char* FLAGS = data + D_FLAGS;
+    int* SHOWTIME = (int*)(data + D_DOWNBEAT);
+    frame->slideshow = readFlags(FLAGS, F_SLIDESHOW_MODE) != 0;
+    frame->metaposts = readFlags(FLAGS, F_METAPOSTS) != 0;
+    frame->dt = dt;
+    scene->now += frame->dt;
+    //A single colour or mode change fades the lights on its own
+    SCENEBLOCK target = scene->to;
+    sceneLights(scene, data, &target);
+    //A console does its own fades
+    if (memcmp(&target, &scene->to, sizeof(target)) != 0) sceneTo(scene, &target, scene->live ? 0.0f : SCENE_FADE);
+    //Only the GL backend fades on the GPU; the others get this frame's colours
+    SCENEBLOCK at;
+    scenePosition(scene, &at);
+    frame->scene = scene;
+    for (int i = 0; i < 3; i++) {
+        frame->rl[i] = anim->rl[i];
+        frame->gl[i] = anim->gl[i];
+        frame->bl[i] = anim->bl[i];
+        frame->wl[i] = anim->wl[i];
+        frame->rc[i] = at.red[i];
+        frame->gc[i] = at.green[i];
+        frame->bc[i] = at.blue[i];
+    }
+    frame->slide = anim->slideID;
+    frame->nextSlide = anim->slideID + 1;
+    if (frame->nextSlide >= slideCount) frame->nextSlide = 0;
+    frame->slideTransition = anim->slideTransition;
+    frame->dotOffset = (float)0x3p-13 * anim->frameCount;
+    frame->venue = data + D_VENUENAME;
+
+    if (!frame->slideshow) {
+        anim->slideTransition = 0;
+        return;
+    }
+    std::tm t;
+    localtime_s(&t, &now);
+    int hr = t.tm_hour;
+    int mn = t.tm_min;
+    char pm = 'A';
+    if (hr >= 12) {
+        hr -= 12;
+        pm = 'P';
+    }
+    if (hr == 0) hr = 12;
+    sprintf_s(frame->clock, "Current time: %d%d:%d%d %cM", hr/10, hr%10, mn/10, mn%10, pm);
+
+    hr = *SHOWTIME / 60;
+    mn = *SHOWTIME % 60;
+    if (readFlags(FLAGS, F_AUTOSTART) && hr == t.tm_hour && mn == t.tm_min) writeFlags(FLAGS, F_SLIDESHOW_MODE, 0);
+    pm = 'A';
+    if (hr >= 12) {
+        hr -= 12;
+        pm = 'P';
+    }
+    if (hr == 0) hr = 12;
+    sprintf_s(frame->showtime, "Showtime: %d%d:%d%d %cM", hr / 10, hr % 10, mn / 10, mn % 10, pm);
+}
+
+//Steps the animation past the frame just drawn, which took [timeSpan] seconds
+void advanceAnimation(ANIMATION* anim, int slideshow, unsigned int slideCount, double timeSpan) {
+    if (slideshow) {
+        if ((anim->frameCount & 1023) == 0) anim->phase = 0;
+        if (anim->phase < PI) {
+            anim->phase += 0.03125;
+            anim->slideTransition = -cos(anim->phase)+1;
+            if (anim->phase >= PI) {
+                anim->phase = PI;
+                anim->slideTransition = 0;
+                anim->slideID++;
+                if (anim->slideID >= slideCount) anim->slideID = 0;
+            }
+        }
+    }
+    anim->frameCount++;
+    double phase = anim->phase;
+    anim->rl[0] = 6 * sin(phase);
+    anim->gl[0] = 6 * sin(phase + 2 * PI / 3);
+    anim->bl[0] = 6 * sin(phase - 2 * PI / 3);
+    anim->rl[1] = 1.5f + fabs(cos(phase));
+    anim->gl[1] = 1.5f + fabs(cos(phase + 2 * PI / 3));
+    anim->bl[1] = 1.5f + fabs(cos(phase - 2 * PI / 3));
+    anim->phase += timeSpan/5;
+}
+
+/*GL debug output, on with -gldebug. Messages are folded into a fixed table
+* keyed by id, source, type, severity and the pass that raised them, so the
+* callback only claims a slot and bumps a counter; the first message text is
+* kept for the DEBUG command. Output is synchronous, which is what lets a
+* message be pinned on the pass that was running. Without -gldebug none of
+* this is installed and the passes skip their debug groups.
+*/
+typedef struct glDebugEntry {
+    volatile LONG64 key;
+    volatile LONG count;
+    volatile LONG ready;
+    GLenum source;
+    GLenum type;
+    GLenum severity;
+    GLuint id;
+    int pass;
+    char text[GLDEBUG_TEXT];
+} GLDEBUGENTRY;
+
+GLDEBUGENTRY glDebugLog[GLDEBUG_SLOTS];
+int glDebug = 0;
+
+void APIENTRY glDebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam) {
+    int pass = userParam != NULL ? *(const int*)userParam : -1;
+    LONG64 key = ((LONG64)id << 32) | ((source & 0xFF) << 24) | ((type & 0xFF) << 16) | ((severity & 0xFF) << 8) | ((pass + 1) & 0xFF);
+    unsigned int hash = (unsigned int)(key ^ (key >> 32)) * 2654435761u;
+    for (int probe = 0; probe < GLDEBUG_SLOTS; probe++) {
+        GLDEBUGENTRY* entry = &glDebugLog[(hash + probe) % GLDEBUG_SLOTS];
+        LONG64 seen = entry->key;
+        if (seen == 0) seen = InterlockedCompareExchange64(&entry->key, key, 0);
+        if (seen != 0 && seen != key) continue;
+        if (seen == 0) {
+            entry->source = source;
+            entry->type = type;
+            entry->severity = severity;
+            entry->id = id;
+            entry->pass = pass;
+            int n = length < 0 || length >= GLDEBUG_TEXT ? GLDEBUG_TEXT - 1 : length;
+            for (int i = 0; i < n && message[i] != 0; i++) entry->text[i] = message[i];
+            InterlockedExchange(&entry->ready, 1);
+        }
+        InterlockedIncrement(&entry->count);
+        InterlockedIncrement(&metrics.glMessages);
+        if (type == GL_DEBUG_TYPE_ERROR || severity == GL_DEBUG_SEVERITY_HIGH) InterlockedIncrement(&metrics.glErrors);
+        if (type == GL_DEBUG_TYPE_PERFORMANCE) InterlockedIncrement(&metrics.glPerformance);
+        return;
+    }
+    InterlockedIncrement(&metrics.glDropped);
+}
+
+void glDebugInit(int* pass) {
+    *pass = -1;
+    if (!glDebug) return;
+    if (!GLAD_GL_VERSION_4_3) {
+        std::cout << "GL debug output needs GL 4.3; checking glGetError once a frame instead." << std::endl;
+        return;
+    }
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDebugMessageCallback(glDebugCallback, pass);
+    //Our own group markers would otherwise be most of the log
+    glDebugMessageControl(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_PUSH_GROUP, GL_DONT_CARE, 0, NULL, GL_FALSE);
+    glDebugMessageControl(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_POP_GROUP, GL_DONT_CARE, 0, NULL, GL_FALSE);
+}
+
+//Only used when the context has no debug output; errors are still pinned on the frame
+void glDebugFrame(int* pass) {
+    if (!glDebug || GLAD_GL_VERSION_4_3) return;
+    GLenum error;
+    for (int i = 0; i < 8 && (error = glGetError()) != GL_NO_ERROR; i++) {
+        glDebugCallback(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, error, GL_DEBUG_SEVERITY_HIGH, -1, "glGetError", pass);
+    }
+}
+
+const char* glDebugName(GLenum value) {
+    switch (value) {
+    case GL_DEBUG_SOURCE_API: return "api";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER: return "compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY: return "driver";
+    case GL_DEBUG_SOURCE_APPLICATION: return "app";
+    case GL_DEBUG_TYPE_ERROR: return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined";
+    case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+    case GL_DEBUG_TYPE_MARKER: return "marker";
+    case GL_DEBUG_SEVERITY_HIGH: return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+    case GL_DEBUG_SEVERITY_LOW: return "low";
+    case GL_DEBUG_SEVERITY_NOTIFICATION: return "note";
+    }
+    return "other";
+}
+
+/*Social wall. A worker polls the feed (a JSON file, or a URL on the local
+* network), lays each new post out as a WALL_CARD_W x WALL_CARD_H card on the
+* CPU and leaves it in a staging slot. The render thread copies at most one
+* staged card a frame into a cell of the card atlas and otherwise just scrolls
+* quads along the bottom of the slideshow, so a burst of posts mid-show is
+* spread over as many frames as it takes. Each staging slot is its own pixel
+* unpack buffer that the worker bakes straight into: persistently mapped on
+* GL 4.4, otherwise mapped by the render thread while the slot is free and
+* unmapped just before its upload, so no card is copied on the render thread.
+*
+* The feed is an array of flat objects; anything with a "text" field is a
+* post, e.g. [{"id":"17","author":"@nnb","text":"...","image":"/images/a.png"}].
+* "id" is optional, posts without one are told apart by author and text.
+*/
+typedef struct wallPost {
+    char author[64];
+    char text[320];
+    char image[MAX_PATH];
+} WALLPOST;
+
+typedef struct wallStage {
+    volatile LONG state;
+    LONG64 seq;
+    GLsync fence;
+    unsigned int pbo;
+    unsigned char* pixels; //NULL while unmapped
+} WALLSTAGE;
+
+typedef struct wallCard {
+    LONG64 seq;
+    int shown;
+} WALLCARD;
+
+typedef struct wallData {
+    unsigned int atlas;
+    int persistent;
+    unsigned int VBO, VAO;
+    WALLSTAGE stage[WALL_STAGING];
+    WALLCARD cards[WALL_CARDS];
+    int ticker[WALL_VISIBLE];
+    float tickerX[WALL_VISIBLE];
+    int tickerCount;
+    LONG64 lastShown;
+    LONG64 landed; //seq of the newest card in the atlas
+    float cardW, cardH;
+    //Worker side
+    WALLPOST pending[WALL_PENDING];
+    int pendingCount;
+    unsigned int seen[WALL_SEEN];
+    int seenCount;
+    LONG64 seq;
+    FILETIME modified;
+    HANDLE signal;
+    HANDLE thread;
+    volatile LONG running;
+} WALL;
+
+const size_t cardBytes = (size_t)WALL_CARD_W * WALL_CARD_H * 4;
+
+//Queues every post the wall hasn't seen yet; returns how many were added
+int parseFeed(WALL* wall, const char* json, const char* end) {
+    int added = 0;
+    const char* object;
+    for (const char* close = jsonObject(json, end, &object); close != NULL; close = jsonObject(close + 1, end, &object)) {
+        if (wall->pendingCount >= WALL_PENDING) break; //The rest are picked up on the next poll
+        WALLPOST* post = &wall->pending[wall->pendingCount];
+        if (!jsonField(object, close, "text", post->text, sizeof(post->text))) continue;
+        jsonField(object, close, "author", post->author, sizeof(post->author));
+        jsonField(object, close, "image", post->image, sizeof(post->image));
+        char id[64];
+        unsigned int hash;
+        if (jsonField(object, close, "id", id, sizeof(id))) hash = fnv1a(id, 2166136261u);
+        else hash = fnv1a(post->text, fnv1a(post->author, 2166136261u));
+        int known = 0;
+        for (int i = 0; i < wall->seenCount && i < WALL_SEEN && !known; i++) known = wall->seen[i] == hash;
+        if (known) continue;
+        wall->seen[wall->seenCount++ % WALL_SEEN] = hash;
+        wall->pendingCount++;
+        added++;
+    }
+    return added;
+}
+
+void pollFeed(WALL* wall) {
+    char* json = NULL;
+    size_t size = 0;
+    if (isUrl(wallFeed)) json = fetchUrl(wallFeed, &size);
+    else {
+        WIN32_FILE_ATTRIBUTE_DATA info;
+        if (!GetFileAttributesExA(wallFeed, GetFileExInfoStandard, &info)) return;
+        if (CompareFileTime(&info.ftLastWriteTime, &wall->modified) == 0) return;
+        wall->modified = info.ftLastWriteTime;
+        std::streamsize length;
+        json = readFile(wallFeed, &length);
+        if (json != NULL) size = (size_t)length - 1;
+    }
+    if (json == NULL) return;
+    int added = parseFeed(wall, json, json + size);
+    if (added > 0) std::cout << "Social wall: " << added << " new posts." << std::endl;
+    HeapFree(GetProcessHeap(), 0, json);
+}
+
+void cardBlend(unsigned char* card, int x, int y, const unsigned char* color, int alpha) {
+    if (x < 0 || y < 0 || x >= WALL_CARD_W || y >= WALL_CARD_H || alpha <= 0) return;
+    unsigned char* px = card + ((size_t)y * WALL_CARD_W + x) * 4;
+    if (px[3] == 0) return; //Outside the rounded corners
+    for (int i = 0; i < 3; i++) px[i] = (unsigned char)(px[i] + (color[i] - px[i]) * alpha / 255);
+}
+
+void cardBackground(unsigned char* card) {
+    const int radius = 20;
+    for (int y = 0; y < WALL_CARD_H; y++) {
+        for (int x = 0; x < WALL_CARD_W; x++) {
+            unsigned char* px = card + ((size_t)y * WALL_CARD_W + x) * 4;
+            int dx = x < radius ? radius - x : x >= WALL_CARD_W - radius ? x - (WALL_CARD_W - radius - 1) : 0;
+            int dy = y < radius ? radius - y : y >= WALL_CARD_H - radius ? y - (WALL_CARD_H - radius - 1) : 0;
+            int inside = dx * dx + dy * dy <= radius * radius;
+            //Darker toward the bottom so the body text keeps its contrast
+            px[0] = (unsigned char)(28 - y / 24);
+            px[1] = (unsigned char)(24 - y / 24);
+            px[2] = (unsigned char)(40 - y / 16);
+            px[3] = inside ? 255 : 0;
+        }
+    }
+}
+
+//Centre-crops the image to a square and box-filters it down into the card
+void cardThumbnail(unsigned char* card, const char* image, int x0, int y0, int size) {
+    int w, h, c;
+    unsigned char* pixels = NULL;
+    if (isUrl(image)) {
+        size_t length;
+        char* data = fetchUrl(image, &length);
+        if (data == NULL) return;
+        pixels = stbi_load_from_memory((unsigned char*)data, (int)length, &w, &h, &c, 4);
+        HeapFree(GetProcessHeap(), 0, data);
+    }else {
+        char path[MAX_PATH];
+        //Site-relative paths are served from ./http
+        sprintf_s(path, "%s%s", image[0] == '/' ? "./http" : "", image);
+        pixels = stbi_load(path, &w, &h, &c, 4);
+    }
+    if (pixels == NULL) return;
+    int side = w < h ? w : h;
+    int sx = (w - side) / 2, sy = (h - side) / 2;
+    for (int y = 0; y < size; y++) {
+        int ya = sy + y * side / size, yb = sy + (y + 1) * side / size;
+        if (yb <= ya) yb = ya + 1;
+        for (int x = 0; x < size; x++) {
+            int xa = sx + x * side / size, xb = sx + (x + 1) * side / size;
+            if (xb <= xa) xb = xa + 1;
+            unsigned int sum[4] = {};
+            for (int v = ya; v < yb; v++) for (int u = xa; u < xb; u++) for (int i = 0; i < 4; i++) sum[i] += pixels[((size_t)v * w + u) * 4 + i];
+            unsigned int count = (xb - xa) * (yb - ya);
+            unsigned char color[3] = { (unsigned char)(sum[0] / count), (unsigned char)(sum[1] / count), (unsigned char)(sum[2] / count) };
+            cardBlend(card, x0 + x, y0 + y, color, sum[3] / count);
+        }
+    }
+    stbi_image_free(pixels);
+}
+
+int cardGlyph(FT_Face face, unsigned int cp, int render) {
+    return FT_Load_Char(face, cp, render ? FT_LOAD_RENDER : FT_LOAD_DEFAULT) == 0;
+}
+
+//Word-wrapped text between x0 and x1; returns the number of lines used
+int cardText(unsigned char* card, FT_Face face, const char* text, int x0, int x1, int y, int lineHeight, int maxLines, const unsigned char* color) {
+    int pen = x0, line = 0;
+    const char* p = text;
+    while (*p && line < maxLines) {
+        if (*p == '\n' || *p == ' ') {
+            if (*p == '\n') {
+                pen = x0;
+                line++;
+            }else if (pen > x0 && cardGlyph(face, ' ', 0)) pen += face->glyph->advance.x >> 6;
+            p++;
+            continue;
+        }
+        //Measure the word so it can move to the next line whole
+        int width = 0;
+        const char* q = p;
+        while (*q && *q != ' ' && *q != '\n') if (cardGlyph(face, utf8Decode(&q), 0)) width += face->glyph->advance.x >> 6;
+        int full = pen > x0 && pen + width > x1 && line + 1 >= maxLines;
+        if (!full && pen > x0 && pen + width > x1) {
+            pen = x0;
+            line++;
+        }
+        while (!full && p < q) {
+            const char* next = p;
+            unsigned int cp = utf8Decode(&next);
+            if (!cardGlyph(face, cp, 1)) {
+                p = next;
+                continue;
+            }
+            FT_GlyphSlot g = face->glyph;
+            int advance = g->advance.x >> 6;
+            if (pen + advance > x1) {
+                full = line + 1 >= maxLines;
+                if (!full) {
+                    pen = x0;
+                    line++;
+                }
+                continue;
+            }
+            int baseline = y + line * lineHeight;
+            for (unsigned int r = 0; r < g->bitmap.rows; r++) {
+                for (unsigned int c = 0; c < g->bitmap.width; c++) {
+                    cardBlend(card, pen + g->bitmap_left + c, baseline - g->bitmap_top + r, color, g->bitmap.buffer[r * g->bitmap.pitch + c]);
+                }
+            }
+            pen += advance;
+            p = next;
+        }
+        if (full) {
+            //Out of room: finish the card on an ellipsis
+            cardText(card, face, "...", pen, x1 + 40, y + line * lineHeight, lineHeight, 1, color);
+            return maxLines;
+        }
+    }
+    return line + 1;
+}
+
+void bakeCard(WALLPOST* post, unsigned char* card, FT_Face face) {
+    const unsigned char yellow[3] = { 249, 236, 91 };
+    const unsigned char white[3] = { 240, 240, 240 };
+    const int pad = 16;
+    const int thumb = WALL_CARD_H - 2 * pad;
+    cardBackground(card);
+    int textX = pad;
+    if (post->image[0] != '\0') {
+        cardThumbnail(card, post->image, pad, pad, thumb);
+        textX = 2 * pad + thumb;
+    }
+    int top = pad;
+    if (post->author[0] != '\0') {
+        FT_Set_Pixel_Sizes(face, 0, 30);
+        cardText(card, face, post->author, textX, WALL_CARD_W - pad, top + 28, 34, 1, yellow);
+        top += 42;
+    }
+    FT_Set_Pixel_Sizes(face, 0, 24);
+    cardText(card, face, post->text, textX, WALL_CARD_W - pad, top + 24, 29, (WALL_CARD_H - pad - top) / 29, white);
+}
+
+DWORD WINAPI WallBaker(LPVOID lpParam) {
+    WALL* wall = (WALL*)lpParam;
+    //A card can wait a frame; the frame can't wait for a card
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+    FT_Library ft;
+    FT_Face face;
+    if (FT_Init_FreeType(&ft) || FT_New_Face(ft, "./fonts/Times New Roman Bold.ttf", 0, &face)) {
+        errorCallback(-1, "Social wall couldn't load its font!");
+        return -1;
+    }
+    DWORD lastPoll = 0;
+    int baked = 0;
+    while (wall->running) {
+        if (wall->pendingCount == 0 && GetTickCount() - lastPoll >= WALL_POLL) {
+            lastPoll = GetTickCount();
+            pollFeed(wall);
+        }
+        WALLSTAGE* stage = NULL;
+        for (int i = 0; i < WALL_STAGING && stage == NULL; i++) if (wall->stage[i].state == S_FREE) stage = &wall->stage[i];
+        if (baked >= wall->pendingCount || stage == NULL) {
+            if (baked >= wall->pendingCount) wall->pendingCount = baked = 0;
+            WaitForSingleObject(wall->signal, 10);
+            continue;
+        }
+        double started = glfwGetTime();
+        bakeCard(&wall->pending[baked++], stage->pixels, face);
+        stage->seq = ++wall->seq;
+        InterlockedExchange(&stage->state, S_READY);
+        metrics.wallBakeMs = (float)((glfwGetTime() - started) * 1000);
+        InterlockedIncrement(&metrics.wallPosts);
+    }
+    FT_Done_Face(face);
+    FT_Done_FreeType(ft);
+    return 0;
+}
+
+int openWall(WALL* wall) {
+    gpuCreate(GPU_TEXTURE, 1, &wall->atlas, "wall");
+    glBindTexture(GL_TEXTURE_2D, wall->atlas);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, WALL_CARD_W * WALL_COLUMNS, WALL_CARD_H * (WALL_CARDS / WALL_COLUMNS), 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    gpuStorage(GPU_TEXTURE, wall->atlas, GL_RGBA8, gpuTextureBytes(GL_RGBA8, WALL_CARD_W * WALL_COLUMNS, WALL_CARD_H * (WALL_CARDS / WALL_COLUMNS), 0));
+
+    wall->persistent = GLAD_GL_VERSION_4_4;
+    for (int i = 0; i < WALL_STAGING; i++) {
+        WALLSTAGE* stage = &wall->stage[i];
+        gpuCreate(GPU_BUFFER, 1, &stage->pbo, "wall");
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stage->pbo);
+        gpuStorage(GPU_BUFFER, stage->pbo, 0, cardBytes);
+        if (wall->persistent) {
+            GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_PIXEL_UNPACK_BUFFER, cardBytes, NULL, access);
+            stage->pixels = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, cardBytes, access);
+        }else {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, cardBytes, NULL, GL_STREAM_DRAW);
+            stage->pixels = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, cardBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        }
+        if (stage->pixels == NULL) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            return -1;
+        }
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    gpuCreate(GPU_BUFFER, 1, &wall->VBO, "wall");
+    gpuCreate(GPU_VERTEXARRAY, 1, &wall->VAO, "wall");
+    glBindVertexArray(wall->VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, wall->VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 30 * WALL_VISIBLE, NULL, GL_DYNAMIC_DRAW);
+    gpuStorage(GPU_BUFFER, wall->VBO, 0, sizeof(float) * 30 * WALL_VISIBLE);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    wall->signal = CreateEventA(NULL, FALSE, FALSE, NULL);
+    wall->running = 1;
+    DWORD bakerID;
+    wall->thread = CreateThread(NULL, 0, WallBaker, wall, 0, &bakerID);
+    return 0;
+}
+
+int wallOnTicker(WALL* wall, int card) {
+    for (int i = 0; i < wall->tickerCount; i++) if (wall->ticker[i] == card) return 1;
+    return 0;
+}
+
+//Fresh cards go on first, oldest first, then the wall cycles through the rest in order
+int nextWallCard(WALL* wall) {
+    int next = -1;
+    for (int i = 0; i < WALL_CARDS; i++) {
+        WALLCARD* card = &wall->cards[i];
+        if (card->seq == 0 || card->shown || wallOnTicker(wall, i)) continue;
+        if (next < 0 || card->seq < wall->cards[next].seq) next = i;
+    }
+    if (next >= 0) return next;
+    int wrap = -1;
+    for (int i = 0; i < WALL_CARDS; i++) {
+        WALLCARD* card = &wall->cards[i];
+        if (card->seq == 0 || wallOnTicker(wall, i)) continue;
+        if (card->seq > wall->lastShown && (next < 0 || card->seq < wall->cards[next].seq)) next = i;
+        if (wrap < 0 || card->seq < wall->cards[wrap].seq) wrap = i;
+    }
+    return next >= 0 ? next : wrap;
+}
+
+//Called once a frame by the GL backend, in either mode, so baked cards keep landing during the banner
+void wallFrame(WALL* wall, FRAME* frame, int visible) {
+    for (int i = 0; i < WALL_STAGING; i++) {
+        WALLSTAGE* stage = &wall->stage[i];
+        if (stage->state != S_UPLOADING) continue;
+        if (stage->fence != NULL) {
+            if (glClientWaitSync(stage->fence, 0, 0) == GL_TIMEOUT_EXPIRED) continue;
+            glDeleteSync(stage->fence);
+            stage->fence = NULL;
+        }
+        //The upload has landed, so orphaning the old storage costs nothing; a failed map is tried again next frame
+        if (stage->pixels == NULL) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stage->pbo);
+            stage->pixels = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, cardBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            if (stage->pixels == NULL) continue;
+        }
+        InterlockedExchange(&stage->state, S_FREE);
+        SetEvent(wall->signal);
+    }
+
+    WALLSTAGE* ready = NULL;
+    for (int i = 0; i < WALL_STAGING; i++) {
+        if (wall->stage[i].state == S_READY && (ready == NULL || wall->stage[i].seq < ready->seq)) ready = &wall->stage[i];
+    }
+    if (ready != NULL) {
+        //An empty cell, or else the oldest card that isn't on screen
+        int cell = -1;
+        for (int i = 0; i < WALL_CARDS && cell < 0; i++) if (wall->cards[i].seq == 0) cell = i;
+        for (int i = 0; i < WALL_CARDS && wall->cards[WALL_CARDS - 1].seq != 0; i++) {
+            if (wallOnTicker(wall, i)) continue;
+            if (cell < 0 || wall->cards[i].seq < wall->cards[cell].seq) cell = i;
+        }
+        if (cell >= 0) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ready->pbo);
+            if (!wall->persistent) {
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                ready->pixels = NULL;
+            }
+            glBindTexture(GL_TEXTURE_2D, wall->atlas);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, (cell % WALL_COLUMNS) * WALL_CARD_W, (cell / WALL_COLUMNS) * WALL_CARD_H,
+                WALL_CARD_W, WALL_CARD_H, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            ready->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            wall->landed = ready->seq;
+            wall->cards[cell].seq = ready->seq;
+            wall->cards[cell].shown = 0;
+            InterlockedExchange(&ready->state, S_UPLOADING);
+        }
+    }
+
+    if (!visible) {
+        wall->tickerCount = 0;
+        return;
+    }
+    float scale = frame->width / 1920.0f;
+    wall->cardW = WALL_CARD_W * 0.75f * scale;
+    wall->cardH = WALL_CARD_H * 0.75f * scale;
+    float gap = 24.0f * scale;
+    for (int i = 0; i < wall->tickerCount; i++) wall->tickerX[i] -= (float)(WALL_SPEED * scale * frame->dt);
+    while (wall->tickerCount > 0 && wall->tickerX[0] + wall->cardW < 0) {
+        wall->tickerCount--;
+        for (int i = 0; i < wall->tickerCount; i++) {
+            wall->ticker[i] = wall->ticker[i + 1];
+            wall->tickerX[i] = wall->tickerX[i + 1];
+        }
+    }
+    while (wall->tickerCount < WALL_VISIBLE) {
+        float x = wall->tickerCount == 0 ? (float)frame->width : wall->tickerX[wall->tickerCount - 1] + wall->cardW + gap;
+        if (x > frame->width) break;
+        int card = nextWallCard(wall);
+        if (card < 0) break;
+        wall->cards[card].shown = 1;
+        wall->lastShown = wall->cards[card].seq;
+        wall->ticker[wall->tickerCount] = card;
+        wall->tickerX[wall->tickerCount++] = x;
+    }
+}
+
+void closeWall(WALL* wall) {
+    wall->running = 0;
+    if (wall->thread != NULL) {
+        WaitForSingleObject(wall->thread, INFINITE);
+        CloseHandle(wall->thread);
+        CloseHandle(wall->signal);
+    }
+    //Deleting a buffer unmaps it
+    for (int i = 0; i < WALL_STAGING; i++) {
+        WALLSTAGE* stage = &wall->stage[i];
+        if (stage->fence != NULL) glDeleteSync(stage->fence);
+        if (stage->pbo != 0) gpuDelete(GPU_BUFFER, 1, &stage->pbo);
+        stage->fence = NULL;
+        stage->pixels = NULL;
+    }
+    gpuDelete(GPU_TEXTURE, 1, &wall->atlas);
+    gpuDelete(GPU_BUFFER, 1, &wall->VBO);
+    gpuDelete(GPU_VERTEXARRAY, 1, &wall->VAO);
+    wall->thread = NULL;
+}
+
+/*Effect plugins (see plugin.h). Modules are loaded once for the process and
+* instanced per stage. Each draw is bracketed by a GL_TIME_ELAPSED query from
+* a small ring that is read back only once the result is available, so timing
+* an effect never stalls the frame it is timing. A plugin over budget for
+* PLUGIN_STRIKES frames drops to reduced quality, then to skipped for
+* PLUGIN_COOLDOWN frames, and climbs back once it has been well under budget
+* for PLUGIN_RECOVER frames. Plugins are DLLs, so the headless build runs
+* without them.
+*/
+//What STATS and metrics.json show for one stage's instance of a plugin
+typedef struct pluginStats {
+    volatile float gpuMs;
+    volatile float cpuMs;
+    volatile LONG quality;
+    volatile LONG skipped;
+} PSTATS;
+
+//A module that faulted once is not instanced again; quality is each stage's own
+typedef struct pluginModule {
+    HMODULE module;
+    const NNB_PLUGIN* api;
+    volatile LONG faulted;
+    PSTATS stages[INSTANCE_MAX];
+} PMODULE;
+
+typedef struct pluginInstance {
+    PMODULE* module;
+    void* self;
+    unsigned int targets[NNB_MAX_TARGETS];
+    unsigned int queries[PLUGIN_QUERIES];
+    int queryHead;
+    int queryCount;
+    float gpuMs;
+    float cpuMs;
+    int quality;
+    int strikes;
+    int calm;
+    unsigned int resume;
+} PINSTANCE;
+
+typedef struct pluginHost {
+    PINSTANCE plugins[PLUGIN_MAX];
+    int stage;
+    int count;
+    int width;
+    int height;
+    double time;
+    unsigned int frame;
+} PLUGINS;
+
+PMODULE pluginModules[PLUGIN_MAX];
+int pluginModuleCount = -1;
+SRWLOCK pluginLock = SRWLOCK_INIT;
+
+void pluginLog(const char* message) {
+    std::cout << "[plugin] " << message << std::endl;
+}
+
+void* pluginProc(const char* name) {
+    return glProcAddress(name);
+}
+
+const NNB_HOST pluginHostApi = { NNB_PLUGIN_VERSION, pluginProc, pluginLog };
+
+//The first stage to start scans the plugin folder; modules stay loaded until exit
+void scanPlugins() {
+    AcquireSRWLockExclusive(&pluginLock);
+    if (pluginModuleCount >= 0) {
+        ReleaseSRWLockExclusive(&pluginLock);
+        return;
+    }
+    pluginModuleCount = 0;
+#ifdef _WIN32
+    WIN32_FIND_DATAA found;
+    HANDLE search = FindFirstFileA(PLUGIN_DIR "*.dll", &found);
+    if (search != INVALID_HANDLE_VALUE) {
+        do {
+            if (pluginModuleCount == PLUGIN_MAX) break;
+            char path[MAX_PATH];
+            sprintf_s(path, "%s%s", PLUGIN_DIR, found.cFileName);
+            HMODULE module = LoadLibraryA(path);
+            if (module == NULL) {
+                std::cout << "Unable to load plugin " << path << std::endl;
+                continue;
+            }
+            NNB_ENTRY entry = (NNB_ENTRY)GetProcAddress(module, NNB_ENTRY_NAME);
+            const NNB_PLUGIN* api = entry != NULL ? entry() : NULL;
+            if (api == NULL || api->version != NNB_PLUGIN_VERSION || api->targetCount < 0 || api->targetCount > NNB_MAX_TARGETS) {
+                std::cout << path << " is not a version " << NNB_PLUGIN_VERSION << " banner plugin." << std::endl;
+                FreeLibrary(module);
+                continue;
+            }
+            PMODULE* m = &pluginModules[pluginModuleCount++];
+            m->module = module;
+            m->api = api;
+            for (int s = 0; s < INSTANCE_MAX; s++) m->stages[s].quality = NNB_QUALITY_FULL;
+            std::cout << "Loaded plugin " << api->name << " (" << api->budgetMs << " ms budget)" << std::endl;
+        } while (FindNextFileA(search, &found));
+        FindClose(search);
+    }
+#endif
+    ReleaseSRWLockExclusive(&pluginLock);
+}
+
+/*Every call into a plugin goes through here, so an access violation or other
+* fault inside an effect takes out that effect rather than the show.
+*/
+int pluginCall(PINSTANCE* p, PSTATS* stats, int hook, const NNB_FRAME* frame, unsigned int framebuffer) {
+    const NNB_PLUGIN* api = p->module->api;
+#ifdef _WIN32
+    __try {
+#endif
+        switch (hook) {
+        case PLUGIN_CREATE:
+            p->self = api->create != NULL ? api->create(&pluginHostApi) : NULL;
+            break;
+        case PLUGIN_RESIZE:
+            if (api->resize != NULL) api->resize(p->self, frame->width, frame->height, p->targets);
+            break;
+        case PLUGIN_UPDATE:
+            if (api->update != NULL) api->update(p->self, frame);
+            break;
+        case PLUGIN_DRAW:
+            if (api->draw != NULL) api->draw(p->self, frame, framebuffer, p->quality);
+            break;
+        case PLUGIN_DESTROY:
+            if (api->destroy != NULL) api->destroy(p->self);
+            break;
+        }
+#ifdef _WIN32
+    }__except (EXCEPTION_EXECUTE_HANDLER) {
+        std::cout << "\033[0;91mPlugin " << api->name << " faulted and has been disabled.\033[0m" << std::endl;
+        p->quality = PLUGIN_FAULTED;
+        InterlockedExchange(&stats->quality, PLUGIN_FAULTED);
+        InterlockedExchange(&p->module->faulted, 1);
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+void pluginTargets(PINSTANCE* p, int width, int height) {
+    const NNB_PLUGIN* api = p->module->api;
+    if (api->targetCount == 0) return;
+    gpuDelete(GPU_TEXTURE, api->targetCount, p->targets);
+    gpuCreate(GPU_TEXTURE, api->targetCount, p->targets, "plugins");
+    for (int i = 0; i < api->targetCount; i++) {
+        float scale = api->targets[i].scale > 0.0f ? api->targets[i].scale : 1.0f;
+        int w = (int)(width * scale), h = (int)(height * scale);
+        glBindTexture(GL_TEXTURE_2D, p->targets[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, api->targets[i].format, w > 0 ? w : 1, h > 0 ? h : 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        gpuStorage(GPU_TEXTURE, p->targets[i], api->targets[i].format, gpuTextureBytes(api->targets[i].format, w > 0 ? w : 1, h > 0 ? h : 1, 0));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+//[host->stage] is set by the caller; it picks which PSTATS the instances report to
+void openPlugins(PLUGINS* host) {
+    scanPlugins();
+    host->count = 0;
+    host->width = host->height = 0;
+    for (int i = 0; i < pluginModuleCount; i++) {
+        PINSTANCE* p = &host->plugins[host->count];
+        *p = {};
+        p->module = &pluginModules[i];
+        p->quality = NNB_QUALITY_FULL;
+        PSTATS* stats = &p->module->stages[host->stage];
+        if (p->module->faulted) {
+            InterlockedExchange(&stats->quality, PLUGIN_FAULTED);
+            continue;
+        }
+        InterlockedExchange(&stats->quality, NNB_QUALITY_FULL);
+        if (pluginCall(p, stats, PLUGIN_CREATE, NULL, 0)) continue;
+        gpuCreate(GPU_QUERY, PLUGIN_QUERIES, p->queries, "plugins");
+        host->count++;
+    }
+}
+
+//Fold in whatever timings have landed, oldest first, without waiting on the rest
+void pluginCollect(PINSTANCE* p) {
+    while (p->queryCount > 0) {
+        unsigned int query = p->queries[(p->queryHead - p->queryCount + PLUGIN_QUERIES) % PLUGIN_QUERIES];
+        GLint available = 0;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+        p->gpuMs = p->gpuMs * 0.8f + elapsed / 1000000.0f * 0.2f;
+        p->queryCount--;
+    }
+}
+
+void pluginBudget(PINSTANCE* p, PLUGINS* host) {
+    const NNB_PLUGIN* api = p->module->api;
+    float budget = api->budgetMs > 0.0f ? api->budgetMs : PLUGIN_BUDGET;
+    float spent = p->gpuMs > p->cpuMs ? p->gpuMs : p->cpuMs;
+    //Results four frames behind mean the GPU is not keeping up with this effect
+    if (spent > budget || p->queryCount == PLUGIN_QUERIES) {
+        p->calm = 0;
+        if (++p->strikes < PLUGIN_STRIKES) return;
+        p->strikes = 0;
+        if (p->quality == NNB_QUALITY_FULL) {
+            p->quality = NNB_QUALITY_REDUCED;
+            std::cout << "Plugin " << api->name << " over budget (" << spent << "/" << budget << " ms), reducing quality." << std::endl;
+        }else {
+            p->quality = PLUGIN_SKIPPED;
+            p->resume = host->frame + PLUGIN_COOLDOWN;
+            InterlockedIncrement(&p->module->stages[host->stage].skipped);
+            std::cout << "Plugin " << api->name << " over budget (" << spent << "/" << budget << " ms), skipping it for " << PLUGIN_COOLDOWN << " frames." << std::endl;
+        }
+        p->gpuMs = p->cpuMs = 0.0f;
+        return;
+    }
+    p->strikes = 0;
+    if (p->quality == NNB_QUALITY_REDUCED && spent < budget / 2 && ++p->calm >= PLUGIN_RECOVER) {
+        p->calm = 0;
+        p->quality = NNB_QUALITY_FULL;
+        p->gpuMs = p->cpuMs = 0.0f;
+    }
+}
+
+//Whatever a hook left bound, the next plugin and the next frame start clean
+void pluginRestore(unsigned int target, FRAME* frame) {
+    glBindFramebuffer(GL_FRAMEBUFFER, target);
+    glViewport(0, 0, frame->width, frame->height);
+    glUseProgram(0);
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+    glDisable(GL_BLEND);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_SCISSOR_TEST);
+}
+
+//Runs every plugin on the current layer into [target] once the built-in passes are done
+void pluginFrame(PLUGINS* host, FRAME* frame, unsigned int target) {
+    if (host->count == 0) return;
+    host->time += frame->dt;
+    host->frame++;
+    NNB_FRAME view = { frame->width, frame->height, host->time, frame->dt, frame->slideshow };
+    for (int i = 0; i < 3; i++) {
+        view.lights[0][i] = frame->rc[i];
+        view.lights[1][i] = frame->gc[i];
+        view.lights[2][i] = frame->bc[i];
+    }
+    view.lights[0][3] = view.lights[1][3] = view.lights[2][3] = 1.0f;
+    int layer = frame->slideshow ? NNB_LAYER_SLIDESHOW : NNB_LAYER_BANNER;
+    int resized = host->width != frame->width || host->height != frame->height;
+    host->width = frame->width;
+    host->height = frame->height;
+
+    LARGE_INTEGER freq, start, end;
+    QueryPerformanceFrequency(&freq);
+    for (int i = 0; i < host->count; i++) {
+        PINSTANCE* p = &host->plugins[i];
+        PSTATS* stats = &p->module->stages[host->stage];
+        if (p->quality == PLUGIN_FAULTED) continue;
+        if (resized) {
+            pluginTargets(p, frame->width, frame->height);
+            int failed = pluginCall(p, stats, PLUGIN_RESIZE, &view, target);
+            pluginRestore(target, frame);
+            if (failed) continue;
+        }
+        pluginCollect(p);
+        if (p->quality == PLUGIN_SKIPPED) {
+            if (host->frame < p->resume) continue;
+            p->quality = NNB_QUALITY_REDUCED;
+        }
+        pluginBudget(p, host);
+        if (p->quality == PLUGIN_SKIPPED) continue;
+
+        QueryPerformanceCounter(&start);
+        int failed = pluginCall(p, stats, PLUGIN_UPDATE, &view, target);
+        if (!failed && (p->module->api->layers & layer)) {
+            int timed = p->queryCount < PLUGIN_QUERIES;
+            if (timed) glBeginQuery(GL_TIME_ELAPSED, p->queries[p->queryHead]);
+            failed = pluginCall(p, stats, PLUGIN_DRAW, &view, target);
+            if (timed) {
+                glEndQuery(GL_TIME_ELAPSED);
+                p->queryHead = (p->queryHead + 1) % PLUGIN_QUERIES;
+                p->queryCount++;
+            }
+        }
+        pluginRestore(target, frame);
+        if (failed) continue;
+        QueryPerformanceCounter(&end);
+        p->cpuMs = p->cpuMs * 0.8f + (float)((end.QuadPart - start.QuadPart) * 1000.0 / freq.QuadPart) * 0.2f;
+        stats->gpuMs = p->gpuMs;
+        stats->cpuMs = p->cpuMs;
+        InterlockedExchange(&stats->quality, p->quality);
+    }
+}
+
+void closePlugins(PLUGINS* host) {
+    for (int i = 0; i < host->count; i++) {
+        PINSTANCE* p = &host->plugins[i];
+        if (p->quality != PLUGIN_FAULTED) pluginCall(p, &p->module->stages[host->stage], PLUGIN_DESTROY, NULL, 0);
+        if (p->module->api->targetCount > 0) gpuDelete(GPU_TEXTURE, p->module->api->targetCount, p->targets);
+        gpuDelete(GPU_QUERY, PLUGIN_QUERIES, p->queries);
+    }
+    host->count = 0;
+}
+
+/*Per-pass GPU timing for the HUD. Each pass drops a GL_TIMESTAMP query as it
+* finishes (the bloom pass drops one per blur iteration too), so a pass costs
+* the gap since the previous mark. Timestamps rather than elapsed-time queries
+* because those cannot nest, and plugins time themselves with one. Marks go
+* into a ring of TIMER_FRAMES sets and a set is read back only once its last
+* query has landed, so the HUD runs a couple of frames behind but never waits.
+*/
+typedef struct passTimer {
+    unsigned int queries[TIMER_FRAMES][TIMER_MARKS];
+    int sections[TIMER_FRAMES][TIMER_MARKS];
+    int marks[TIMER_FRAMES];
+    int current;
+    int running;
+    float gpuMs[TIMER_SECTIONS];
+    float lastMs[PASS_COUNT];
+    int folded;
+    float frameGpuMs;
+    float history[TIMER_HISTORY];
+    int historyHead;
+    unsigned int VBO, VAO;
+} PTIMER;
+
+typedef struct glResources {
+    unsigned int BGprogram;
+    unsigned int bloom;
+    unsigned int assembly;
+    unsigned int fullbanner;
+    unsigned int textprog;
+    unsigned int dots;
+    unsigned int VBO, VAO, EBO;
+    unsigned int oVBO, oVAO;
+    unsigned int sVBO, sVAO;
+    unsigned int tVBO, tVAO;
+    unsigned int dVBO, dVAO;
+    THEMES themes;
+    WALL wall;
+    PLUGINS plugins;
+    PTIMER timer;
+    unsigned int FBO[3];
+    unsigned int cbuffers[4];
+    int targetWidth, targetHeight;
+    unsigned int target;
+    GLint uPM, uRL, uGL, uBL, uWL, uTS, uNS, uSS, uSC;
+    GLint uPT, uPN, uPS, uFA;
+    GLint bBB, bH;
+    GLint cE, cF, cB, cX;
+    GLint sX;
+    GLint tP, tT, tC;
+    GLint dO, dR;
+    const char* slideDir;
+    unsigned int slides[SLIDE_MAX];
+    unsigned int slideCount;
+    CLIP* clips[SLIDE_MAX];
+    SDATA stream;
+    const char* stagingDir;
+    unsigned int staging[SLIDE_MAX];
+    unsigned int stagingCount;
+    CLIP* stagingClips[SLIDE_MAX];
+    int stagingDone;
+    unsigned int slideOverlay;
+    unsigned int dotMatrix;
+    double uploadWindow;
+    size_t uploadBytes;
+    unsigned int sceneUBO;
+    int sceneVersion;
+    int debugPass;
+    LONG generation;
+    int drill; //The next glLost reports a reset that never happened
+} GLRES;
+
+//Rendered glyph bitmaps, kept so a rebuild after a device reset skips FreeType
+typedef struct glyphBitmap {
+    int width;
+    int rows;
+    int left;
+    int top;
+    unsigned int advance;
+    unsigned char* buffer;
+} GLYPHBITMAP;
+GLYPHBITMAP glyphCache[128];
+int glyphsCached = 0;
+
+void uploadGlyph(unsigned char c, GLYPHBITMAP* b) {
+    unsigned int tex;
+    gpuCreate(GPU_TEXTURE, 1, &tex, "glyphs");
+    gpuShare(GPU_TEXTURE, tex);
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, b->width, b->rows, 0, GL_RED, GL_UNSIGNED_BYTE, b->buffer);
+    gpuStorage(GPU_TEXTURE, tex, GL_R8, gpuTextureBytes(GL_R8, b->width, b->rows, 0));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    Glyph character;
+    character.texture = tex;
+    character.size = glm::ivec2(b->width, b->rows);
+    character.bearing = glm::ivec2(b->left, b->top);
+    character.advance = b->advance;
+    AcquireSRWLockExclusive(&glyphLock);
+    charMap[c] = character;
+    ReleaseSRWLockExclusive(&glyphLock);
+}
+
+void uploadGlyphs() {
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    if (glyphsCached) {
+        for (unsigned char c = 0; c < 128; c++) if (glyphCache[c].buffer != NULL) uploadGlyph(c, &glyphCache[c]);
+        return;
+    }
+    std::cout << "Loading font..." << std::endl;
+    FT_Library ft;
+    if (FT_Init_FreeType(&ft)) {
+        std::cout << "Couldn't load FreeType." << std::endl;
+        ExitProcess(-1);
+    }
+    FT_Face face;
+    if (FT_New_Face(ft, "./fonts/Times New Roman Bold.ttf", 0, &face)) {
+        std::cout << "Couldn't load font." << std::endl;
+        ExitProcess(-1);
+    }
+    FT_Set_Pixel_Sizes(face, 0, 92);
+
+    for (unsigned char c = 0; c < 128; c++) {
+        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
+            std::cout << "Failed to load '" << c << "'." << std::endl;
+            continue;
+        }
+        FT_GlyphSlot g = face->glyph;
+        GLYPHBITMAP* b = &glyphCache[c];
+        b->width = g->bitmap.width;
+        b->rows = g->bitmap.rows;
+        b->left = g->bitmap_left;
+        b->top = g->bitmap_top;
+        b->advance = g->advance.x;
+        b->buffer = (unsigned char*)HeapAlloc(GetProcessHeap(), 0, (size_t)b->width * b->rows + 1);
+        for (int r = 0; r < b->rows; r++) memcpy(b->buffer + r * b->width, g->bitmap.buffer + r * g->bitmap.pitch, b->width);
+        uploadGlyph(c, b);
+    }
+    glyphsCached = 1;
+    FT_Done_Face(face);
+    FT_Done_FreeType(ft);
+}
+
+//The glyph textures are shared, so only the first instance in a generation uploads them
+LONG glyphGeneration = -1;
+void loadGlyphs() {
+    AcquireSRWLockExclusive(&gpuAssetLock);
+    if (glyphGeneration != gpuGeneration) {
+        uploadGlyphs();
+        glFinish();
+        glyphGeneration = gpuGeneration;
+    }
+    ReleaseSRWLockExclusive(&gpuAssetLock);
+}
+
+//Uploads slide [index] of [dir]; 0 once there are no more slides
+int glLoadSlide(const char* dir, int index, unsigned int* slide, CLIP** clip) {
+    char slidePath[MAX_PATH];
+    sprintf_s(slidePath, "%s/s%d.png", dir, index);
+    std::ifstream slideFile(slidePath);
+    *clip = NULL;
+    if (slideFile.is_open()) {
+        slideFile.close();
+        *slide = acquireTexture(slidePath, "slides").texture;
+        return 1;
+    }
+    *clip = loadClip(dir, index);
+    if (*clip == NULL) return 0;
+    *slide = (*clip)->texture;
+    return 1;
+}
+
+void glReleaseSlideSet(unsigned int* slides, CLIP** clips, int count, LONG generation) {
+    for (int i = 0; i < count; i++) {
+        CLIP* clip = clips[i];
+        if (clip == NULL) {
+            releaseAsset(slides[i], 0, generation);
+            continue;
+        }
+        gpuDelete(GPU_TEXTURE, 1, &clip->texture);
+        gpuDelete(GPU_BUFFER, 1, &clip->pbo);
+        if (!clip->persistent) HeapFree(GetProcessHeap(), 0, clip->mapped);
+        if (clip->poster != NULL) stbi_image_free(clip->poster);
+        releaseImage(clip->image);
+        if (clip->kind == CLIP_RAW) {
+            UnmapViewOfFile(clip->frames - CLIP_HEADER);
+            CloseHandle(clip->mapping);
+            CloseHandle(clip->file);
+            if (clip->delays != NULL) HeapFree(GetProcessHeap(), 0, clip->delays);
+        }
+        HeapFree(GetProcessHeap(), 0, clip);
+        clips[i] = NULL;
+    }
+}
+
+//Hands the slides back and stops the clip worker, leaving the rest of the backend up
+void glReleaseSlides(GLRES* res) {
+    res->stream.running = 0;
+    if (res->stream.thread != NULL) {
+        WaitForSingleObject(res->stream.thread, INFINITE);
+        CloseHandle(res->stream.thread);
+        CloseHandle(res->stream.signal);
+    }
+    glReleaseSlideSet(res->slides, res->clips, res->slideCount, res->generation);
+    res->stream = {};
+    res->slideCount = 0;
+}
+
+//Starts the clip worker if any of the loaded slides are animated
+void glStartStream(GLRES* res) {
+    for (unsigned int i = 0; i < res->slideCount; i++) if (res->clips[i] != NULL) res->stream.count = i + 1;
+    if (res->stream.count > 0) {
+        res->stream.clips = res->clips;
+        res->stream.signal = CreateEventA(NULL, FALSE, FALSE, NULL);
+        res->stream.running = 1;
+        DWORD streamID;
+        res->stream.thread = CreateThread(NULL, 0, StreamMain, &res->stream, 0, &streamID);
+    }
+}
+
+//Loads every slide in the stage's slide folder
+void glLoadSlides(GLRES* res) {
+    if (res->slideDir == NULL) res->slideDir = slideDir;
+    res->slideCount = 0;
+    while (res->slideCount < SLIDE_MAX && glLoadSlide(res->slideDir, res->slideCount, &res->slides[res->slideCount], &res->clips[res->slideCount])) res->slideCount++;
+    glStartStream(res);
+}
+
+/*Synced slides are uploaded one per frame into a staging set beside the live
+* one, then swapped in at a slide boundary by handing over the handles, so a
+* swap costs a thread join rather than a whole folder of uploads in one frame.
+*/
+void glStageSlides(GLRES* res, const char* dir) {
+    if (res->stagingDir != dir) {
+        glReleaseSlideSet(res->staging, res->stagingClips, res->stagingCount, res->generation);
+        res->stagingDir = dir;
+        res->stagingCount = 0;
+        res->stagingDone = 0;
+    }
+    if (res->stagingDone) return;
+    if (res->stagingCount < SLIDE_MAX && glLoadSlide(dir, res->stagingCount, &res->staging[res->stagingCount], &res->stagingClips[res->stagingCount])) res->stagingCount++;
+    else res->stagingDone = 1;
+}
+
+void glSwapSlides(GLRES* res) {
+    glReleaseSlides(res);
+    res->slideDir = res->stagingDir;
+    res->slideCount = res->stagingCount;
+    memcpy(res->slides, res->staging, sizeof(res->slides));
+    memcpy(res->clips, res->stagingClips, sizeof(res->clips));
+    for (int i = 0; i < SLIDE_MAX; i++) res->stagingClips[i] = NULL;
+    res->stagingDir = NULL;
+    res->stagingCount = 0;
+    res->stagingDone = 0;
+    glStartStream(res);
+}
+
+//(Re)sizes the float render targets, and their entries in the registry with them
+void glTargets(GLRES* res, int width, int height) {
+    for (int i = 0; i < 4; i++) {
+        glBindTexture(GL_TEXTURE_2D, res->cbuffers[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, width, height, 0, GL_RGBA, GL_FLOAT, NULL);
+        gpuStorage(GPU_TEXTURE, res->cbuffers[i], GL_RGBA16F, gpuTextureBytes(GL_RGBA16F, width, height, 0));
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    res->targetWidth = width;
+    res->targetHeight = height;
+}
+
+int glInit(void* data, GLFWwindow* window, int width, int height) {
+    GLRES* res = (GLRES*)data;
+    gladLoadGL();
+    if (!gladLoadGLLoader((GLADloadproc)glProcAddress)) {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        return -1;
+    }
+
+    glDebugInit(&res->debugPass);
+    std::cout << "Confiruging GL Viewport..." << std::endl;
+    resizeCanvas(window, width, height);
+    res->generation = gpuGeneration;
+
+    res->BGprogram = acquireProgram("shader/bgmain.vs", "shader/light.fs");
+
+    res->bloom = acquireProgram("shader/flat.vs", "shader/bloom.fs");
+
+    res->assembly = acquireProgram("shader/flat.vs", "shader/assembly.fs");
+
+    res->fullbanner = acquireProgram("shader/flat.vs", "shader/flat.fs");
+
+    res->textprog = acquireProgram("shader/text.vs", "shader/text.fs");
+
+    res->dots = acquireProgram("shader/dot.vs", "shader/flat.fs");
+
+    std::cout << "Shaders Compiled!" << std::endl;
+
+    gpuCreate(GPU_BUFFER, 1, &res->VBO, "geometry");
+    gpuCreate(GPU_VERTEXARRAY, 1, &res->VAO, "geometry");
+    glBindVertexArray(res->VAO);
+    gpuCreate(GPU_BUFFER, 1, &res->EBO, "geometry");
+
+    glBindBuffer(GL_ARRAY_BUFFER, res->VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices[Q_BANNER]), quadVertices[Q_BANNER], GL_STATIC_DRAW);
+    gpuStorage(GPU_BUFFER, res->VBO, 0, sizeof(quadVertices[Q_BANNER]));
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, res->EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quadIndices), quadIndices, GL_STATIC_DRAW);
+    gpuStorage(GPU_BUFFER, res->EBO, 0, sizeof(quadIndices));
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    gpuCreate(GPU_BUFFER, 1, &res->oVBO, "geometry");
+    gpuCreate(GPU_VERTEXARRAY, 1, &res->oVAO, "geometry");
+    glBindVertexArray(res->oVAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, res->oVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices[Q_OVERLAY]), quadVertices[Q_OVERLAY], GL_STATIC_DRAW);
+    gpuStorage(GPU_BUFFER, res->oVBO, 0, sizeof(quadVertices[Q_OVERLAY]));
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, res->EBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    gpuCreate(GPU_BUFFER, 1, &res->sVBO, "geometry");
+    gpuCreate(GPU_VERTEXARRAY, 1, &res->sVAO, "geometry");
+    glBindVertexArray(res->sVAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, res->sVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices[Q_SLIDE]), quadVertices[Q_SLIDE], GL_STATIC_DRAW);
+    gpuStorage(GPU_BUFFER, res->sVBO, 0, sizeof(quadVertices[Q_SLIDE]));
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, res->EBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    gpuCreate(GPU_BUFFER, 1, &res->tVBO, "geometry");
+    gpuCreate(GPU_VERTEXARRAY, 1, &res->tVAO, "geometry");
+    glBindVertexArray(res->tVAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, res->tVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float)*6*4, NULL, GL_DYNAMIC_DRAW);
+    gpuStorage(GPU_BUFFER, res->tVBO, 0, sizeof(float) * 6 * 4);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2*sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    gpuCreate(GPU_BUFFER, 1, &res->dVBO, "geometry");
+    gpuCreate(GPU_VERTEXARRAY, 1, &res->dVAO, "geometry");
+    glBindVertexArray(res->dVAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, res->dVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices[Q_DOTS]), quadVertices[Q_DOTS], GL_STATIC_DRAW);
+    gpuStorage(GPU_BUFFER, res->dVBO, 0, sizeof(quadVertices[Q_DOTS]));
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, res->EBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    gpuCreate(GPU_QUERY, TIMER_FRAMES * TIMER_MARKS, &res->timer.queries[0][0], "hud");
+    gpuCreate(GPU_BUFFER, 1, &res->timer.VBO, "hud");
+    gpuCreate(GPU_VERTEXARRAY, 1, &res->timer.VAO, "hud");
+    glBindVertexArray(res->timer.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, res->timer.VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 24 * (TIMER_HISTORY + 2), NULL, GL_DYNAMIC_DRAW);
+    gpuStorage(GPU_BUFFER, res->timer.VBO, 0, sizeof(float) * 24 * (TIMER_HISTORY + 2));
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    std::cout << "Generating Textures..." << std::endl;
+    if (openThemes(&res->themes)) return -1;
+    if (openWall(&res->wall)) return -1;
+    openPlugins(&res->plugins);
+
+    gpuCreate(GPU_FRAMEBUFFER, 3, res->FBO, "targets");
+    gpuCreate(GPU_TEXTURE, 4, res->cbuffers, "targets");
+    glTargets(res, width, height);
+    for (int i = 0; i < 2; i++) {
+        glBindFramebuffer(GL_FRAMEBUFFER, res->FBO[0]);
+        glBindTexture(GL_TEXTURE_2D, res->cbuffers[i]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, res->cbuffers[i], 0);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, res->FBO[i + 1]);
+        glBindTexture(GL_TEXTURE_2D, res->cbuffers[i + 2]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, res->cbuffers[i + 2], 0);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, res->FBO[0]);
+    unsigned int attachments[2] = { GL_COLOR_ATTACHMENT0,GL_COLOR_ATTACHMENT1 };
+    glDrawBuffers(2, attachments);
+
+    res->uPM = glGetUniformLocation(res->BGprogram, "uPM");
+    res->uRL = glGetUniformLocation(res->BGprogram, "uRL");
+    res->uGL = glGetUniformLocation(res->BGprogram, "uGL");
+    res->uBL = glGetUniformLocation(res->BGprogram, "uBL");
+    res->uWL = glGetUniformLocation(res->BGprogram, "uWL");
+    res->uTS = glGetUniformLocation(res->BGprogram, "diff");
+    res->uNS = glGetUniformLocation(res->BGprogram, "norm");
+    res->uSS = glGetUniformLocation(res->BGprogram, "smap");
+    res->uSC = glGetUniformLocation(res->BGprogram, "sceneClock");
+    glUniformBlockBinding(res->BGprogram, glGetUniformBlockIndex(res->BGprogram, "Scene"), 0);
+    gpuCreate(GPU_BUFFER, 1, &res->sceneUBO, "scene");
+    glBindBuffer(GL_UNIFORM_BUFFER, res->sceneUBO);
+    glBufferData(GL_UNIFORM_BUFFER, offsetof(SCENE, start), NULL, GL_DYNAMIC_DRAW);
+    gpuStorage(GPU_BUFFER, res->sceneUBO, 0, offsetof(SCENE, start));
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    res->sceneVersion = -1;
+    res->uPT = glGetUniformLocation(res->BGprogram, "pdiff");
+    res->uPN = glGetUniformLocation(res->BGprogram, "pnorm");
+    res->uPS = glGetUniformLocation(res->BGprogram, "psmap");
+    res->uFA = glGetUniformLocation(res->BGprogram, "fade");
+
+    res->bBB = glGetUniformLocation(res->bloom, "bb");
+    res->bH = glGetUniformLocation(res->bloom, "horizontal");
+
+    res->cE = glGetUniformLocation(res->assembly, "exposure");
+    res->cF = glGetUniformLocation(res->assembly, "frag");
+    res->cB = glGetUniformLocation(res->assembly, "bloom");
+    res->cX = glGetUniformLocation(res->assembly, "xOffs");
+
+    res->sX = glGetUniformLocation(res->fullbanner, "xOffs");
+
+    res->tP = glGetUniformLocation(res->textprog, "proj");
+    res->tT = glGetUniformLocation(res->textprog, "text");
+    res->tC = glGetUniformLocation(res->textprog, "textColor");
+
+    res->dO = glGetUniformLocation(res->dots, "offs");
+    res->dR = glGetUniformLocation(res->dots, "rot");
+
+    loadGlyphs();
+
+    glLoadSlides(res);
+    res->uploadWindow = glfwGetTime();
+    res->uploadBytes = 0;
+    res->slideOverlay = acquireTexture("./img/90banner.png", "images").texture;
+    res->dotMatrix = acquireTexture("./img/dotmatrix.png", "images").texture;
+    return 0;
+}
+
+void timerName(int section, char* name, int size) {
+    if (section < PASS_COUNT) sprintf_s(name, size, "%s", passNames[section]);
+    else if (section == TIMER_BRIGHT) sprintf_s(name, size, "  bright");
+    else sprintf_s(name, size, "  blur %d", section - TIMER_BLUR + 1);
+}
+
+void timerMark(GLRES* res, int section) {
+    PTIMER* timer = &res->timer;
+    if (!timer->running) return;
+    int f = timer->current;
+    int n = timer->marks[f];
+    if (n == TIMER_MARKS) return;
+    glQueryCounter(timer->queries[f][n], GL_TIMESTAMP);
+    timer->sections[f][n] = section;
+    timer->marks[f]++;
+}
+
+//Folds in the oldest set of marks if the GPU is done with it, then starts this frame's set
+void timerFrame(GLRES* res, FRAME* frame) {
+    PTIMER* timer = &res->timer;
+    timer->history[timer->historyHead] = (float)(frame->dt * 1000);
+    timer->historyHead = (timer->historyHead + 1) % TIMER_HISTORY;
+    timer->running = frame->hud || frame->timing;
+    if (!timer->running) return;
+    timer->current = (timer->current + 1) % TIMER_FRAMES;
+    int f = timer->current;
+    int n = timer->marks[f];
+    timer->marks[f] = 0;
+    if (n > 1) {
+        GLint available = 0;
+        glGetQueryObjectiv(timer->queries[f][n - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available) {
+            GLuint64 stamps[TIMER_MARKS];
+            for (int k = 0; k < n; k++) glGetQueryObjectui64v(timer->queries[f][k], GL_QUERY_RESULT, &stamps[k]);
+            float ms[TIMER_SECTIONS] = {};
+            for (int k = 1; k < n; k++) {
+                float d = (stamps[k] - stamps[k - 1]) / 1000000.0f;
+                int section = timer->sections[f][k];
+                ms[section] += d;
+                if (section >= TIMER_BRIGHT) ms[PASS_BLOOM] += d;
+            }
+            for (int s = 0; s < TIMER_SECTIONS; s++) timer->gpuMs[s] = timer->gpuMs[s] * 0.9f + ms[s] * 0.1f;
+            memcpy(timer->lastMs, ms, sizeof(timer->lastMs));
+            timer->folded++;
+            timer->frameGpuMs = timer->frameGpuMs * 0.9f + (stamps[n - 1] - stamps[0]) / 1000000.0f * 0.1f;
+        }
+    }
+    timerMark(res, TIMER_START);
+}
+
+void hudQuad(float* v, float x0, float y0, float x1, float y1) {
+    float quad[24] = {
+        x0, y1, 0.5f, 0.5f,
+        x0, y0, 0.5f, 0.5f,
+        x1, y0, 0.5f, 0.5f,
+        x0, y1, 0.5f, 0.5f,
+        x1, y0, 0.5f, 0.5f,
+        x1, y1, 0.5f, 0.5f
+    };
+    memcpy(v, quad, sizeof(quad));
+}
+
+/*Operator HUD, toggled with F3 or the HUD command: GPU time per pass, CPU time
+* for the frame and a rolling graph of frame times against the refresh rate.
+* Solid shapes are drawn with the text program over the theme's white 1x1.
+*/
+void glHudPass(GLRES* res, FRAME* frame) {
+    PTIMER* timer = &res->timer;
+    float x = 20.0f, top = frame->height - 40.0f, line = 26.0f;
+    int rows = 3;
+    for (int s = 0; s < TIMER_SECTIONS; s++) if (timer->gpuMs[s] > 0.001f) rows++;
+    float panelH = rows * line + 110.0f;
+
+    float quads[24 * (TIMER_HISTORY + 2)];
+    hudQuad(quads, x - 10, top - panelH, x + TIMER_HISTORY * 2 + 10, top + 30);
+    glm::mat4 orth = glm::ortho(0.0f, (float)frame->width, 0.0f, (float)frame->height, -1.f, 1.f);
+    glBindFramebuffer(GL_FRAMEBUFFER, res->target);
+    glUseProgram(res->textprog);
+    glUniformMatrix4fv(res->tP, 1, GL_FALSE, &orth[0][0]);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, res->themes.flat[0]);
+    glBindVertexArray(timer->VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, timer->VBO);
+    float panel[3] = { 0.05f, 0.05f, 0.05f };
+    glUniform3fv(res->tC, 1, panel);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float) * 24, quads);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    //Frame time graph, oldest on the left; the line marks one refresh at 60 Hz
+    float base = top - panelH + 10.0f, scale = 3.0f;
+    for (int i = 0; i < TIMER_HISTORY; i++) {
+        float ms = timer->history[(timer->historyHead + i) % TIMER_HISTORY];
+        if (ms > 33.0f) ms = 33.0f;
+        hudQuad(quads + 24 * i, x + i * 2.0f, base, x + i * 2.0f + 2.0f, base + ms * scale);
+    }
+    hudQuad(quads + 24 * TIMER_HISTORY, x, base + 16.7f * scale, x + TIMER_HISTORY * 2.0f, base + 16.7f * scale + 1.0f);
+    float bars[3] = { 0.2f, 1.0f, 0.2f };
+    glUniform3fv(res->tC, 1, bars);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float) * 24 * (TIMER_HISTORY + 1), quads);
+    glDrawArrays(GL_TRIANGLES, 0, 6 * TIMER_HISTORY);
+    float target[3] = { 1.0f, 0.8f, 0.2f };
+    glUniform3fv(res->tC, 1, target);
+    glDrawArrays(GL_TRIANGLES, 6 * TIMER_HISTORY, 6);
+
+    char message[64], name[32];
+    float white[3] = { 1.0f, 1.0f, 1.0f };
+    glUniform3fv(res->tC, 1, white);
+    glBindVertexArray(res->tVAO);
+    sprintf_s(message, "GPU %.2f ms  CPU %.2f ms", timer->frameGpuMs, frame->cpuMs);
+    drawText(message, x, top, 0.25f, res->tVBO);
+    sprintf_s(message, "%.1f fps", frame->dt > 0 ? 1.0 / frame->dt : 0.0);
+    drawText(message, x, top - line, 0.25f, res->tVBO);
+    float y = top - 2 * line;
+    for (int s = 0; s < TIMER_SECTIONS; s++) {
+        if (timer->gpuMs[s] <= 0.001f) continue;
+        timerName(s, name, sizeof(name));
+        sprintf_s(message, "%s %.3f ms", name, timer->gpuMs[s]);
+        drawText(message, x, y, 0.25f, res->tVBO);
+        y -= line;
+    }
+}
+
+void glLightPass(GLRES* res, FRAME* frame) {
+    glm::mat4 pm = glm::perspective(2.65625f, (1.0f * frame->width) / frame->height, 0.1f, 100.0f);
+    glBindFramebuffer(GL_FRAMEBUFFER, res->target);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(res->BGprogram);
+    glUniformMatrix4fv(res->uPM, 1, true, &pm[0][0]);
+    glUniform3fv(res->uRL, 1, frame->rl);
+    glUniform3fv(res->uGL, 1, frame->gl);
+    glUniform3fv(res->uBL, 1, frame->bl);
+    glUniform3fv(res->uWL, 1, frame->wl);
+    //The shader does the crossfade; the block only goes up when a new one starts
+    if (res->sceneVersion != frame->scene->version) {
+        glBindBuffer(GL_UNIFORM_BUFFER, res->sceneUBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, offsetof(SCENE, start), frame->scene);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        res->sceneVersion = frame->scene->version;
+    }
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, res->sceneUBO);
+    glUniform1f(res->uSC, (float)(frame->scene->now - frame->scene->start));
+    glUniform1i(res->uTS, 0);
+    glUniform1i(res->uNS, 1);
+    glUniform1i(res->uSS, 2);
+    glUniform1i(res->uPT, 3);
+    glUniform1i(res->uPN, 4);
+    glUniform1i(res->uPS, 5);
+    glUniform1f(res->uFA, res->themes.fade);
+    //Units 0-2 hold the incoming theme and 3-5 the one fading out
+    THEMESLOT* current = &res->themes.slots[res->themes.current];
+    THEMESLOT* previous = &res->themes.slots[res->themes.previous];
+    for (int k = 0; k < THEME_MAPS; k++) {
+        glActiveTexture(GL_TEXTURE0 + k);
+        glBindTexture(GL_TEXTURE_2D, current->maps[k]);
+        glActiveTexture(GL_TEXTURE3 + k);
+        glBindTexture(GL_TEXTURE_2D, previous->maps[k]);
+    }
+    glBindVertexArray(res->VAO);
+    glBindFramebuffer(GL_FRAMEBUFFER, res->FBO[0]);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+}
+
+void glBloomPass(GLRES* res, FRAME* frame) {
+    glUseProgram(res->bloom);
+    glUniform1i(res->bBB, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(res->VAO);
+
+    glUniform1i(res->bH, GL_TRUE);
+    glBindFramebuffer(GL_FRAMEBUFFER, res->FBO[1]);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glBindTexture(GL_TEXTURE_2D, res->cbuffers[1]);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+
+    glUniform1i(res->bH, GL_FALSE);
+    glBindFramebuffer(GL_FRAMEBUFFER, res->FBO[2]);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glBindTexture(GL_TEXTURE_2D, res->cbuffers[2]);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    timerMark(res, TIMER_BRIGHT);
+
+    for (int i = 0; i < BLOOM_PASSES; i++) {
+        glUniform1i(res->bH, GL_TRUE);
+        glBindFramebuffer(GL_FRAMEBUFFER, res->FBO[1]);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glBindTexture(GL_TEXTURE_2D, res->cbuffers[3]);
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+
+        glUniform1i(res->bH, GL_FALSE);
+        glBindFramebuffer(GL_FRAMEBUFFER, res->FBO[2]);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glBindTexture(GL_TEXTURE_2D, res->cbuffers[2]);
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        timerMark(res, TIMER_BLUR + i);
+    }
+}
+
+void glAssemblyPass(GLRES* res, FRAME* frame) {
+    glUseProgram(res->assembly);
+    glUniform1f(res->cX, 0.0f);
+    glUniform1f(res->cE, 1.0f);
+    glUniform1i(res->cF, 0);
+    glUniform1i(res->cB, 1);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, res->cbuffers[0]);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, res->cbuffers[3]);
+    glBindVertexArray(res->VAO);
+    glBindFramebuffer(GL_FRAMEBUFFER, res->target);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+}
+
+void glDotsPass(GLRES* res, FRAME* frame) {
+    glBindFramebuffer(GL_FRAMEBUFFER, res->target);
+    glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(res->dots);
+    glm::mat4 rotation = dotRotation(PI / 3, frame->width, frame->height);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, res->dotMatrix);
+    glBindVertexArray(res->dVAO);
+    glUniformMatrix4fv(res->dR, 1, GL_FALSE, &rotation[0][0]);
+    glUniform1f(res->dO, frame->dotOffset);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+
+    rotation = dotRotation(PI * 7 / 6, frame->width, frame->height);
+    glUniformMatrix4fv(res->dR, 1, GL_FALSE, &rotation[0][0]);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+}
+
+void glSlidePass(GLRES* res, FRAME* frame) {
+    for (int i = 0; i < res->stream.count; i++) {
+        if (res->clips[i] == NULL) continue;
+        res->clips[i]->active = i == frame->slide || i == frame->nextSlide;
+        res->uploadBytes += streamClip(res->clips[i], &res->stream, frame->dt, i == frame->slide || (i == frame->nextSlide && frame->slideTransition > 0));
+    }
+    if (glfwGetTime() - res->uploadWindow >= 1.0) {
+        metrics.uploadMBps = (float)(res->uploadBytes / (glfwGetTime() - res->uploadWindow) / (1024 * 1024));
+        res->uploadWindow = glfwGetTime();
+        res->uploadBytes = 0;
+    }
+    glActiveTexture(GL_TEXTURE0);
+
+    glUseProgram(res->fullbanner);
+    glUniform1f(res->sX, 0.0f);
+    glBindTexture(GL_TEXTURE_2D, res->slides[frame->slide]);
+    glBindVertexArray(res->sVAO);
+    glUniform1f(res->sX, -frame->slideTransition);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+
+    glUniform1f(res->sX, -frame->slideTransition + 2.0f);
+    glBindTexture(GL_TEXTURE_2D, res->slides[frame->nextSlide]);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+}
+
+void glOverlayPass(GLRES* res, FRAME* frame) {
+    glUseProgram(res->fullbanner);
+    glUniform1f(res->sX, 0.0f);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, res->slideOverlay);
+    glBindVertexArray(res->oVAO);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+}
+
+void glWallPass(GLRES* res, FRAME* frame) {
+    WALL* wall = &res->wall;
+    if (wall->tickerCount == 0) return;
+    float quads[30 * WALL_VISIBLE];
+    float rows = WALL_CARDS / WALL_COLUMNS;
+    float margin = 16.0f * frame->width / 1920.0f;
+    //flat.vs flips y, so positions are given upside down
+    float top = -((margin + wall->cardH) / frame->height * 2 - 1);
+    float bottom = -(margin / frame->height * 2 - 1);
+    for (int i = 0; i < wall->tickerCount; i++) {
+        int cell = wall->ticker[i];
+        float u0 = (float)(cell % WALL_COLUMNS) / WALL_COLUMNS, u1 = u0 + 1.0f / WALL_COLUMNS;
+        float v0 = (float)(cell / WALL_COLUMNS) / rows, v1 = v0 + 1.0f / rows;
+        float x0 = wall->tickerX[i] / frame->width * 2 - 1;
+        float x1 = (wall->tickerX[i] + wall->cardW) / frame->width * 2 - 1;
+        float quad[30] = {
+            x0, top,    0.0f,   u0, v0,
+            x0, bottom, 0.0f,   u0, v1,
+            x1, top,    0.0f,   u1, v0,
+            x1, bottom, 0.0f,   u1, v1,
+            x1, top,    0.0f,   u1, v0,
+            x0, bottom, 0.0f,   u0, v1
+        };
+        memcpy(quads + i * 30, quad, sizeof(quad));
+    }
+    glUseProgram(res->fullbanner);
+    glUniform1f(res->sX, 0.0f);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, wall->atlas);
+    glBindVertexArray(wall->VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, wall->VBO);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float) * 30 * wall->tickerCount, quads);
+    glDrawArrays(GL_TRIANGLES, 0, 6 * wall->tickerCount);
+}
+
+void glTextPass(GLRES* res, FRAME* frame) {
+    setTextColor(1.0f, 1.0f, 1.0f);
+    glm::mat4 orth = glm::ortho(0.0f, (float)frame->width, 0.0f, (float)frame->height, -1.f, 1.f);
+    glUseProgram(res->textprog);
+    glUniformMatrix4fv(res->tP, 1, GL_FALSE, &orth[0][0]);
+    glUniform3fv(res->tC, 1, textColor);
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(res->tVAO);
+    drawText(frame->clock, 100, frame->height - 50, 0.5f, res->tVBO);
+    drawText(frame->showtime, 100, frame->height - 105, 0.5f, res->tVBO);
+
+    setTextColor(0.97647f, 0.92549f, 0.35686f);
+    glUniform3fv(res->tC, 1, textColor);
+    drawText(frame->venue, 650, frame->height - 90, 0.7f, res->tVBO);
+}
+
+void glPluginPass(GLRES* res, FRAME* frame) {
+    pluginFrame(&res->plugins, frame, res->target);
+}
+
+//Debug groups label the pass in captures and let the debug callback say which pass raised a message
+void glPass(GLRES* res, FRAME* frame, int pass, void (*draw)(GLRES*, FRAME*)) {
+    if (glDebug) {
+        res->debugPass = pass;
+        if (GLAD_GL_VERSION_4_3) glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, pass, -1, passNames[pass]);
+    }
+    draw(res, frame);
+    timerMark(res, pass);
+    if (glDebug) {
+        if (GLAD_GL_VERSION_4_3) glPopDebugGroup();
+        glDebugFrame(&res->debugPass);
+        res->debugPass = -1;
+    }
+}
+
+void glDrawFrame(void* data, FRAME* frame) {
+    GLRES* res = (GLRES*)data;
+    if (frame->width > 0 && frame->height > 0 && (frame->width != res->targetWidth || frame->height != res->targetHeight)) glTargets(res, frame->width, frame->height);
+    themeFrame(&res->themes, frame->dt);
+    wallFrame(&res->wall, frame, frame->slideshow && frame->metaposts);
+    glDebugFrame(&res->debugPass);
+    timerFrame(res, frame);
+    if (!frame->slideshow) {
+        glPass(res, frame, PASS_LIGHT, glLightPass);
+        glPass(res, frame, PASS_BLOOM, glBloomPass);
+        glPass(res, frame, PASS_ASSEMBLY, glAssemblyPass);
+    }else {
+        glPass(res, frame, PASS_DOTS, glDotsPass);
+        glPass(res, frame, PASS_SLIDES, glSlidePass);
+        glPass(res, frame, PASS_OVERLAY, glOverlayPass);
+        glPass(res, frame, PASS_WALL, glWallPass);
+        glPass(res, frame, PASS_TEXT, glTextPass);
+    }
+    glPass(res, frame, PASS_PLUGINS, glPluginPass);
+    if (frame->hud) glHudPass(res, frame);
+}
+
+void glPresent(void* data, GLFWwindow* window) {
+    glfwSwapBuffers(window);
+}
+
+/*Whether the context went down with a device reset. The query is core from
+* 4.5, but the banner asks for a 3.3 context, where it comes from
+* KHR_robustness or the older ARB_robustness instead. A drill reports one
+* reset without a real one, so the bench can take the recovery path.
+*/
+int glLost(GLRES* res) {
+    if (res->drill) {
+        res->drill = 0;
+        return 1;
+    }
+    if ((GLAD_GL_VERSION_4_5 || GLAD_GL_KHR_robustness) && glGetGraphicsResetStatus != NULL) return glGetGraphicsResetStatus() != GL_NO_ERROR;
+    if (GLAD_GL_ARB_robustness && glGetGraphicsResetStatusARB != NULL) return glGetGraphicsResetStatusARB() != GL_NO_ERROR;
+    return 0;
+}
+
+/*Stops the GL backend's workers, frees its CPU-side state and hands shared
+* assets back. After a device reset the context is already gone, so the GL
+* objects go with it; cached images are owned by the cache and stay put for
+* the rebuild. Anything still registered to the context afterwards is a leak.
+*/
+void glShutdown(GLRES* res) {
+    unsigned int programs[6] = { res->BGprogram, res->bloom, res->assembly, res->fullbanner, res->textprog, res->dots };
+    for (int i = 0; i < 6; i++) releaseAsset(programs[i], 1, res->generation);
+    glReleaseSlides(res);
+    glReleaseSlideSet(res->staging, res->stagingClips, res->stagingCount, res->generation);
+    res->stagingDir = NULL;
+    res->stagingCount = 0;
+    res->stagingDone = 0;
+    releaseAsset(res->slideOverlay, 0, res->generation);
+    releaseAsset(res->dotMatrix, 0, res->generation);
+    closeWall(&res->wall);
+    closePlugins(&res->plugins);
+    res->themes.running = 0;
+    if (res->themes.thread != NULL) {
+        WaitForSingleObject(res->themes.thread, INFINITE);
+        CloseHandle(res->themes.thread);
+        CloseHandle(res->themes.signal);
+    }
+    if (!res->themes.persistent && res->themes.mapped != NULL) HeapFree(GetProcessHeap(), 0, res->themes.mapped);
+    for (int i = 0; i < themeCount; i++) {
+        THEMESLOT* slot = &res->themes.slots[i];
+        //Every map is allocated with the first upload
+        if (slot->uploaded == 0) continue;
+        for (int k = 0; k < THEME_MAPS; k++) if (slot->maps[k] != res->themes.flat[k]) gpuDelete(GPU_TEXTURE, 1, &slot->maps[k]);
+    }
+    gpuDelete(GPU_TEXTURE, THEME_MAPS, res->themes.flat);
+    gpuDelete(GPU_BUFFER, 1, &res->themes.pbo);
+    unsigned int buffers[7] = { res->VBO, res->EBO, res->oVBO, res->sVBO, res->tVBO, res->dVBO, res->sceneUBO };
+    unsigned int arrays[5] = { res->VAO, res->oVAO, res->sVAO, res->tVAO, res->dVAO };
+    gpuDelete(GPU_BUFFER, 7, buffers);
+    gpuDelete(GPU_VERTEXARRAY, 5, arrays);
+    gpuDelete(GPU_FRAMEBUFFER, 3, res->FBO);
+    gpuDelete(GPU_TEXTURE, 4, res->cbuffers);
+    gpuDelete(GPU_QUERY, TIMER_FRAMES * TIMER_MARKS, &res->timer.queries[0][0]);
+    gpuDelete(GPU_BUFFER, 1, &res->timer.VBO);
+    gpuDelete(GPU_VERTEXARRAY, 1, &res->timer.VAO);
+    gpuLeaks(glContext());
+}
+
+/*FreeType glyphs packed into one GLYPH_ATLAS square 8 bit coverage map, for
+* the backends that can't bind a texture per character.
+*/
+typedef struct atlasGlyph {
+    float u0, v0, u1, v1;
+    int width;
+    int height;
+    int left;
+    int top;
+    unsigned int advance;
+} ATLASGLYPH;
+
+unsigned char* buildGlyphAtlas(ATLASGLYPH* glyphs) {
+    FT_Library ft;
+    FT_Face face;
+    if (FT_Init_FreeType(&ft) || FT_New_Face(ft, "./fonts/Times New Roman Bold.ttf", 0, &face)) {
+        std::cout << "Couldn't load font." << std::endl;
+        return NULL;
+    }
+    FT_Set_Pixel_Sizes(face, 0, 92);
+    unsigned char* pixels = (unsigned char*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, GLYPH_ATLAS * GLYPH_ATLAS);
+    int x = 0, y = 0, row = 0;
+    for (unsigned char c = 0; c < 128; c++) {
+        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) continue;
+        FT_GlyphSlot g = face->glyph;
+        FT_Bitmap b = g->bitmap;
+        if (x + (int)b.width + 1 > GLYPH_ATLAS) {
+            x = 0;
+            y += row + 1;
+            row = 0;
+        }
+        if (y + (int)b.rows > GLYPH_ATLAS) break;
+        for (unsigned int r = 0; r < b.rows; r++) memcpy(pixels + (y + r) * GLYPH_ATLAS + x, b.buffer + r * b.pitch, b.width);
+        ATLASGLYPH* glyph = &glyphs[c];
+        glyph->u0 = (float)x / GLYPH_ATLAS;
+        glyph->v0 = (float)y / GLYPH_ATLAS;
+        glyph->u1 = (float)(x + b.width) / GLYPH_ATLAS;
+        glyph->v1 = (float)(y + b.rows) / GLYPH_ATLAS;
+        glyph->width = b.width;
+        glyph->height = b.rows;
+        glyph->left = g->bitmap_left;
+        glyph->top = g->bitmap_top;
+        glyph->advance = g->advance.x;
+        x += b.width + 1;
+        if ((int)b.rows > row) row = b.rows;
+    }
+    FT_Done_Face(face);
+    FT_Done_FreeType(ft);
+    return pixels;
+}
+
+/*Software backend, for venue PCs with a broken GPU driver and as a reference
+* for image tests. Renders at the FBO size into float planes, split into
+* SW_TILE row tiles that the worker threads pull off a shared counter.
+* The banner camera never moves, so every texture lookup the light shader
+* makes is baked per pixel when a theme goes in and the per-frame work is
+* pure math. A theme switch bakes the new maps on the spot, a stall of one
+* frame, then crossfades like the GPU backends.
+* Only swPresent touches the window, so the bench and the golden images run
+* it headless too.
+*/
+#if defined(__AVX2__)
+#define SW_LANES 8
+typedef __m256 vfloat;
+typedef __m256i vint;
+#define vset(x) _mm256_set1_ps(x)
+#define vload(p) _mm256_loadu_ps(p)
+#define vstore(p, v) _mm256_storeu_ps(p, v)
+#define vadd(a, b) _mm256_add_ps(a, b)
+#define vsub(a, b) _mm256_sub_ps(a, b)
+#define vmul(a, b) _mm256_mul_ps(a, b)
+#define vdiv(a, b) _mm256_div_ps(a, b)
+#define vmax(a, b) _mm256_max_ps(a, b)
+#define vmin(a, b) _mm256_min_ps(a, b)
+#define vsqrt(a) _mm256_sqrt_ps(a)
+#define vgt(a, b) _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+#define vand(a, b) _mm256_and_ps(a, b)
+#define vramp() _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f)
+#define vtoint(a) _mm256_cvttps_epi32(a)
+#define vshl(a, n) _mm256_slli_epi32(a, n)
+#define vor(a, b) _mm256_or_si256(a, b)
+#define viset(x) _mm256_set1_epi32(x)
+#define vistore(p, v) _mm256_storeu_si256((__m256i*)(p), v)
+#else
+#define SW_LANES 4
+typedef __m128 vfloat;
+typedef __m128i vint;
+#define vset(x) _mm_set1_ps(x)
+#define vload(p) _mm_loadu_ps(p)
+#define vstore(p, v) _mm_storeu_ps(p, v)
+#define vadd(a, b) _mm_add_ps(a, b)
+#define vsub(a, b) _mm_sub_ps(a, b)
+#define vmul(a, b) _mm_mul_ps(a, b)
+#define vdiv(a, b) _mm_div_ps(a, b)
+#define vmax(a, b) _mm_max_ps(a, b)
+#define vmin(a, b) _mm_min_ps(a, b)
+#define vsqrt(a) _mm_sqrt_ps(a)
+#define vgt(a, b) _mm_cmpgt_ps(a, b)
+#define vand(a, b) _mm_and_ps(a, b)
+#define vramp() _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f)
+#define vtoint(a) _mm_cvttps_epi32(a)
+#define vshl(a, n) _mm_slli_epi32(a, n)
+#define vor(a, b) _mm_or_si128(a, b)
+#define viset(x) _mm_set1_epi32(x)
+#define vistore(p, v) _mm_storeu_si128((__m128i*)(p), v)
+#endif
+
+typedef struct swTexture {
+    unsigned char* pixels;
+    int width;
+    int height;
+    CIMAGE* image;
+} SWTEXTURE;
+
+//Baked light inputs, one float plane per channel
+typedef struct swTheme {
+    int theme; //-1 until one is baked
+    float* diff[3];
+    float* norm[3];
+    float* smap[3];
+} SWTHEME;
+
+struct swData;
+typedef struct swJob {
+    struct swData* sw;
+    HANDLE thread;
+    HANDLE start;
+    HANDLE done;
+} SWJOB;
+
+typedef struct swData {
+    GLFWwindow* window;
+    int width;
+    int height;
+    int plane;
+    //[current] is the incoming theme, the other one is fading out
+    SWTHEME baked[2];
+    int current;
+    float fade;
+    volatile int* themeRequest;
+    SWTHEME* baking;
+    SWTEXTURE bakeMaps[THEME_MAPS];
+    float look[3]; //Specular intensity, ambience and bloom threshold, from the scene
+    float fpX0, fpDX;
+    float fpY0, fpDY;
+    //[bright] and [pong] are never live together, same trick as the Vulkan backend
+    float* lit[3];
+    float* bright[3];
+    float* ping[3];
+    float* pong[3];
+    float** src;
+    float** dst;
+    unsigned int* pixels; //0xAARRGGBB, bottom up like GL
+
+    SWTEXTURE overlay;
+    SWTEXTURE dotMatrix;
+    SWTEXTURE slides[32];
+    unsigned int slideCount;
+    unsigned char* atlas;
+    ATLASGLYPH glyphs[128];
+
+    FRAME* frame;
+    int pass;
+    int tileCount;
+    volatile LONG nextTile;
+    int workerCount;
+    volatile int running;
+    SWJOB jobs[SW_MAX_WORKERS];
+    HANDLE done[SW_MAX_WORKERS];
+} SWDATA;
+
+//Samples straight from the cache, so the image is held until swRelease
+int swTexture(SWTEXTURE* tex, const char* path) {
+    CIMAGE* image = cacheImage(path, 0);
+    if (image == NULL) {
+        errorCallback(-1, "Unable to load texture!");
+        return -1;
+    }
+    tex->image = image;
+    tex->pixels = image->pixels;
+    tex->width = image->width;
+    tex->height = image->height;
+    return 0;
+}
+
+void swRelease(SWTEXTURE* tex) {
+    releaseImage(tex->image);
+    *tex = {};
+}
+
+/*Bilinear with GL_REPEAT, which is what the GL textures end up with. Alpha
+* comes first; under [cutoff] the colour is left unset, which is most of the
+* dot matrix.
+*/
+void swSample(SWTEXTURE* tex, float u, float v, float* out, float cutoff) {
+    float x = (u - floorf(u)) * tex->width - 0.5f;
+    float y = (v - floorf(v)) * tex->height - 0.5f;
+    float fx = floorf(x), fy = floorf(y);
+    float ax = x - fx, ay = y - fy;
+    int x0 = (int)fx, y0 = (int)fy;
+    if (x0 < 0) x0 = tex->width - 1;
+    if (y0 < 0) y0 = tex->height - 1;
+    if (x0 >= tex->width) x0 = 0;
+    if (y0 >= tex->height) y0 = 0;
+    int x1 = x0 + 1 == tex->width ? 0 : x0 + 1;
+    int y1 = y0 + 1 == tex->height ? 0 : y0 + 1;
+    unsigned char* a = tex->pixels + (y0 * tex->width + x0) * 4;
+    unsigned char* b = tex->pixels + (y0 * tex->width + x1) * 4;
+    unsigned char* c = tex->pixels + (y1 * tex->width + x0) * 4;
+    unsigned char* d = tex->pixels + (y1 * tex->width + x1) * 4;
+    for (int i = 3; i >= 0; i--) {
+        float top = a[i] + (b[i] - a[i]) * ax;
+        float bottom = c[i] + (d[i] - c[i]) * ax;
+        out[i] = (top + (bottom - top) * ay) / 255.0f;
+        if (i == 3 && out[3] < cutoff) return;
+    }
+}
+
+unsigned int swPack(float r, float g, float b) {
+    return 0xFF000000 | ((unsigned int)(r * 255.0f + 0.5f) << 16) | ((unsigned int)(g * 255.0f + 0.5f) << 8) | (unsigned int)(b * 255.0f + 0.5f);
+}
+
+//light.fs's shade() for one theme, a vector of pixels at a time
+void swShade(SWDATA* sw, SWTHEME* baked, int i, vfloat fpx, vfloat fpy, vfloat* out) {
+    FRAME* frame = sw->frame;
+    float* lights[3] = { frame->rl, frame->gl, frame->bl };
+    float* colors[3] = { frame->rc, frame->gc, frame->bc };
+    vfloat one = vset(1.0f), zero = vset(0.0f), two = vset(2.0f);
+    vfloat nx = vload(baked->norm[0] + i), ny = vload(baked->norm[1] + i), nz = vload(baked->norm[2] + i);
+    vfloat acc[3] = { vset(sw->look[1]), vset(sw->look[1]), vset(sw->look[1]) };
+    vfloat spec = zero;
+    for (int l = 0; l < 3; l++) {
+        vfloat dx = vsub(vset(lights[l][0]), fpx);
+        vfloat dy = vsub(vset(lights[l][1]), fpy);
+        vfloat dz = vset(lights[l][2] + 1.0f);
+        vfloat inv = vdiv(one, vsqrt(vadd(vadd(vmul(dx, dx), vmul(dy, dy)), vmul(dz, dz))));
+        vfloat nd = vmul(vadd(vadd(vmul(nx, dx), vmul(ny, dy)), vmul(nz, dz)), inv);
+        //dot(dir, reflect(-dir, n)) == 2*dot(n, dir)^2 - 1
+        vfloat s = vmax(vsub(vmul(two, vmul(nd, nd)), one), zero);
+        s = vmul(s, s);
+        s = vmul(s, s);
+        spec = vadd(spec, vmul(s, s));
+        nd = vmax(nd, zero);
+        for (int c = 0; c < 3; c++) acc[c] = vadd(acc[c], vmul(nd, vset(colors[l][c])));
+    }
+    spec = vmul(spec, vset(sw->look[0]));
+    for (int c = 0; c < 3; c++) out[c] = vadd(vmul(acc[c], vload(baked->diff[c] + i)), vmul(spec, vload(baked->smap[c] + i)));
+}
+
+void swLightTile(SWDATA* sw, int y0, int y1) {
+    SWTHEME* current = &sw->baked[sw->current];
+    SWTHEME* previous = &sw->baked[!sw->current];
+    vfloat fade = vset(sw->fade), threshold = vset(sw->look[2]);
+    for (int y = y0; y < y1; y++) {
+        vfloat fpy = vset(sw->fpY0 + (y + 0.5f) * sw->fpDY);
+        for (int x = 0; x < sw->width; x += SW_LANES) {
+            int i = y * sw->width + x;
+            vfloat fpx = vadd(vset(sw->fpX0), vmul(vadd(vset((float)x), vramp()), vset(sw->fpDX)));
+            vfloat out[3];
+            swShade(sw, current, i, fpx, fpy, out);
+            //Only pay for the second theme while a crossfade is running
+            if (sw->fade < 1.0f) {
+                vfloat old[3];
+                swShade(sw, previous, i, fpx, fpy, old);
+                for (int c = 0; c < 3; c++) out[c] = vadd(old[c], vmul(vsub(out[c], old[c]), fade));
+            }
+            vfloat brightness = vadd(vadd(vmul(out[0], vset(0.2126f)), vmul(out[1], vset(0.7152f))), vmul(out[2], vset(0.0722f)));
+            vfloat mask = vgt(brightness, threshold);
+            for (int c = 0; c < 3; c++) {
+                vstore(sw->lit[c] + i, out[c]);
+                vstore(sw->bright[c] + i, vand(mask, out[c]));
+            }
+        }
+    }
+}
+
+//bloom.fs with GL_CLAMP_TO_EDGE, unfolded: the shader fetches its 9 taps as 5 linear samples, here they are read one by one
+void swBlurTile(SWDATA* sw, int y0, int y1, int horizontal) {
+    const float weight[5] = { 0.227027f, 0.1945946f, 0.1216216f, 0.054054f, 0.016216f };
+    int w = sw->width, h = sw->height;
+    for (int c = 0; c < 3; c++) {
+        float* src = sw->src[c];
+        float* dst = sw->dst[c];
+        for (int y = y0; y < y1; y++) {
+            float* row = src + y * w;
+            float* out = dst + y * w;
+            if (horizontal) {
+                int x = 0;
+                for (; x < 4; x++) {
+                    float r = row[x] * weight[0];
+                    for (int i = 1; i < 5; i++) r += (row[x + i] + row[x - i < 0 ? 0 : x - i]) * weight[i];
+                    out[x] = r;
+                }
+                for (; x + SW_LANES + 4 <= w; x += SW_LANES) {
+                    vfloat r = vmul(vload(row + x), vset(weight[0]));
+                    for (int i = 1; i < 5; i++) r = vadd(r, vmul(vadd(vload(row + x + i), vload(row + x - i)), vset(weight[i])));
+                    vstore(out + x, r);
+                }
+                for (; x < w; x++) {
+                    float r = row[x] * weight[0];
+                    for (int i = 1; i < 5; i++) r += (row[x + i >= w ? w - 1 : x + i] + row[x - i]) * weight[i];
+                    out[x] = r;
+                }
+            }else {
+                float* up[4];
+                float* down[4];
+                for (int i = 1; i < 5; i++) {
+                    up[i - 1] = src + (y + i >= h ? h - 1 : y + i) * w;
+                    down[i - 1] = src + (y - i < 0 ? 0 : y - i) * w;
+                }
+                for (int x = 0; x < w; x += SW_LANES) {
+                    vfloat r = vmul(vload(row + x), vset(weight[0]));
+                    for (int i = 1; i < 5; i++) r = vadd(r, vmul(vadd(vload(up[i - 1] + x), vload(down[i - 1] + x)), vset(weight[i])));
+                    vstore(out + x, r);
+                }
+            }
+        }
+    }
+}
+
+void swAssemblyTile(SWDATA* sw, int y0, int y1) {
+    vfloat zero = vset(0.0f), one = vset(1.0f), scale = vset(255.0f), half = vset(0.5f);
+    for (int y = y0; y < y1; y++) {
+        for (int x = 0; x < sw->width; x += SW_LANES) {
+            int i = y * sw->width + x;
+            vint p = viset(0xFF000000);
+            for (int c = 0; c < 3; c++) {
+                vfloat v = vmin(vmax(vadd(vload(sw->lit[c] + i), vload(sw->pong[c] + i)), zero), one);
+                p = vor(p, vshl(vtoint(vadd(vmul(v, scale), half)), 16 - 8 * c));
+            }
+            vistore(sw->pixels + i, p);
+        }
+    }
+}
+
+/*Textured parallelogram through vertices 0, 1 and 3 of a quadVertices entry,
+* already in pixel space, clipped to the rows of one tile. Texels under the
+* flat.fs alpha test are skipped.
+*/
+void swQuad(SWDATA* sw, SWTEXTURE* tex, float* quad, float (*pos)[2], float offs, int y0, int y1) {
+    float ax = pos[0][0], ay = pos[0][1];
+    float e1x = pos[3][0] - ax, e1y = pos[3][1] - ay;
+    float e2x = pos[1][0] - ax, e2y = pos[1][1] - ay;
+    float det = e1x * e2y - e1y * e2x;
+    if (det == 0.0f) return;
+    float su = quad[3], sv = quad[4];
+    float du1 = quad[18] - su, dv1 = quad[19] - sv;
+    float du2 = quad[8] - su, dv2 = quad[9] - sv;
+    for (int y = y0; y < y1; y++) {
+        float py = y + 0.5f - ay;
+        //s and t are affine in x, so solve for the covered span instead of testing the bounding box
+        float s0 = -py * e2x / det, sdx = e2y / det;
+        float t0 = e1x * py / det, tdx = -e1y / det;
+        float lo = -ax, hi = sw->width - ax;
+        float st[2][2] = { { s0, sdx }, { t0, tdx } };
+        for (int k = 0; k < 2; k++) {
+            if (st[k][1] == 0.0f) {
+                if (st[k][0] < 0.0f || st[k][0] > 1.0f) lo = hi;
+                continue;
+            }
+            float a = -st[k][0] / st[k][1], b = (1.0f - st[k][0]) / st[k][1];
+            if (a > b) std::swap(a, b);
+            if (a > lo) lo = a;
+            if (b < hi) hi = b;
+        }
+        int xs = (int)ceilf(lo + ax - 0.5f), xe = (int)floorf(hi + ax - 0.5f);
+        if (xs < 0) xs = 0;
+        if (xe > sw->width - 1) xe = sw->width - 1;
+        unsigned int* out = sw->pixels + y * sw->width;
+        for (int x = xs; x <= xe; x++) {
+            float px = x + 0.5f - ax;
+            float s = s0 + px * sdx, t = t0 + px * tdx;
+            float texel[4];
+            swSample(tex, su + s * du1 + t * du2, sv + s * dv1 + t * dv2 + offs, texel, 0.8f);
+            if (texel[3] < 0.8f) continue;
+            out[x] = swPack(texel[0], texel[1], texel[2]);
+        }
+    }
+}
+
+void swText(SWDATA* sw, char* message, float x, float y, float size, unsigned int color, int y0, int y1) {
+    float xinit = x;
+    for (char* c = message; *c != '\0'; c++) {
+        if (*c == '\n') {
+            x = xinit;
+            y += 68;
+        }
+        ATLASGLYPH g = sw->glyphs[*c & 0x7f];
+        float xpos = x + g.left * size;
+        float ypos = y - (g.height - g.top) * size;
+        float w = g.width * size;
+        float h = g.height * size;
+        x += (g.advance >> 6) * size;
+        int xs = (int)ceilf(xpos - 0.5f), xe = (int)ceilf(xpos + w - 0.5f);
+        int ys = (int)ceilf(ypos - 0.5f), ye = (int)ceilf(ypos + h - 0.5f);
+        if (ys < y0) ys = y0;
+        if (ye > y1) ye = y1;
+        if (xs < 0) xs = 0;
+        if (xe > sw->width) xe = sw->width;
+        for (int py = ys; py < ye; py++) {
+            //Glyph rows run top down, the frame runs bottom up
+            float v = g.v0 + (1.0f - (py + 0.5f - ypos) / h) * (g.v1 - g.v0);
+            float ty = v * GLYPH_ATLAS - 0.5f;
+            int ty0 = (int)floorf(ty);
+            float ay = ty - ty0;
+            if (ty0 < 0) ty0 = 0;
+            int ty1 = ty0 + 1 < GLYPH_ATLAS ? ty0 + 1 : ty0;
+            for (int px = xs; px < xe; px++) {
+                float u = g.u0 + (px + 0.5f - xpos) / w * (g.u1 - g.u0);
+                float tx = u * GLYPH_ATLAS - 0.5f;
+                int tx0 = (int)floorf(tx);
+                float ax = tx - tx0;
+                if (tx0 < 0) tx0 = 0;
+                int tx1 = tx0 + 1 < GLYPH_ATLAS ? tx0 + 1 : tx0;
+                unsigned char* a = sw->atlas + ty0 * GLYPH_ATLAS;
+                unsigned char* b = sw->atlas + ty1 * GLYPH_ATLAS;
+                float top = a[tx0] + (a[tx1] - a[tx0]) * ax;
+                float bottom = b[tx0] + (b[tx1] - b[tx0]) * ax;
+                if (top + (bottom - top) * ay < 0.9f * 255.0f) continue;
+                sw->pixels[py * sw->width + px] = color;
+            }
+        }
+    }
+}
+
+void swToPixels(SWDATA* sw, float* quad, glm::mat4* transform, float xOffs, float flip, float (*pos)[2]) {
+    for (int v = 0; v < 4; v++) {
+        glm::vec4 p = glm::vec4(quad[v * 5], quad[v * 5 + 1], quad[v * 5 + 2], 1.0f);
+        if (transform != NULL) p = *transform * p;
+        pos[v][0] = (p.x + xOffs + 1.0f) * 0.5f * sw->width;
+        pos[v][1] = (p.y * flip + 1.0f) * 0.5f * sw->height;
+    }
+}
+
+void swSlideshowTile(SWDATA* sw, int y0, int y1) {
+    FRAME* frame = sw->frame;
+    for (int y = y0; y < y1; y++) for (int x = 0; x < sw->width; x++) sw->pixels[y * sw->width + x] = 0xFFFFFFFF;
+    float pos[4][2];
+    glm::mat4 rotation = dotRotation(PI / 3, sw->width, sw->height);
+    swToPixels(sw, quadVertices[Q_DOTS], &rotation, 0.0f, 1.0f, pos);
+    swQuad(sw, &sw->dotMatrix, quadVertices[Q_DOTS], pos, frame->dotOffset, y0, y1);
+    rotation = dotRotation(PI * 7 / 6, sw->width, sw->height);
+    swToPixels(sw, quadVertices[Q_DOTS], &rotation, 0.0f, 1.0f, pos);
+    swQuad(sw, &sw->dotMatrix, quadVertices[Q_DOTS], pos, frame->dotOffset, y0, y1);
+    if (sw->slideCount > 0) {
+        swToPixels(sw, quadVertices[Q_SLIDE], NULL, -frame->slideTransition, -1.0f, pos);
+        swQuad(sw, &sw->slides[frame->slide], quadVertices[Q_SLIDE], pos, 0.0f, y0, y1);
+        swToPixels(sw, quadVertices[Q_SLIDE], NULL, -frame->slideTransition + 2.0f, -1.0f, pos);
+        swQuad(sw, &sw->slides[frame->nextSlide], quadVertices[Q_SLIDE], pos, 0.0f, y0, y1);
+    }
+    swToPixels(sw, quadVertices[Q_OVERLAY], NULL, 0.0f, -1.0f, pos);
+    swQuad(sw, &sw->overlay, quadVertices[Q_OVERLAY], pos, 0.0f, y0, y1);
+    swText(sw, frame->clock, 100, sw->height - 50, 0.5f, 0xFFFFFFFF, y0, y1);
+    swText(sw, frame->showtime, 100, sw->height - 105, 0.5f, 0xFFFFFFFF, y0, y1);
+    swText(sw, frame->venue, 650, sw->height - 90, 0.7f, swPack(0.97647f, 0.92549f, 0.35686f), y0, y1);
+}
+
+//Samples the theme maps in bakeMaps where bgmain.vs puts the banner quad; outside it is black
+void swBakeTile(SWDATA* sw, int y0, int y1) {
+    SWTHEME* baked = sw->baking;
+    for (int y = y0; y < y1; y++) {
+        float fy = sw->fpY0 + (y + 0.5f) * sw->fpDY;
+        for (int x = 0; x < sw->width; x++) {
+            int i = y * sw->width + x;
+            float fx = sw->fpX0 + (x + 0.5f) * sw->fpDX;
+            float d[4] = {}, n[4] = { 0.5f, 0.5f, 1.0f, 1.0f }, s[4] = {};
+            if (fx >= -1.0f && fx <= 1.0f && fy >= -1.0f && fy <= 1.0f) {
+                swSample(&sw->bakeMaps[0], (fx + 1.0f) * 0.5f, (1.0f - fy) * 0.5f, d, 0.0f);
+                swSample(&sw->bakeMaps[1], (fx + 1.0f) * 0.5f, (1.0f - fy) * 0.5f, n, 0.0f);
+                swSample(&sw->bakeMaps[2], (fx + 1.0f) * 0.5f, (1.0f - fy) * 0.5f, s, 0.0f);
+            }
+            float nx = (n[0] - 0.5f) * 2.0f, ny = (n[1] - 0.5f) * 2.0f, nz = (n[2] - 0.5f) * 2.0f;
+            float len = sqrtf(nx * nx + ny * ny + nz * nz);
+            if (len <= 0.0f) {
+                nx = ny = 0.0f;
+                nz = len = 1.0f;
+            }
+            baked->norm[0][i] = nx / len;
+            baked->norm[1][i] = ny / len;
+            baked->norm[2][i] = nz / len;
+            for (int c = 0; c < 3; c++) {
+                baked->diff[c][i] = d[c];
+                baked->smap[c][i] = s[c];
+            }
+        }
+    }
+}
+
+DWORD WINAPI SoftwareWorker(LPVOID lpParam) {
+    SWJOB* job = (SWJOB*)lpParam;
+    SWDATA* sw = job->sw;
+    while (true) {
+        WaitForSingleObject(job->start, INFINITE);
+        if (!sw->running) break;
+        LONG tile;
+        while ((tile = InterlockedIncrement(&sw->nextTile) - 1) < sw->tileCount) {
+            int y0 = tile * SW_TILE;
+            int y1 = y0 + SW_TILE > sw->height ? sw->height : y0 + SW_TILE;
+            switch (sw->pass) {
+            case SW_LIGHT:
+                swLightTile(sw, y0, y1);
+                break;
+            case SW_BLUR_H:
+                swBlurTile(sw, y0, y1, TRUE);
+                break;
+            case SW_BLUR_V:
+                swBlurTile(sw, y0, y1, FALSE);
+                break;
+            case SW_ASSEMBLY:
+                swAssemblyTile(sw, y0, y1);
+                break;
+            case SW_SLIDESHOW:
+                swSlideshowTile(sw, y0, y1);
+                break;
+            case SW_BAKE:
+                swBakeTile(sw, y0, y1);
+                break;
+            }
+        }
+        SetEvent(job->done);
+    }
+    return 0;
+}
+
+void swDispatch(SWDATA* sw, int pass, float** src, float** dst) {
+    sw->pass = pass;
+    sw->src = src;
+    sw->dst = dst;
+    sw->nextTile = 0;
+    for (int j = 0; j < sw->workerCount; j++) SetEvent(sw->jobs[j].start);
+    WaitForMultipleObjects(sw->workerCount, sw->done, TRUE, INFINITE);
+}
+
+float* swPlane(SWDATA* sw) {
+    return (float*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sw->plane * sizeof(float));
+}
+
+/*Bakes a theme across the workers; a map the theme lacks bakes flat, as the
+* GL fallback textures do. The planes for the second theme are only made at
+* the first switch, so a show that never switches never pays for them.
+*/
+int swBake(SWDATA* sw, SWTHEME* baked, int theme) {
+    static unsigned char flat[THEME_MAPS][4] = { { 255, 255, 255, 255 }, { 128, 128, 255, 255 }, { 0, 0, 0, 255 } };
+    for (int c = 0; c < 3 && baked->smap[2] == NULL; c++) {
+        if (baked->diff[c] == NULL) baked->diff[c] = swPlane(sw);
+        if (baked->norm[c] == NULL) baked->norm[c] = swPlane(sw);
+        if (baked->smap[c] == NULL) baked->smap[c] = swPlane(sw);
+        if (!baked->diff[c] || !baked->norm[c] || !baked->smap[c]) {
+            errorCallback(-1, "Unable to allocate theme planes!");
+            return -1;
+        }
+    }
+    int status = 0;
+    for (int k = 0; k < THEME_MAPS; k++) sw->bakeMaps[k] = { flat[k], 1, 1, NULL };
+    for (int k = 0; k < THEME_MAPS && status == 0; k++) if (themeTable[theme].maps[k] != NULL) status = swTexture(&sw->bakeMaps[k], themeTable[theme].maps[k]);
+    if (status == 0) {
+        sw->baking = baked;
+        swDispatch(sw, SW_BAKE, NULL, NULL);
+        baked->theme = theme;
+    }
+    for (int k = 0; k < THEME_MAPS; k++) if (sw->bakeMaps[k].image != NULL) swRelease(&sw->bakeMaps[k]);
+    return status;
+}
+
+int swInit(void* data, GLFWwindow* window, int width, int height) {
+    SWDATA* sw = (SWDATA*)data;
+    sw->window = window;
+    //Rows are a whole number of vectors so no kernel needs a scalar tail
+    width = (width + SW_LANES - 1) / SW_LANES * SW_LANES;
+    sw->width = width;
+    sw->height = height;
+    sw->plane = width * height;
+    sw->baked[0].theme = -1;
+    sw->baked[1].theme = -1;
+    for (int c = 0; c < 3; c++) {
+        sw->lit[c] = swPlane(sw);
+        sw->bright[c] = swPlane(sw);
+        sw->ping[c] = swPlane(sw);
+        sw->pong[c] = sw->bright[c];
+        if (!sw->lit[c] || !sw->bright[c] || !sw->ping[c]) return -1;
+    }
+    sw->pixels = (unsigned int*)HeapAlloc(GetProcessHeap(), 0, sw->plane * sizeof(unsigned int));
+    if (sw->pixels == NULL) return -1;
+
+    std::cout << "Generating Textures..." << std::endl;
+    if (swTexture(&sw->overlay, "./img/90banner.png") || swTexture(&sw->dotMatrix, "./img/dotmatrix.png")) return -1;
+
+    //Where bgmain.vs puts the banner quad; w is the same for every vertex so the mapping is affine
+    glm::mat4 pm = glm::transpose(glm::perspective(2.65625f, (1.0f * width) / height, 0.1f, 100.0f));
+    glm::vec4 c0 = pm * glm::vec4(-1.0f, -1.0f, -1.0f, 1.0f);
+    glm::vec4 c2 = pm * glm::vec4(1.0f, 1.0f, -1.0f, 1.0f);
+    float x0 = (c0.x / c0.w + 1.0f) * 0.5f * width, x1 = (c2.x / c2.w + 1.0f) * 0.5f * width;
+    float y0 = (c0.y / c0.w + 1.0f) * 0.5f * height, y1 = (c2.y / c2.w + 1.0f) * 0.5f * height;
+    sw->fpDX = 2.0f / (x1 - x0);
+    sw->fpX0 = -1.0f - x0 * sw->fpDX;
+    sw->fpDY = 2.0f / (y1 - y0);
+    sw->fpY0 = -1.0f - y0 * sw->fpDY;
+
+    std::cout << "Loading font..." << std::endl;
+    sw->atlas = buildGlyphAtlas(sw->glyphs);
+    if (sw->atlas == NULL) return -1;
+    char slidePath[60];
+    std::ifstream slideFile;
+    for (sw->slideCount = 0; sw->slideCount < 32; sw->slideCount++) {
+        sprintf_s(slidePath, "%s/s%d.png", slideDir, sw->slideCount);
+        slideFile.open(slidePath);
+        if (!slideFile.is_open()) break;
+        slideFile.close();
+        if (swTexture(&sw->slides[sw->slideCount], slidePath)) return -1;
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    sw->workerCount = info.dwNumberOfProcessors > SW_MAX_WORKERS ? SW_MAX_WORKERS : info.dwNumberOfProcessors;
+    if (sw->workerCount < 1) sw->workerCount = 1;
+    sw->tileCount = (height + SW_TILE - 1) / SW_TILE;
+    sw->running = 1;
+    for (int j = 0; j < sw->workerCount; j++) {
+        sw->jobs[j].sw = sw;
+        sw->jobs[j].start = CreateEventA(NULL, FALSE, FALSE, NULL);
+        sw->jobs[j].done = CreateEventA(NULL, FALSE, FALSE, NULL);
+        sw->done[j] = sw->jobs[j].done;
+        DWORD workerID;
+        sw->jobs[j].thread = CreateThread(NULL, 0, SoftwareWorker, &sw->jobs[j], 0, &workerID);
+    }
+    std::cout << "Software renderer: " << sw->workerCount << " threads, " << SW_LANES << " lanes." << std::endl;
+
+    //The opening theme bakes before the show starts, on the workers
+    int first = *sw->themeRequest;
+    if (first < 0 || first >= themeCount) first = 0;
+    if (swBake(sw, &sw->baked[0], first)) return -1;
+    sw->current = 0;
+    sw->fade = 1.0f;
+    *sw->themeRequest = first;
+    return 0;
+}
+
+void swDrawFrame(void* data, FRAME* frame) {
+    SWDATA* sw = (SWDATA*)data;
+    sw->frame = frame;
+    //Themes switch and crossfade the way themeFrame does it, the loading done in place
+    int request = *sw->themeRequest;
+    SWTHEME* shown = &sw->baked[sw->current];
+    if (request >= 0 && request < themeCount && request != shown->theme) {
+        SWTHEME* next = &sw->baked[!sw->current];
+        if (next->theme == request || !swBake(sw, next, request)) {
+            sw->current = !sw->current;
+            sw->fade = 0.0f;
+            std::cout << "Theme switched to " << themeTable[request].name << std::endl;
+        }else *sw->themeRequest = shown->theme;
+    }
+    if (sw->fade < 1.0f) {
+        sw->fade += (float)(frame->dt / THEME_FADE);
+        if (sw->fade >= 1.0f) sw->fade = 1.0f;
+    }
+    if (!frame->slideshow) {
+        SCENEBLOCK at;
+        scenePosition(frame->scene, &at);
+        for (int i = 0; i < 3; i++) sw->look[i] = at.look[i];
+        swDispatch(sw, SW_LIGHT, NULL, NULL);
+        swDispatch(sw, SW_BLUR_H, sw->bright, sw->ping);
+        swDispatch(sw, SW_BLUR_V, sw->ping, sw->pong);
+        for (int i = 0; i < BLOOM_PASSES; i++) {
+            swDispatch(sw, SW_BLUR_H, sw->pong, sw->ping);
+            swDispatch(sw, SW_BLUR_V, sw->ping, sw->pong);
+        }
+        swDispatch(sw, SW_ASSEMBLY, NULL, NULL);
+    }else swDispatch(sw, SW_SLIDESHOW, NULL, NULL);
+}
+
+//Stops the workers and frees what swInit made
+void swShutdown(SWDATA* sw) {
+    sw->running = 0;
+    for (int j = 0; j < sw->workerCount; j++) SetEvent(sw->jobs[j].start);
+    for (int j = 0; j < sw->workerCount; j++) {
+        WaitForSingleObject(sw->jobs[j].thread, INFINITE);
+        CloseHandle(sw->jobs[j].thread);
+        CloseHandle(sw->jobs[j].start);
+        CloseHandle(sw->jobs[j].done);
+    }
+    for (int c = 0; c < 3; c++) {
+        for (int b = 0; b < 2; b++) {
+            HeapFree(GetProcessHeap(), 0, sw->baked[b].diff[c]);
+            HeapFree(GetProcessHeap(), 0, sw->baked[b].norm[c]);
+            HeapFree(GetProcessHeap(), 0, sw->baked[b].smap[c]);
+        }
+        HeapFree(GetProcessHeap(), 0, sw->lit[c]);
+        HeapFree(GetProcessHeap(), 0, sw->bright[c]);
+        HeapFree(GetProcessHeap(), 0, sw->ping[c]);
+    }
+    HeapFree(GetProcessHeap(), 0, sw->pixels);
+    HeapFree(GetProcessHeap(), 0, sw->atlas);
+    swRelease(&sw->overlay);
+    swRelease(&sw->dotMatrix);
+    for (unsigned int i = 0; i < sw->slideCount; i++) swRelease(&sw->slides[i]);
+    *sw = {};
+}
+
+/*Offscreen benchmark, run with -bench; it is all the headless Linux build
+* does. Each scene is drawn through the real GL passes into an RGBA8 target
+* at each size, on a fixed 60 Hz clock. CPU time is building and submitting
+* the frame; GPU time is a pair of timestamps around it, read back BENCH_LAG
+* frames later much as a swap chain would hold the render thread back. The
+* first BENCH_WARMUP frames of a run are left out of the percentiles. Each
+* pass is timed on its own as well, through the HUD's pass timer, so one
+* expensive pass cannot hide a regression in a cheap one.
+* Every frame makes GLmain's glLost check, and a reset reported mid-run fails
+* the run. After its frames each run drills a reset through that check, tears
+* the GL side down and rebuilds it the way GLmain does; a recovery slower
+* than RECOVERY_TARGET ms fails the bench.
+*
+* With -software the scenes go through the software renderer instead and
+* the CPU time is the whole frame. A run at 1080p or more below SW_TARGET_FPS
+* fails, but only on a machine with SW_TARGET_CORES cores or more, which is
+* what the target was set for.
+*
+*   -bench [frames] [-size WxH]... [-scene name]... [-out file] [-software]
+*          [-baseline file [-slower percent] [-update]]
+*   -bench -golden dir [-diff dir] [-update]
+*   -bench -replay file ... (see the show journal below)
+*
+* Scenes are banner, slideshow and three stress scenes generated under
+* BENCH_DIR: slides (SLIDE_MAX slides, every eighth an animated raw clip,
+* cycling without a pause), text (a full-length venue name over a wall
+* fed WALL_PENDING long posts) and wall, where the feed starts empty and
+* BENCH_BURST posts arrive once warmup is over. The wall scene runs paced
+* at 60 Hz like a show; every frame from the burst arriving to its last card
+* landing in the atlas has to stay inside BENCH_BUDGET ms of CPU and GPU
+* time, and the whole burst has to land before the run ends. Frames over
+* budget only count with BENCH_WALL_CORES cores or more, since on one core
+* the baker can only run in the render thread's time.
+*/
+typedef struct benchStats {
+    float mean;
+    float p50;
+    float p90;
+    float p95;
+    float p99;
+    float max;
+} BSTATS;
+
+typedef struct benchRun {
+    int scene;
+    int width;
+    int height;
+    int frames;
+    int slides;
+    float loadMs;
+    float recoveryMs;
+    int landed;
+    int burstFrames;
+    int dropped;
+    float* cpu;
+    float* gpu;
+    int gpuCount;
+    float* passes; //PASS_COUNT rows of frames samples
+    int passCount;
+    BSTATS cpuMs;
+    BSTATS gpuMs;
+    BSTATS passMs[PASS_COUNT];
+} BRUN;
+
+const char* benchScenes[BENCH_SCENES] = { "banner", "slideshow", "slides", "text", "wall" };
+const char* benchOut = BENCH_OUT;
+char benchDevice[128];
+char benchVersion[128];
+GLFWwindow* benchWindow = NULL;
+#ifdef NNB_HEADLESS
+EGLDisplay benchDisplay = EGL_NO_DISPLAY;
+EGLContext benchEgl = EGL_NO_CONTEXT;
+#endif
+
+int benchContext() {
+#ifdef NNB_HEADLESS
+    //Mesa's surfaceless platform needs neither a display server nor a GPU
+    PFNEGLGETPLATFORMDISPLAYEXTPROC platformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (platformDisplay != NULL) benchDisplay = platformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    if (benchDisplay != EGL_NO_DISPLAY && eglInitialize(benchDisplay, NULL, NULL) && eglBindAPI(EGL_OPENGL_API)) {
+        EGLint attributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_CONTEXT_OPENGL_DEBUG, glDebug ? EGL_TRUE : EGL_FALSE,
+            EGL_NONE
+        };
+        benchEgl = eglCreateContext(benchDisplay, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+        if (benchEgl != EGL_NO_CONTEXT && eglMakeCurrent(benchDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, benchEgl)) return 0;
+    }
+    errorCallback(-1, "No surfaceless EGL context, trying OSMesa.");
+#endif
+    glfwDefaultWindowHints();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, glDebug ? GLFW_TRUE : GLFW_FALSE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+#ifdef NNB_HEADLESS
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+#endif
+    benchWindow = glfwCreateWindow(64, 64, "Banner Bench", NULL, NULL);
+    if (benchWindow == NULL) return -1;
+    glfwMakeContextCurrent(benchWindow);
+    return 0;
+}
+
+void benchClose() {
+#ifdef NNB_HEADLESS
+    if (benchEgl != EGL_NO_CONTEXT) {
+        eglMakeCurrent(benchDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(benchDisplay, benchEgl);
+    }
+    if (benchDisplay != EGL_NO_DISPLAY) eglTerminate(benchDisplay);
+#endif
+    if (benchWindow != NULL) glfwDestroyWindow(benchWindow);
+}
+
+//Diagonal bands, different for every seed, so neighbouring slides never match
+void benchPattern(unsigned char* pixels, int w, int h, int seed) {
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            unsigned char* p = pixels + ((size_t)y * w + x) * 4;
+            int band = ((x + y + seed * 37) / 48) & 7;
+            p[0] = (unsigned char)(band * 32 + seed * 13);
+            p[1] = (unsigned char)(x * 255 / w);
+            p[2] = (unsigned char)(y * 255 / h + seed * 29);
+            p[3] = 255;
+        }
+    }
+}
+
+//Deterministic, so a set left by an earlier run is reused as it is
+int benchSlides() {
+    char path[MAX_PATH];
+    std::ifstream existing(BENCH_DIR "/slides/s31.raw");
+    if (existing.is_open()) return 0;
+    CreateDirectoryA(BENCH_DIR, NULL);
+    CreateDirectoryA(BENCH_DIR "/slides", NULL);
+    //The size of the stock slides
+    int w = 1920, h = 827;
+    unsigned char* pixels = (unsigned char*)HeapAlloc(GetProcessHeap(), 0, (size_t)w * h * 4);
+    if (pixels == NULL) return -1;
+    stbi_write_png_compression_level = 1;
+    for (int s = 0; s < SLIDE_MAX; s++) {
+        if (s % 8 != 7) {
+            benchPattern(pixels, w, h, s);
+            sprintf_s(path, "%s/slides/s%d.png", BENCH_DIR, s);
+            if (!stbi_write_png(path, w, h, 4, pixels, w * 4)) break;
+            continue;
+        }
+        sprintf_s(path, "%s/slides/s%d.raw", BENCH_DIR, s);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) break;
+        unsigned char header[CLIP_HEADER] = {};
+        CLIPHEADER* clip = (CLIPHEADER*)header;
+        memcpy(clip->magic, "NNBF", 4);
+        clip->width = BENCH_CLIP_W;
+        clip->height = BENCH_CLIP_H;
+        clip->frames = BENCH_CLIP_FRAMES;
+        clip->fps = CLIP_FPS;
+        file.write((char*)header, CLIP_HEADER);
+        for (int f = 0; f < BENCH_CLIP_FRAMES; f++) {
+            benchPattern(pixels, BENCH_CLIP_W, BENCH_CLIP_H, s + f);
+            file.write((char*)pixels, (std::streamsize)BENCH_CLIP_W * BENCH_CLIP_H * 4);
+        }
+    }
+    HeapFree(GetProcessHeap(), 0, pixels);
+    std::ifstream last(BENCH_DIR "/slides/s31.raw");
+    if (!last.is_open()) {
+        errorCallback(-1, "Unable to write the stress slides!");
+        return -1;
+    }
+    return 0;
+}
+
+int benchFeed(const char* path, int posts) {
+    CreateDirectoryA(BENCH_DIR, NULL);
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) return -1;
+    const char* words = "tonight the whole room sang every word back to the stage and we will remember it ";
+    file << "[" << std::endl;
+    for (int i = 0; i < posts; i++) {
+        char text[300] = "";
+        int length = 0;
+        while (length < (int)sizeof(text) - 90) length += sprintf_s(text + length, sizeof(text) - length, "%s", words);
+        file << "    {\"id\":\"bench" << i << "\",\"author\":\"Bench Fan " << i << "\",\"text\":\"" << text << i << "\"}"
+            << (i + 1 < posts ? "," : "") << std::endl;
+    }
+    file << "]" << std::endl;
+    return 0;
+}
+
+int benchCompare(const void* a, const void* b) {
+    float x = *(const float*)a, y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+//Nearest rank on sorted samples
+float benchPercentile(float* sorted, int count, int p) {
+    int rank = (p * count + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+void benchStats(float* samples, int count, BSTATS* stats) {
+    *stats = {};
+    if (count == 0) return;
+    qsort(samples, count, sizeof(float), benchCompare);
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += samples[i];
+    stats->mean = (float)(sum / count);
+    stats->p50 = benchPercentile(samples, count, 50);
+    stats->p90 = benchPercentile(samples, count, 90);
+    stats->p95 = benchPercentile(samples, count, 95);
+    stats->p99 = benchPercentile(samples, count, 99);
+    stats->max = samples[count - 1];
+}
+
+//Blocks until the GPU is done with that frame, which is BENCH_LAG frames back
+void benchCollect(BRUN* run, unsigned int* queries, int index) {
+    GLuint64 start = 0, end = 0;
+    glGetQueryObjectui64v(queries[0], GL_QUERY_RESULT, &start);
+    glGetQueryObjectui64v(queries[1], GL_QUERY_RESULT, &end);
+    if (index >= BENCH_WARMUP) run->gpu[run->gpuCount++] = (end - start) / 1000000.0f;
+}
+
+//Same defaults as a fresh stage, without AUTOSTART so the mode holds
+void benchData(TDATA* data, int scene, int metaposts) {
+    data->data[D_COLOR1] = C_RED;
+    data->data[D_COLOR2] = C_GREEN;
+    data->data[D_COLOR3] = C_BLUE;
+    data->data[D_FLAGS] = F_BASELIGHT | (metaposts ? F_METAPOSTS : 0) | (scene != BENCH_BANNER ? F_SLIDESHOW_MODE : 0);
+    *(int*)(data->data + D_DOWNBEAT) = 1200;
+    if (scene == BENCH_TEXT) {
+        int length = 0;
+        while (length < D_NAMESIZE - 1) length += sprintf_s(data->data + D_VENUENAME + length, D_NAMESIZE - length, "%s", "The Long Benchmark Venue ");
+    }else sprintf_s(data->data + D_VENUENAME, D_NAMESIZE, "Your Venue Name Here");
+    slideDir = scene == BENCH_SLIDES ? BENCH_DIR "/slides" : SLIDE_DIR;
+    wallFeed = scene == BENCH_TEXT ? BENCH_DIR "/feed.json" : scene == BENCH_WALL ? BENCH_DIR "/wall.json" : WALL_FEED;
+}
+
+//glInit plus an RGBA8 target of the given size in place of the window's framebuffer
+int benchOpen(GLRES* res, volatile int* themeRequest, int theme, int width, int height, unsigned int* fbo, unsigned int* color) {
+    *themeRequest = theme;
+    res->themes.request = themeRequest;
+    if (glInit(res, NULL, width, height)) return -1;
+    if (benchDevice[0] == '\0') {
+        jsonEscape((const char*)glGetString(GL_RENDERER), benchDevice, sizeof(benchDevice));
+        jsonEscape((const char*)glGetString(GL_VERSION), benchVersion, sizeof(benchVersion));
+    }
+    gpuCreate(GPU_FRAMEBUFFER, 1, fbo, "bench");
+    gpuCreate(GPU_RENDERBUFFER, 1, color, "bench");
+    glBindRenderbuffer(GL_RENDERBUFFER, *color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    gpuStorage(GPU_RENDERBUFFER, *color, GL_RGBA8, gpuTextureBytes(GL_RGBA8, width, height, 0));
+    glBindFramebuffer(GL_FRAMEBUFFER, *fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, *color);
+    int complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    res->target = *fbo;
+    if (!complete) errorCallback(-1, "Bench framebuffer incomplete!");
+    return complete ? 0 : 1;
+}
+
+void benchRelease(GLRES* res, unsigned int* fbo, unsigned int* color) {
+    gpuDelete(GPU_FRAMEBUFFER, 1, fbo);
+    gpuDelete(GPU_RENDERBUFFER, 1, color);
+    glShutdown(res);
+}
+
+int benchRun(BRUN* run, TDATA* data) {
+    volatile int themeRequest;
+    GLRES res = {};
+    unsigned int fbo, color;
+    double started = glfwGetTime();
+    int status = benchOpen(&res, &themeRequest, 0, run->width, run->height, &fbo, &color);
+    if (status < 0) return -1;
+    unsigned int queries[BENCH_LAG][2];
+    gpuCreate(GPU_QUERY, BENCH_LAG * 2, &queries[0][0], "bench");
+    glFinish();
+    run->loadMs = (float)((glfwGetTime() - started) * 1000);
+    run->slides = res.slideCount;
+
+    SCENE scene;
+    startScene(&scene);
+    ANIMATION anim;
+    startAnimation(&anim);
+    FRAME frame = {};
+    frame.width = run->width;
+    frame.height = run->height;
+    int total = status == 0 ? BENCH_WARMUP + run->frames : 0;
+    float cpuMs = 0.0f;
+    int burst = -1;
+    int folded = 0;
+    frame.timing = 1;
+    std::chrono::high_resolution_clock::time_point tick = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < total; i++) {
+        int slot = i % BENCH_LAG;
+        //GLmain's check, every frame; nothing should trip it here
+        if (glLost(&res)) {
+            errorCallback(-1, "Bench context reported a device reset!");
+            total = i;
+            status = 1;
+            break;
+        }
+        if (run->scene == BENCH_WALL) {
+            //Paced like a show, so the baker gets the time between frames it would have
+            tick += std::chrono::microseconds(1000000 / 60);
+            std::chrono::high_resolution_clock::duration wait = tick - std::chrono::high_resolution_clock::now();
+            if (wait.count() > 0) Sleep((DWORD)std::chrono::duration_cast<std::chrono::milliseconds>(wait).count());
+            if (i == BENCH_WARMUP && benchFeed(BENCH_DIR "/wall.json", BENCH_BURST) == 0) burst = i;
+            if (burst >= 0 && run->landed < BENCH_BURST) run->burstFrames = i - burst + 1;
+            run->landed = (int)res.wall.landed;
+        }
+        if (i >= BENCH_LAG) benchCollect(run, queries[slot], i - BENCH_LAG);
+        std::chrono::high_resolution_clock::time_point before = std::chrono::high_resolution_clock::now();
+        buildFrame(&frame, &anim, data->data, &scene, res.slideCount, 1.0 / 60, BENCH_CLOCK + i / 60);
+        frame.hud = 0;
+        frame.cpuMs = cpuMs;
+        glQueryCounter(queries[slot][0], GL_TIMESTAMP);
+        glDrawFrame(&res, &frame);
+        glQueryCounter(queries[slot][1], GL_TIMESTAMP);
+        glFlush();
+        std::chrono::high_resolution_clock::time_point after = std::chrono::high_resolution_clock::now();
+        cpuMs = (float)(std::chrono::duration_cast<std::chrono::duration<double>>(after - before).count() * 1000);
+        if (i >= BENCH_WARMUP) run->cpu[i - BENCH_WARMUP] = cpuMs;
+        //The pass timer lands a few frames behind, so warmup frames are over by the time it is sampled
+        if (res.timer.folded != folded && i >= BENCH_WARMUP && run->passCount < run->frames) {
+            for (int p = 0; p < PASS_COUNT; p++) run->passes[p * run->frames + run->passCount] = res.timer.lastMs[p];
+            run->passCount++;
+        }
+        folded = res.timer.folded;
+        advanceAnimation(&anim, frame.slideshow, res.slideCount, 1.0 / 60);
+        //Straight into the next transition, so two slides are always on screen
+        if (run->scene == BENCH_SLIDES && anim.phase >= PI) anim.phase = 0;
+    }
+    for (int i = total > BENCH_LAG ? total - BENCH_LAG : 0; i < total; i++) benchCollect(run, queries[i % BENCH_LAG], i);
+    if (run->scene == BENCH_WALL) {
+        run->landed = (int)res.wall.landed;
+        for (int i = 0; i < run->burstFrames && i < run->gpuCount; i++) if (run->cpu[i] > BENCH_BUDGET || run->gpu[i] > BENCH_BUDGET) run->dropped++;
+    }
+
+    gpuDelete(GPU_QUERY, BENCH_LAG * 2, &queries[0][0]);
+    if (status != 0) {
+        benchRelease(&res, &fbo, &color);
+        return -1;
+    }
+
+    //The reset path without the window, from the check that notices it: everything comes back from the image, program and glyph caches
+    res.drill = 1;
+    if (!glLost(&res)) {
+        benchRelease(&res, &fbo, &color);
+        return -1;
+    }
+    started = glfwGetTime();
+    benchRelease(&res, &fbo, &color);
+    res = {};
+    status = benchOpen(&res, &themeRequest, 0, run->width, run->height, &fbo, &color);
+    if (status < 0) return -1;
+    glFinish();
+    run->recoveryMs = (float)((glfwGetTime() - started) * 1000);
+    benchRelease(&res, &fbo, &color);
+    return status == 0 ? 0 : -1;
+}
+
+//The software renderer on the same clock; there is no GPU time and no reset to recover from
+int benchSoftware(BRUN* run, TDATA* data) {
+    volatile int themeRequest = 0;
+    SWDATA sw = {};
+    sw.themeRequest = &themeRequest;
+    std::chrono::high_resolution_clock::time_point started = std::chrono::high_resolution_clock::now();
+    if (swInit(&sw, NULL, run->width, run->height)) {
+        if (sw.running) swShutdown(&sw);
+        return -1;
+    }
+    run->loadMs = (float)(std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::high_resolution_clock::now() - started).count() * 1000);
+    run->slides = sw.slideCount;
+
+    SCENE scene;
+    startScene(&scene);
+    ANIMATION anim;
+    startAnimation(&anim);
+    FRAME frame = {};
+    frame.width = run->width;
+    frame.height = run->height;
+    for (int i = 0; i < BENCH_WARMUP + run->frames; i++) {
+        std::chrono::high_resolution_clock::time_point before = std::chrono::high_resolution_clock::now();
+        buildFrame(&frame, &anim, data->data, &scene, sw.slideCount, 1.0 / 60, BENCH_CLOCK + i / 60);
+        frame.hud = 0;
+        swDrawFrame(&sw, &frame);
+        std::chrono::high_resolution_clock::time_point after = std::chrono::high_resolution_clock::now();
+        if (i >= BENCH_WARMUP) run->cpu[i - BENCH_WARMUP] = (float)(std::chrono::duration_cast<std::chrono::duration<double>>(after - before).count() * 1000);
+        advanceAnimation(&anim, frame.slideshow, sw.slideCount, 1.0 / 60);
+        if (run->scene == BENCH_SLIDES && anim.phase >= PI) anim.phase = 0;
+    }
+    swShutdown(&sw);
+    return 0;
+}
+
+int benchStatsJson(char* buffer, int size, const char* name, BSTATS* stats) {
+    return sprintf_s(buffer, size, "\"%s\":{\"mean\":%.3f,\"p50\":%.3f,\"p90\":%.3f,\"p95\":%.3f,\"p99\":%.3f,\"max\":%.3f}",
+        name, stats->mean, stats->p50, stats->p90, stats->p95, stats->p99, stats->max);
+}
+
+int benchWrite(BRUN* runs, int count) {
+    std::ofstream file(benchOut, std::ios::trunc);
+    if (!file.is_open()) return -1;
+    char line[1024];
+    sprintf_s(line, "{\"device\":\"%s\",\"version\":\"%s\",\"warmup\":%d,\"gpuLeaks\":%d,\"runs\":[",
+        benchDevice, benchVersion, BENCH_WARMUP, (int)metrics.gpuLeaks);
+    file << line << std::endl;
+    for (int i = 0; i < count; i++) {
+        BRUN* run = &runs[i];
+        int length = sprintf_s(line, "    {\"scene\":\"%s\",\"width\":%d,\"height\":%d,\"frames\":%d,\"slides\":%d,\"loadMs\":%.1f,\"recoveryMs\":%.1f,",
+            benchScenes[run->scene], run->width, run->height, run->frames, run->slides, run->loadMs, run->recoveryMs);
+        length += benchStatsJson(line + length, sizeof(line) - length, "cpuMs", &run->cpuMs);
+        length += sprintf_s(line + length, sizeof(line) - length, ",");
+        length += benchStatsJson(line + length, sizeof(line) - length, "gpuMs", &run->gpuMs);
+        if (run->passCount > 0) {
+            length += sprintf_s(line + length, sizeof(line) - length, ",\"passMs\":{");
+            for (int p = 0; p < PASS_COUNT; p++) length += sprintf_s(line + length, sizeof(line) - length, "%s\"%s\":%.3f", p > 0 ? "," : "", passNames[p], run->passMs[p].p50);
+            length += sprintf_s(line + length, sizeof(line) - length, "}");
+        }
+        if (run->scene == BENCH_WALL) length += sprintf_s(line + length, sizeof(line) - length, ",\"landed\":%d,\"burstFrames\":%d,\"dropped\":%d",
+            run->landed, run->burstFrames, run->dropped);
+        sprintf_s(line + length, sizeof(line) - length, "}%s", i + 1 < count ? "," : "");
+        file << line << std::endl;
+    }
+    file << "]}" << std::endl;
+    return 0;
+}
+
+/*Golden images, run with -golden dir. Each case steps the animation on the
+* bench's fixed clock to its frame without drawing the ones before it (no
+* pass carries anything from frame to frame), draws that one frame at
+* GOLDEN_W x GOLDEN_H and compares it with dir/<scene>_<frame>.png. The wall
+* and animated clips load on their own threads, so the cases stick to the
+* stock slides with metaposts off. A case can open on another theme and swap
+* the default look for its own; those goldens carry the theme's name. The
+* clock text is local time: run with TZ=UTC. -update writes the renders as
+* the new goldens.
+*
+* The comparison is on 2x2 block averages in luma and chroma, which forgives
+* the odd pixel of rasterization and rounding drift between Mesa releases. A
+* block is off when the weighted distance is over GOLDEN_DELTA, and a case
+* fails when more than GOLDEN_SPREAD of the blocks are off. Failed renders and
+* a diff image (off blocks in red over the golden) go to the -diff directory.
+*
+* Every case is also drawn by the software renderer, which the GL frame has
+* to match within GOLDEN_SOFTWARE of the blocks. That is looser because the
+* software renderer samples without mipmaps, so the minified dot matrix
+* behind the slides comes out sharper than GL's. The banner agrees to a block.
+*/
+typedef struct goldenCase {
+    int scene;
+    unsigned int frame;
+    int theme;
+    const float* look; //NULL for defaultLook
+} GOLDEN;
+
+//Brighter, with the bloom cut in lower down
+const float goldenLook[4] = { 2.5f, 0.25f, 0.7f, 0.0f };
+
+//The banner's lights at rest and swinging, then swinging on a map-less theme and its own look; a slide at rest and one mid transition
+GOLDEN goldenCases[GOLDEN_CASES] = {
+    { BENCH_BANNER, 0 },
+    { BENCH_BANNER, 90 },
+    { BENCH_BANNER, 300 },
+    { BENCH_BANNER, 90, 1, goldenLook },
+    { BENCH_SLIDESHOW, 0 },
+    { BENCH_SLIDESHOW, 45 },
+    { BENCH_SLIDESHOW, 120 },
+};
+
+void goldenPath(char* path, size_t size, const char* dir, GOLDEN* golden, const char* suffix) {
+    if (golden->theme == 0) sprintf_s(path, size, "%s/%s_%04u%s.png", dir, benchScenes[golden->scene], golden->frame, suffix);
+    else sprintf_s(path, size, "%s/%s_%04u_%s%s.png", dir, benchScenes[golden->scene], golden->frame, themeTable[golden->theme].name, suffix);
+}
+
+void goldenFrame(FRAME* frame, ANIMATION* anim, SCENE* scene, TDATA* data, GOLDEN* golden, unsigned int slideCount) {
+    startScene(scene);
+    if (golden->look != NULL) {
+        for (int i = 0; i < 4; i++) scene->to.look[i] = golden->look[i];
+        scene->from = scene->to;
+    }
+    startAnimation(anim);
+    *frame = {};
+    frame->width = GOLDEN_W;
+    frame->height = GOLDEN_H;
+    for (unsigned int i = 0; ; i++) {
+        buildFrame(frame, anim, data->data, scene, slideCount, 1.0 / 60, BENCH_CLOCK + i / 60);
+        if (i == golden->frame) break;
+        advanceAnimation(anim, frame->slideshow, slideCount, 1.0 / 60);
+    }
+    frame->hud = 0;
+}
+
+void goldenRender(GLRES* res, TDATA* data, GOLDEN* golden, unsigned char* pixels) {
+    SCENE scene;
+    ANIMATION anim;
+    FRAME frame;
+    goldenFrame(&frame, &anim, &scene, data, golden, res->slideCount);
+    res->sceneVersion = -1;
+    glDrawFrame(res, &frame);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, res->target);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, GOLDEN_W, GOLDEN_H, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    //Top-down, as it will be written
+    for (int y = 0; y < GOLDEN_H / 2; y++) {
+        unsigned char row[GOLDEN_W * 4];
+        unsigned char* top = pixels + (size_t)y * GOLDEN_W * 4;
+        unsigned char* bottom = pixels + (size_t)(GOLDEN_H - 1 - y) * GOLDEN_W * 4;
+        memcpy(row, top, sizeof(row));
+        memcpy(top, bottom, sizeof(row));
+        memcpy(bottom, row, sizeof(row));
+    }
+}
+
+//The same frame from the software renderer, top-down RGBA like goldenRender's
+void goldenSoftware(SWDATA* sw, TDATA* data, GOLDEN* golden, unsigned char* pixels) {
+    SCENE scene;
+    ANIMATION anim;
+    FRAME frame;
+    goldenFrame(&frame, &anim, &scene, data, golden, sw->slideCount);
+    swDrawFrame(sw, &frame);
+    for (int y = 0; y < GOLDEN_H; y++) {
+        unsigned int* row = sw->pixels + (size_t)(GOLDEN_H - 1 - y) * sw->width;
+        unsigned char* out = pixels + (size_t)y * GOLDEN_W * 4;
+        for (int x = 0; x < GOLDEN_W; x++) {
+            out[x * 4] = (unsigned char)(row[x] >> 16);
+            out[x * 4 + 1] = (unsigned char)(row[x] >> 8);
+            out[x * 4 + 2] = (unsigned char)row[x];
+            out[x * 4 + 3] = 255;
+        }
+    }
+}
+
+//Returns how many 2x2 blocks are off; [worst] is the largest distance seen
+int goldenCompare(const unsigned char* image, const unsigned char* golden, unsigned char* diff, float* worst) {
+    int off = 0;
+    *worst = 0.0f;
+    for (int y = 0; y + 1 < GOLDEN_H; y += 2) {
+        for (int x = 0; x + 1 < GOLDEN_W; x += 2) {
+            float a[3] = {}, b[3] = {};
+            for (int k = 0; k < 4; k++) {
+                size_t p = ((size_t)(y + k / 2) * GOLDEN_W + x + k % 2) * 4;
+                for (int c = 0; c < 3; c++) {
+                    a[c] += image[p + c] / 4.0f;
+                    b[c] += golden[p + c] / 4.0f;
+                }
+            }
+            float dr = a[0] - b[0], dg = a[1] - b[1], db = a[2] - b[2];
+            float dy = 0.299f * dr + 0.587f * dg + 0.114f * db;
+            float dcb = db - dy, dcr = dr - dy;
+            //Chroma counts for half; the eye is far less sharp for it
+            float distance = sqrtf(dy * dy + 0.25f * (dcb * dcb + dcr * dcr));
+            if (distance > *worst) *worst = distance;
+            int bad = distance > GOLDEN_DELTA;
+            off += bad;
+            for (int k = 0; k < 4; k++) {
+                size_t p = ((size_t)(y + k / 2) * GOLDEN_W + x + k % 2) * 4;
+                unsigned char grey = (unsigned char)((golden[p] + golden[p + 1] + golden[p + 2]) / 12);
+                diff[p] = bad ? 255 : grey;
+                diff[p + 1] = grey;
+                diff[p + 2] = grey;
+                diff[p + 3] = 255;
+            }
+        }
+    }
+    return off;
+}
+
+//Returns the number of failed cases, or -1 if the cases could not be run
+int goldenMain(const char* dir, const char* diffDir, int update) {
+    size_t bytes = (size_t)GOLDEN_W * GOLDEN_H * 4;
+    unsigned char* pixels = (unsigned char*)HeapAlloc(GetProcessHeap(), 0, bytes);
+    unsigned char* diff = (unsigned char*)HeapAlloc(GetProcessHeap(), 0, bytes);
+    unsigned char* reference = (unsigned char*)HeapAlloc(GetProcessHeap(), 0, bytes);
+    TDATA* data = (TDATA*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(TDATA));
+    if (pixels == NULL || diff == NULL || reference == NULL || data == NULL) return -1;
+    CreateDirectoryA(diffDir, NULL);
+    int failed = 0;
+    char path[MAX_PATH];
+    //Both renderers open once per scene and theme
+    for (int group = 0; group < (BENCH_SLIDESHOW + 1) * themeCount; group++) {
+        int scene = group / themeCount, theme = group % themeCount, cases = 0;
+        for (int i = 0; i < GOLDEN_CASES; i++) cases += goldenCases[i].scene == scene && goldenCases[i].theme == theme;
+        if (cases == 0) continue;
+        volatile int themeRequest, swRequest = theme;
+        GLRES res = {};
+        unsigned int fbo, color;
+        benchData(data, scene, 0);
+        if (benchOpen(&res, &themeRequest, theme, GOLDEN_W, GOLDEN_H, &fbo, &color)) {
+            benchRelease(&res, &fbo, &color);
+            return -1;
+        }
+        SWDATA sw = {};
+        sw.themeRequest = &swRequest;
+        if (!update && swInit(&sw, NULL, GOLDEN_W, GOLDEN_H)) {
+            if (sw.running) swShutdown(&sw);
+            benchRelease(&res, &fbo, &color);
+            return -1;
+        }
+        for (int i = 0; i < GOLDEN_CASES; i++) {
+            GOLDEN* golden = &goldenCases[i];
+            if (golden->scene != scene || golden->theme != theme) continue;
+            goldenRender(&res, data, golden, pixels);
+            goldenPath(path, sizeof(path), dir, golden, "");
+            if (update) {
+                if (!stbi_write_png(path, GOLDEN_W, GOLDEN_H, 4, pixels, GOLDEN_W * 4)) {
+                    errorCallback(-1, "Unable to write golden image!");
+                    failed++;
+                }else std::cout << "Golden " << path << " updated" << std::endl;
+                continue;
+            }
+            int w, h, c;
+            unsigned char* expected = stbi_load(path, &w, &h, &c, 4);
+            int off = -1;
+            float worst = 0.0f;
+            if (expected == NULL || w != GOLDEN_W || h != GOLDEN_H) std::cout << "Golden " << path << " missing or the wrong size; run with -update" << std::endl;
+            else off = goldenCompare(pixels, expected, diff, &worst);
+            if (expected != NULL) stbi_image_free(expected);
+            int blocks = (GOLDEN_W / 2) * (GOLDEN_H / 2);
+            int pass = off >= 0 && off <= blocks * GOLDEN_SPREAD;
+            if (off >= 0) {
+                std::cout << "Golden " << benchScenes[scene] << " frame " << golden->frame << (theme ? " on " : "") << (theme ? themeTable[theme].name : "") << ": " << (pass ? "ok" : "FAILED") << ", "
+                    << off << " of " << blocks << " blocks off, worst " << worst << std::endl;
+            }
+            if (!pass) {
+                failed++;
+                goldenPath(path, sizeof(path), diffDir, golden, "");
+                stbi_write_png(path, GOLDEN_W, GOLDEN_H, 4, pixels, GOLDEN_W * 4);
+                if (off >= 0) {
+                    goldenPath(path, sizeof(path), diffDir, golden, "_diff");
+                    stbi_write_png(path, GOLDEN_W, GOLDEN_H, 4, diff, GOLDEN_W * 4);
+                }
+            }
+
+            //The software renderer is the reference the GL frame has to agree with, golden or not
+            goldenSoftware(&sw, data, golden, reference);
+            off = goldenCompare(pixels, reference, diff, &worst);
+            pass = off <= blocks * GOLDEN_SOFTWARE;
+            std::cout << "  software reference: " << (pass ? "ok" : "FAILED") << ", " << off << " of " << blocks << " blocks off, worst " << worst << std::endl;
+            if (pass) continue;
+            failed++;
+            goldenPath(path, sizeof(path), diffDir, golden, "_software");
+            stbi_write_png(path, GOLDEN_W, GOLDEN_H, 4, reference, GOLDEN_W * 4);
+            goldenPath(path, sizeof(path), diffDir, golden, "_software_diff");
+            stbi_write_png(path, GOLDEN_W, GOLDEN_H, 4, diff, GOLDEN_W * 4);
+        }
+        if (sw.running) swShutdown(&sw);
+        benchRelease(&res, &fbo, &color);
+    }
+    HeapFree(GetProcessHeap(), 0, pixels);
+    HeapFree(GetProcessHeap(), 0, diff);
+    HeapFree(GetProcessHeap(), 0, reference);
+    HeapFree(GetProcessHeap(), 0, data);
+    return failed;
+}
+
+/*Timing baselines, with -baseline file. The median CPU and GPU time of each
+* run, and the median GPU time of each pass it draws (as <pass>Ms), is kept
+* per renderer, scene and size; a run more than -slower percent
+* (BENCH_SLOWER by default) over its baseline on any of them fails; BENCH_NOISE
+* more is allowed, or sub-millisecond passes would fail on jitter. Renderers
+* match on their name without the bracketed build details, so one llvmpipe
+* reference serves every llvmpipe. A run with no baseline fails too; only
+* -update records them.
+*/
+typedef struct baseline {
+    char device[128];
+    char scene[16];
+    int width;
+    int height;
+    float cpuMs;
+    float gpuMs;
+    float passMs[PASS_COUNT];
+} BASELINE;
+
+int benchSameDevice(const char* a, const char* b) {
+    const char* detail = strstr(a, " (");
+    size_t length = detail != NULL ? detail - a : strlen(a);
+    return strncmp(a, b, length) == 0 && (b[length] == '\0' || strncmp(b + length, " (", 2) == 0);
+}
+
+//Returns the number of runs over their baseline or without one
+int benchBaseline(BRUN* runs, int count, const char* path, int slower, int update) {
+    BASELINE* entries = (BASELINE*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(BASELINE) * BASELINE_MAX);
+    if (entries == NULL) return 0;
+    int entryCount = 0;
+    std::streamsize size;
+    char* json = readFile(path, &size);
+    if (json != NULL) {
+        const char* end = json + size - 1;
+        const char* object;
+        char value[128];
+        for (const char* close = jsonObject(json, end, &object); close != NULL && entryCount < BASELINE_MAX; close = jsonObject(close + 1, end, &object)) {
+            BASELINE* entry = &entries[entryCount];
+            if (!jsonField(object, close, "device", value, sizeof(value))) continue;
+            jsonEscape(value, entry->device, sizeof(entry->device));
+            jsonField(object, close, "scene", entry->scene, sizeof(entry->scene));
+            entry->width = jsonField(object, close, "width", value, sizeof(value)) ? atoi(value) : 0;
+            entry->height = jsonField(object, close, "height", value, sizeof(value)) ? atoi(value) : 0;
+            entry->cpuMs = jsonField(object, close, "cpuMs", value, sizeof(value)) ? (float)atof(value) : 0.0f;
+            entry->gpuMs = jsonField(object, close, "gpuMs", value, sizeof(value)) ? (float)atof(value) : 0.0f;
+            for (int p = 0; p < PASS_COUNT; p++) {
+                char key[32];
+                sprintf_s(key, "%sMs", passNames[p]);
+                entry->passMs[p] = jsonField(object, close, key, value, sizeof(value)) ? (float)atof(value) : 0.0f;
+            }
+            entryCount++;
+        }
+        HeapFree(GetProcessHeap(), 0, json);
+    }
+
+    int regressions = 0, changed = 0;
+    for (int i = 0; i < count; i++) {
+        BRUN* run = &runs[i];
+        BASELINE* entry = NULL;
+        for (int e = 0; e < entryCount && entry == NULL; e++) {
+            BASELINE* b = &entries[e];
+            if (benchSameDevice(b->device, benchDevice) && strcmp(b->scene, benchScenes[run->scene]) == 0 && b->width == run->width && b->height == run->height) entry = b;
+        }
+        if (entry != NULL && !update) {
+            float cpuLimit = entry->cpuMs * (100 + slower) / 100 + BENCH_NOISE, gpuLimit = entry->gpuMs * (100 + slower) / 100 + BENCH_NOISE;
+            int slow = run->cpuMs.p50 > cpuLimit || run->gpuMs.p50 > gpuLimit;
+            std::cout << "Baseline " << benchScenes[run->scene] << " at " << run->width << "x" << run->height << ": " << (slow ? "SLOWER" : "ok")
+                << ", cpu " << run->cpuMs.p50 << " ms against " << entry->cpuMs << ", gpu " << run->gpuMs.p50 << " ms against " << entry->gpuMs << std::endl;
+            for (int p = 0; p < PASS_COUNT && run->passCount > 0; p++) {
+                float limit = entry->passMs[p] * (100 + slower) / 100 + BENCH_NOISE;
+                if (run->passMs[p].p50 <= limit) continue;
+                std::cout << "  " << passNames[p] << " pass SLOWER, " << run->passMs[p].p50 << " ms against " << entry->passMs[p] << std::endl;
+                slow = 1;
+            }
+            regressions += slow;
+            continue;
+        }
+        if (!update) {
+            std::cout << "Baseline " << benchScenes[run->scene] << " at " << run->width << "x" << run->height << ": MISSING for " << benchDevice
+                << ", record it with -update" << std::endl;
+            regressions++;
+            continue;
+        }
+        if (entry == NULL) {
+            if (entryCount == BASELINE_MAX) continue;
+            entry = &entries[entryCount++];
+        }
+        sprintf_s(entry->device, "%s", benchDevice);
+        sprintf_s(entry->scene, "%s", benchScenes[run->scene]);
+        entry->width = run->width;
+        entry->height = run->height;
+        entry->cpuMs = run->cpuMs.p50;
+        entry->gpuMs = run->gpuMs.p50;
+        for (int p = 0; p < PASS_COUNT; p++) entry->passMs[p] = run->passMs[p].p50;
+        changed = 1;
+        std::cout << "Baseline " << benchScenes[run->scene] << " at " << run->width << "x" << run->height << " recorded" << std::endl;
+    }
+
+    if (changed) {
+        std::ofstream file(path, std::ios::trunc);
+        if (file.is_open()) {
+            char line[640];
+            file << "[" << std::endl;
+            for (int e = 0; e < entryCount; e++) {
+                BASELINE* b = &entries[e];
+                int length = sprintf_s(line, "    {\"device\":\"%s\",\"scene\":\"%s\",\"width\":%d,\"height\":%d,\"cpuMs\":%.3f,\"gpuMs\":%.3f",
+                    b->device, b->scene, b->width, b->height, b->cpuMs, b->gpuMs);
+                for (int p = 0; p < PASS_COUNT; p++) if (b->passMs[p] >= 0.001f) length += sprintf_s(line + length, sizeof(line) - length, ",\"%sMs\":%.3f", passNames[p], b->passMs[p]);
+                sprintf_s(line + length, sizeof(line) - length, "}%s", e + 1 < entryCount ? "," : "");
+                file << line << std::endl;
+            }
+            file << "]" << std::endl;
+        }else errorCallback(-1, "Unable to write the timing baselines!");
+    }
+    HeapFree(GetProcessHeap(), 0, entries);
+    return regressions;
+}
+
+/*Show journal. With -record the banner logs every change to a stage's state
+* as it reaches the render thread, stamped with the stage's frame count, plus
+* each frame's dt, time taken and time of day. A journal is a JHEADER and
+* then JRECORDs, each followed by its payload:
+*
+*   J_SNAPSHOT  a stage's starting state (JSNAPSHOT), once per stage
+*   J_DATA      one byte of offset into the thread data, then the bytes there
+*   J_ANIM      the whole ANIMATION, after a control moved the slides or sync corrected it
+*   J_SCENE     the whole SCENE, after a preset or console changed the lights
+*   J_THEME     the requested theme, an int
+*   J_FRAME     a JFRAME; everything before it belongs to that frame
+*
+* The source (J_CLI, J_HTTP, J_AUTOSTART or J_CONTROL) is in the high nibble
+* of the kind. AUTOSTART changes are buildFrame's own, so a replay only checks
+* them; everything else is applied before the frame is built.
+*
+*   -bench -replay file [-fast] [-stage n] [-size WxH] [-out file]
+*
+* replays one stage through the real GL passes, paced by the recorded dt
+* unless -fast, and writes recorded and replayed timings per frame as CSV.
+*/
+typedef struct journalHeader {
+    char magic[4]; //"NNBJ"
+    unsigned int version;
+    LONG64 clock; //Time of day the recording started
+} JHEADER;
+
+typedef struct journalRecord {
+    unsigned char kind;
+    unsigned char stage;
+    unsigned short length;
+    unsigned int frame;
+} JRECORD;
+
+typedef struct journalFrame {
+    float dt;
+    float span; //Seconds from the start of the frame to present
+    unsigned int now; //Seconds after the header's clock
+} JFRAME;
+
+typedef struct journalSnapshot {
+    char data[256];
+    int width;
+    int height;
+    unsigned int slideCount;
+    int theme;
+    ANIMATION anim;
+    SCENE scene;
+} JSNAPSHOT;
+
+//Returns the record after [p], or NULL at the end or at a torn last record
+const char* journalNext(const char* p, const char* end, JRECORD* record, const char** payload) {
+    if (end - p < (ptrdiff_t)sizeof(JRECORD)) return NULL;
+    memcpy(record, p, sizeof(JRECORD));
+    *payload = p + sizeof(JRECORD);
+    if (end - *payload < record->length) return NULL;
+    return *payload + record->length;
+}
+
+//Returns 1 if the record changed the stage
+int journalApply(JRECORD* record, const char* payload, char* data, ANIMATION* anim, SCENE* scene, volatile int* theme) {
+    int kind = record->kind & 0xF, changed = 0;
+    if (kind == J_DATA && record->length > 1) {
+        int offset = (unsigned char)payload[0], length = record->length - 1;
+        if (offset + length > 256) return 0;
+        changed = memcmp(data + offset, payload + 1, length) != 0;
+        memcpy(data + offset, payload + 1, length);
+    }else if (kind == J_ANIM && record->length == sizeof(ANIMATION)) {
+        changed = memcmp(anim, payload, sizeof(ANIMATION)) != 0;
+        memcpy(anim, payload, sizeof(ANIMATION));
+    }else if (kind == J_SCENE && record->length == sizeof(SCENE)) {
+        changed = memcmp(scene, payload, sizeof(SCENE)) != 0;
+        memcpy(scene, payload, sizeof(SCENE));
+    }else if (kind == J_THEME && record->length == sizeof(int)) {
+        int requested;
+        memcpy(&requested, payload, sizeof(int));
+        changed = *theme != requested;
+        *theme = requested;
+    }
+    return changed;
+}
+
+//Like benchCollect, but every frame counts
+float replayCollect(unsigned int* queries) {
+    GLuint64 start = 0, end = 0;
+    glGetQueryObjectui64v(queries[0], GL_QUERY_RESULT, &start);
+    glGetQueryObjectui64v(queries[1], GL_QUERY_RESULT, &end);
+    return (end - start) / 1000000.0f;
+}
+
+int replayMain(const char* path, int stage, int fast, int width, int height, const char* out) {
+    std::streamsize size;
+    char* journal = readFile(path, &size);
+    if (journal == NULL) {
+        errorCallback(-1, "Unable to read the journal!");
+        return -1;
+    }
+    const char* end = journal + size - 1;
+    JHEADER header = {};
+    if (size - 1 >= (std::streamsize)sizeof(header)) memcpy(&header, journal, sizeof(header));
+    if (memcmp(header.magic, "NNBJ", 4) != 0 || header.version != JOURNAL_VERSION) {
+        errorCallback(-1, "Not a version 1 NNBJ journal!");
+        HeapFree(GetProcessHeap(), 0, journal);
+        return -1;
+    }
+
+    //First pass: the stage's starting state and how many frames it drew
+    JRECORD record;
+    const char* payload;
+    JSNAPSHOT snapshot;
+    int found = 0, frames = 0;
+    for (const char* p = journal + sizeof(header); (p = journalNext(p, end, &record, &payload)) != NULL; ) {
+        if (record.stage != stage) continue;
+        if ((record.kind & 0xF) == J_SNAPSHOT && record.length == sizeof(snapshot) && !found) {
+            memcpy(&snapshot, payload, sizeof(snapshot));
+            found = 1;
+        }
+        if ((record.kind & 0xF) == J_FRAME && found) frames++;
+    }
+    if (!found || frames == 0) {
+        errorCallback(-1, "The journal has no frames for that stage!");
+        HeapFree(GetProcessHeap(), 0, journal);
+        return -1;
+    }
+    if (width <= 0 || height <= 0) {
+        width = snapshot.width;
+        height = snapshot.height;
+    }
+
+    TDATA* data = (TDATA*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(TDATA));
+    float* samples = (float*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(float) * frames * 5);
+    int* events = (int*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(int) * frames);
+    if (data == NULL || samples == NULL || events == NULL) {
+        if (data != NULL) HeapFree(GetProcessHeap(), 0, data);
+        if (samples != NULL) HeapFree(GetProcessHeap(), 0, samples);
+        if (events != NULL) HeapFree(GetProcessHeap(), 0, events);
+        HeapFree(GetProcessHeap(), 0, journal);
+        return -2;
+    }
+    float* recordedDt = samples;
+    float* recordedCpu = samples + frames;
+    float* replayCpu = samples + frames * 2;
+    float* replayGpu = samples + frames * 3;
+    float* sorted = samples + frames * 4;
+    memcpy(data->data, snapshot.data, sizeof(snapshot.data));
+    ANIMATION anim = snapshot.anim;
+    SCENE scene = snapshot.scene;
+
+    volatile int themeRequest;
+    GLRES res = {};
+    unsigned int fbo, color;
+    if (benchOpen(&res, &themeRequest, 0, width, height, &fbo, &color)) {
+        HeapFree(GetProcessHeap(), 0, events);
+        HeapFree(GetProcessHeap(), 0, samples);
+        HeapFree(GetProcessHeap(), 0, data);
+        HeapFree(GetProcessHeap(), 0, journal);
+        return -1;
+    }
+    themeRequest = snapshot.theme;
+    if (res.slideCount != snapshot.slideCount) {
+        std::cout << "Replay has " << res.slideCount << " slides, the show had " << snapshot.slideCount
+            << "; the slideshow will not match." << std::endl;
+    }
+    std::cout << "Replaying stage " << stage << ": " << frames << " frames at " << width << "x" << height
+        << (fast ? ", as fast as possible" : ", at recorded speed") << std::endl;
+
+    unsigned int queries[BENCH_LAG][2];
+    gpuCreate(GPU_QUERY, BENCH_LAG * 2, &queries[0][0], "bench");
+    FRAME frame = {};
+    frame.width = width;
+    frame.height = height;
+    int played = 0, diverged = 0;
+    double started = glfwGetTime(), due = started;
+    const char* p = journal + sizeof(header);
+    while (played < frames) {
+        //Gather this frame's records, then play them around buildFrame the way GLmain did
+        const char* first = p;
+        const char* next;
+        JFRAME timing = {};
+        unsigned int stamp = 0;
+        while ((next = journalNext(p, end, &record, &payload)) != NULL) {
+            p = next;
+            if (record.stage == stage && (record.kind & 0xF) == J_FRAME && record.length == sizeof(JFRAME)) {
+                memcpy(&timing, payload, sizeof(JFRAME));
+                stamp = record.frame;
+                break;
+            }
+        }
+        if (next == NULL) break;
+        for (const char* q = first; q < p && (q = journalNext(q, end, &record, &payload)) != NULL; ) {
+            if (record.stage != stage || (record.kind >> 4) == J_AUTOSTART) continue;
+            events[played] += journalApply(&record, payload, data->data, &anim, &scene, &themeRequest);
+        }
+        if (anim.frameCount != stamp) {
+            diverged++;
+            anim.frameCount = stamp;
+        }
+
+        if (!fast) {
+            due += timing.dt;
+            while (glfwGetTime() < due) Sleep(1);
+        }
+        int slot = played % BENCH_LAG;
+        if (played >= BENCH_LAG) replayGpu[played - BENCH_LAG] = replayCollect(queries[slot]);
+        std::chrono::high_resolution_clock::time_point before = std::chrono::high_resolution_clock::now();
+        buildFrame(&frame, &anim, data->data, &scene, res.slideCount, timing.dt, (std::time_t)(header.clock + timing.now));
+        for (const char* q = first; q < p && (q = journalNext(q, end, &record, &payload)) != NULL; ) {
+            if (record.stage != stage || (record.kind >> 4) != J_AUTOSTART) continue;
+            //buildFrame should have made the same change on its own
+            if (journalApply(&record, payload, data->data, &anim, &scene, &themeRequest)) diverged++;
+        }
+        frame.hud = 0;
+        frame.cpuMs = timing.span * 1000;
+        glQueryCounter(queries[slot][0], GL_TIMESTAMP);
+        glDrawFrame(&res, &frame);
+        glQueryCounter(queries[slot][1], GL_TIMESTAMP);
+        glFlush();
+        std::chrono::high_resolution_clock::time_point after = std::chrono::high_resolution_clock::now();
+        replayCpu[played] = (float)(std::chrono::duration_cast<std::chrono::duration<double>>(after - before).count() * 1000);
+        recordedDt[played] = timing.dt * 1000;
+        recordedCpu[played] = timing.span * 1000;
+        advanceAnimation(&anim, frame.slideshow, res.slideCount, timing.span);
+        played++;
+    }
+    for (int i = played > BENCH_LAG ? played - BENCH_LAG : 0; i < played; i++) replayGpu[i] = replayCollect(queries[i % BENCH_LAG]);
+    double elapsed = glfwGetTime() - started;
+    gpuDelete(GPU_QUERY, BENCH_LAG * 2, &queries[0][0]);
+    benchRelease(&res, &fbo, &color);
+    HeapFree(GetProcessHeap(), 0, journal);
+
+    std::ofstream file(out, std::ios::trunc);
+    if (file.is_open()) {
+        file << "frame,dtMs,showCpuMs,replayCpuMs,replayGpuMs,changes" << std::endl;
+        for (int i = 0; i < played; i++) {
+            char line[128];
+            sprintf_s(line, "%d,%.3f,%.3f,%.3f,%.3f,%d", i, recordedDt[i], recordedCpu[i], replayCpu[i], replayGpu[i], events[i]);
+            file << line << std::endl;
+        }
+    }else errorCallback(-1, "Unable to write the replay timings!");
+
+    BSTATS show, cpu, gpu;
+    memcpy(sorted, recordedCpu, sizeof(float) * played);
+    benchStats(sorted, played, &show);
+    memcpy(sorted, replayCpu, sizeof(float) * played);
+    benchStats(sorted, played, &cpu);
+    memcpy(sorted, replayGpu, sizeof(float) * played);
+    benchStats(sorted, played, &gpu);
+    std::cout << "Replayed " << played << " frames in " << elapsed << " s, " << diverged << " diverged" << std::endl;
+    //Where the stage ended up, for the fixture test to check
+    std::cout << "  final state: frame " << anim.frameCount << ", flags " << (int)data->data[D_FLAGS] << ", colours " << (int)data->data[D_COLOR1]
+        << " " << (int)data->data[D_COLOR2] << " " << (int)data->data[D_COLOR3] << ", theme " << themeRequest << ", slide " << anim.slideID << std::endl;
+    std::cout << "  show cpu p50 " << show.p50 << " p99 " << show.p99 << " max " << show.max << " ms; replay cpu p50 " << cpu.p50
+        << " p99 " << cpu.p99 << " ms, gpu p50 " << gpu.p50 << " p99 " << gpu.p99 << " ms" << std::endl;
+    //The show's slowest frames, to line up against the replay's
+    for (int n = 0; n < REPLAY_SLOWEST && n < played; n++) {
+        int slowest = -1;
+        for (int i = 0; i < played; i++) {
+            if (recordedDt[i] < 0.0f) continue;
+            if (slowest < 0 || recordedDt[i] > recordedDt[slowest]) slowest = i;
+        }
+        std::cout << "  frame " << slowest << ": " << recordedDt[slowest] << " ms at the show, replay cpu " << replayCpu[slowest]
+            << " gpu " << replayGpu[slowest] << " ms, " << events[slowest] << " changes" << std::endl;
+        recordedDt[slowest] = -1.0f;
+    }
+    std::cout << "Replay timings written to " << out << std::endl;
+    HeapFree(GetProcessHeap(), 0, events);
+    HeapFree(GetProcessHeap(), 0, samples);
+    HeapFree(GetProcessHeap(), 0, data);
+    return diverged > 0 ? 1 : 0;
+}
+
+int benchMain(int argc, char** argv) {
+    int frames = BENCH_FRAMES;
+    int sizes[BENCH_SIZES][2];
+    int sizeCount = 0;
+    int scenes[BENCH_SCENES];
+    int sceneCount = 0;
+    const char* golden = NULL;
+    const char* diffDir = BENCH_DIR;
+    const char* baseline = NULL;
+    int slower = BENCH_SLOWER;
+    int update = 0;
+    const char* replay = NULL;
+    const char* replayOut = REPLAY_OUT;
+    int stage = 0;
+    int fast = 0;
+    int software = 0;
+    for (int i = 1; i < argc; i++) {
+        if (streq(argv[i], "-BENCH", 0, 7) && i + 1 < argc && atoi(argv[i + 1]) > 0) frames = atoi(argv[++i]);
+        if (streq(argv[i], "-SIZE", 0, 6) && i + 1 < argc) {
+            const char* size = argv[++i];
+            const char* x = strchr(size, 'x');
+            int w = atoi(size), h = x != NULL ? atoi(x + 1) : 0;
+            if (w > 0 && h > 0 && sizeCount < BENCH_SIZES) {
+                sizes[sizeCount][0] = w;
+                sizes[sizeCount++][1] = h;
+            }
+        }
+        if (streq(argv[i], "-SCENE", 0, 7) && i + 1 < argc) {
+            i++;
+            for (int s = 0; s < BENCH_SCENES; s++) if (streq(argv[i], benchScenes[s], 0, 16) && sceneCount < BENCH_SCENES) scenes[sceneCount++] = s;
+        }
+        if (streq(argv[i], "-OUT", 0, 5) && i + 1 < argc) benchOut = replayOut = argv[++i];
+        if (streq(argv[i], "-GLDEBUG", 0, 9)) glDebug = 1;
+        if (streq(argv[i], "-GOLDEN", 0, 8) && i + 1 < argc) golden = argv[++i];
+        if (streq(argv[i], "-DIFF", 0, 6) && i + 1 < argc) diffDir = argv[++i];
+        if (streq(argv[i], "-BASELINE", 0, 10) && i + 1 < argc) baseline = argv[++i];
+        if (streq(argv[i], "-SLOWER", 0, 8) && i + 1 < argc) slower = atoi(argv[++i]);
+        if (streq(argv[i], "-UPDATE", 0, 8)) update = 1;
+        if (streq(argv[i], "-REPLAY", 0, 8) && i + 1 < argc) replay = argv[++i];
+        if (streq(argv[i], "-STAGE", 0, 7) && i + 1 < argc) stage = atoi(argv[++i]);
+        if (streq(argv[i], "-FAST", 0, 6)) fast = 1;
+        if (streq(argv[i], "-SOFTWARE", 0, 10)) software = 1;
+    }
+    int replaySize[2] = { sizeCount > 0 ? sizes[0][0] : 0, sizeCount > 0 ? sizes[0][1] : 0 };
+    if (sizeCount == 0) {
+        int defaults[2][2] = { { 1280, 720 }, { 1920, 1080 } };
+        for (sizeCount = 0; sizeCount < 2; sizeCount++) {
+            sizes[sizeCount][0] = defaults[sizeCount][0];
+            sizes[sizeCount][1] = defaults[sizeCount][1];
+        }
+    }
+    if (sceneCount == 0) for (sceneCount = 0; sceneCount < BENCH_SCENES; sceneCount++) scenes[sceneCount] = sceneCount;
+
+    glfwSetErrorCallback(errorCallback);
+    if (!glfwInit()) return -1;
+    if (benchContext()) {
+        errorCallback(-1, "Unable to create an offscreen GL context!");
+        glfwTerminate();
+        return -1;
+    }
+    if (golden != NULL) {
+        CreateDirectoryA(BENCH_DIR, NULL);
+        int failed = goldenMain(golden, diffDir, update);
+        benchClose();
+        glfwTerminate();
+        if (failed > 0) std::cout << failed << " golden images differ; renders and diffs are in " << diffDir << std::endl;
+        return failed != 0 ? 1 : 0;
+    }
+    if (replay != NULL) {
+        CreateDirectoryA(BENCH_DIR, NULL);
+        int failed = replayMain(replay, stage, fast, replaySize[0], replaySize[1], replayOut);
+        benchClose();
+        glfwTerminate();
+        return failed;
+    }
+    for (int s = 0; s < sceneCount; s++) {
+        if (scenes[s] == BENCH_SLIDES && benchSlides()) return -1;
+        if (scenes[s] == BENCH_TEXT && benchFeed(BENCH_DIR "/feed.json", WALL_PENDING)) return -1;
+    }
+
+    TDATA* data = (TDATA*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(TDATA));
+    BRUN* runs = (BRUN*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(BRUN) * sceneCount * sizeCount);
+    if (data == NULL || runs == NULL) return -2;
+    int count = 0;
+    int slow = 0;
+    int missed = 0;
+    int dropped = 0;
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    if (software) sprintf_s(benchDevice, "Software (%d lanes)", SW_LANES);
+    for (int s = 0; s < sceneCount; s++) {
+        for (int z = 0; z < sizeCount; z++) {
+            BRUN* run = &runs[count];
+            run->scene = scenes[s];
+            run->width = sizes[z][0];
+            run->height = sizes[z][1];
+            run->frames = frames;
+            run->cpu = (float*)HeapAlloc(GetProcessHeap(), 0, sizeof(float) * frames);
+            run->gpu = (float*)HeapAlloc(GetProcessHeap(), 0, sizeof(float) * frames);
+            run->passes = (float*)HeapAlloc(GetProcessHeap(), 0, sizeof(float) * frames * PASS_COUNT);
+            if (run->cpu == NULL || run->gpu == NULL || run->passes == NULL) return -2;
+
+            if (run->scene == BENCH_WALL && benchFeed(BENCH_DIR "/wall.json", 0)) return -1;
+            benchData(data, run->scene, 1);
+            std::cout << "Bench: " << benchScenes[run->scene] << " at " << run->width << "x" << run->height << ", " << frames << " frames" << std::endl;
+            if (software ? benchSoftware(run, data) : benchRun(run, data)) {
+                benchClose();
+                glfwTerminate();
+                return -1;
+            }
+            benchStats(run->cpu, frames, &run->cpuMs);
+            benchStats(run->gpu, run->gpuCount, &run->gpuMs);
+            for (int p = 0; p < PASS_COUNT; p++) benchStats(run->passes + p * frames, run->passCount, &run->passMs[p]);
+            count++;
+            if (software) {
+                float fps = run->cpuMs.mean > 0.0f ? 1000.0f / run->cpuMs.mean : 0.0f;
+                std::cout << "  frame p50 " << run->cpuMs.p50 << " p99 " << run->cpuMs.p99 << " ms, " << fps << " fps on "
+                    << info.dwNumberOfProcessors << " cores, load " << run->loadMs << " ms" << std::endl;
+                if (run->width * run->height < 1920 * 1080 || fps >= SW_TARGET_FPS) continue;
+                if (info.dwNumberOfProcessors >= SW_TARGET_CORES) missed++;
+                else std::cout << "  below " << SW_TARGET_FPS << " fps, not counted: the target is for " << SW_TARGET_CORES << " cores" << std::endl;
+                continue;
+            }
+            std::cout << "  cpu p50 " << run->cpuMs.p50 << " p99 " << run->cpuMs.p99 << " ms, gpu p50 " << run->gpuMs.p50
+                << " p99 " << run->gpuMs.p99 << " ms, load " << run->loadMs << " ms, recovery " << run->recoveryMs << " ms" << std::endl;
+            std::cout << "  pass p50";
+            for (int p = 0; p < PASS_COUNT; p++) if (run->passMs[p].p50 > 0.0f) std::cout << " " << passNames[p] << " " << run->passMs[p].p50;
+            std::cout << " ms" << std::endl;
+            if (run->recoveryMs > RECOVERY_TARGET) slow++;
+            if (run->scene != BENCH_WALL) continue;
+            std::cout << "  burst of " << BENCH_BURST << ": " << run->landed << " landed over " << run->burstFrames << " frames, "
+                << run->dropped << " over " << BENCH_BUDGET << " ms" << std::endl;
+            if (run->landed < BENCH_BURST) dropped++;
+            else if (run->dropped == 0) continue;
+            else if (info.dwNumberOfProcessors >= BENCH_WALL_CORES) dropped++;
+            else std::cout << "  over budget, not counted: the baker needs a core of its own" << std::endl;
+        }
+    }
+    benchClose();
+    glfwTerminate();
+    if (benchWrite(runs, count)) {
+        errorCallback(-1, "Unable to write the bench results!");
+        return -1;
+    }
+    std::cout << "Bench results written to " << benchOut << std::endl;
+    if (slow > 0) {
+        std::cout << slow << " runs took longer than " << RECOVERY_TARGET << " ms to recover" << std::endl;
+        return 1;
+    }
+    if (missed > 0) {
+        std::cout << missed << " software runs at 1080p or more fell short of " << SW_TARGET_FPS << " fps" << std::endl;
+        return 1;
+    }
+    if (dropped > 0) {
+        std::cout << dropped << " wall runs dropped frames or did not land the whole burst" << std::endl;
+        return 1;
+    }
+    if (baseline != NULL && benchBaseline(runs, count, baseline, slower, update) > 0) {
+        std::cout << "Slower than the baseline by more than " << slower << "%, or without one" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#ifndef NNB_HEADLESS
+/*Offline export. GLmain runs on a virtual clock with the passes aimed at an
+* offscreen target; each frame is read into one of two pixel pack buffers and
+* the other, a frame older and long since landed, is mapped and handed to the
+* writer pool. Frames are flipped to top-down on the way out so a .raw export
+* drops straight into http/slides as an animated slide.
+*/
+typedef struct exportSlot {
+    volatile LONG state;
+    int index;
+    unsigned char* pixels;
+} ESLOT;
+
+typedef struct exportData {
+    int width;
+    int height;
+    size_t frameBytes;
+    int frames;
+    unsigned int fbo;
+    unsigned int color;
+    unsigned int pbo[2];
+    int pending;
+    ESLOT slots[EXPORT_SLOTS];
+    HANDLE file;
+    HANDLE signal;
+    HANDLE freed;
+    int writerCount;
+    HANDLE writers[EXPORT_SLOTS];
+    int submitted;
+    volatile LONG written;
+    volatile LONG running;
+    LONG stalledFrames;
+    double started;
+    double reported;
+} EDATA;
+
+DWORD WINAPI ExportWriter(LPVOID lpParam) {
+    EDATA* exporter = (EDATA*)lpParam;
+    char framePath[MAX_PATH];
+    while (exporter->running) {
+        int idle = 1;
+        for (int i = 0; i < EXPORT_SLOTS; i++) {
+            ESLOT* slot = &exporter->slots[i];
+            if (InterlockedCompareExchange(&slot->state, S_UPLOADING, S_READY) != S_READY) continue;
+            if (exportFormat == EXPORT_RAW) {
+                ULONGLONG offset = CLIP_HEADER + (ULONGLONG)slot->index * exporter->frameBytes;
+                OVERLAPPED at = {};
+                at.Offset = (DWORD)offset;
+                at.OffsetHigh = (DWORD)(offset >> 32);
+                DWORD out;
+                if (!WriteFile(exporter->file, slot->pixels, (DWORD)exporter->frameBytes, &out, &at)) errorCallback(-1, "Unable to write export frame!");
+            }else {
+                sprintf_s(framePath, "%s/%05d.png", exportDir, slot->index);
+                if (!stbi_write_png(framePath, exporter->width, exporter->height, 4, slot->pixels, exporter->width * 4)) errorCallback(-1, "Unable to write export frame!");
+            }
+            InterlockedExchange(&slot->state, S_FREE);
+            InterlockedIncrement(&exporter->written);
+            SetEvent(exporter->freed);
+            idle = 0;
+        }
+        if (idle) WaitForSingleObject(exporter->signal, 10);
+    }
+    return 0;
+}
+
+int openExport(EDATA* exporter, int width, int height, int frames) {
+    exporter->width = width;
+    exporter->height = height;
+    exporter->frames = frames;
+    exporter->frameBytes = (size_t)width * height * 4;
+    exporter->pending = -1;
+    CreateDirectoryA(exportDir, NULL);
+    if (exportFormat == EXPORT_RAW) {
+        char rawPath[MAX_PATH];
+        sprintf_s(rawPath, "%s/export.raw", exportDir);
+        exporter->file = CreateFileA(rawPath, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (exporter->file == INVALID_HANDLE_VALUE) {
+            errorCallback(-1, "Unable to create export file!");
+            return -1;
+        }
+        unsigned char header[CLIP_HEADER] = {};
+        CLIPHEADER* h = (CLIPHEADER*)header;
+        memcpy(h->magic, "NNBF", 4);
+        h->width = width;
+        h->height = height;
+        h->frames = frames;
+        h->fps = exportFps;
+        DWORD out;
+        WriteFile(exporter->file, header, CLIP_HEADER, &out, NULL);
+    }
+
+    gpuCreate(GPU_FRAMEBUFFER, 1, &exporter->fbo, "export");
+    glBindFramebuffer(GL_FRAMEBUFFER, exporter->fbo);
+    gpuCreate(GPU_RENDERBUFFER, 1, &exporter->color, "export");
+    glBindRenderbuffer(GL_RENDERBUFFER, exporter->color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    gpuStorage(GPU_RENDERBUFFER, exporter->color, GL_RGBA8, gpuTextureBytes(GL_RGBA8, width, height, 0));
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, exporter->color);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        errorCallback(-1, "Export framebuffer incomplete!");
+        return -1;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    gpuCreate(GPU_BUFFER, 2, exporter->pbo, "export");
+    for (int i = 0; i < 2; i++) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, exporter->pbo[i]);
+        glBufferData(GL_PIXEL_PACK_BUFFER, exporter->frameBytes, NULL, GL_STREAM_READ);
+        gpuStorage(GPU_BUFFER, exporter->pbo[i], 0, exporter->frameBytes);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    for (int i = 0; i < EXPORT_SLOTS; i++) {
+        exporter->slots[i].pixels = (unsigned char*)HeapAlloc(GetProcessHeap(), 0, exporter->frameBytes);
+        if (exporter->slots[i].pixels == NULL) return -1;
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    exporter->writerCount = info.dwNumberOfProcessors > 1 ? info.dwNumberOfProcessors - 1 : 1;
+    if (exporter->writerCount > EXPORT_SLOTS) exporter->writerCount = EXPORT_SLOTS;
+    exporter->signal = CreateEventA(NULL, FALSE, FALSE, NULL);
+    exporter->freed = CreateEventA(NULL, FALSE, FALSE, NULL);
+    exporter->running = 1;
+    for (int i = 0; i < exporter->writerCount; i++) {
+        DWORD writerID;
+        exporter->writers[i] = CreateThread(NULL, 0, ExportWriter, exporter, 0, &writerID);
+    }
+    exporter->started = glfwGetTime();
+    exporter->reported = exporter->started;
+    std::cout << "Exporting " << frames << " frames at " << exportFps << " fps to " << exportDir << " with " << exporter->writerCount << " writers." << std::endl;
+    return 0;
+}
+
+void collectExport(EDATA* exporter, int index) {
+    ESLOT* slot = NULL;
+    int stalled = 0;
+    while (slot == NULL) {
+        for (int i = 0; i < EXPORT_SLOTS && slot == NULL; i++) if (exporter->slots[i].state == S_FREE) slot = &exporter->slots[i];
+        if (slot == NULL) {
+            //Every slot is still being encoded, so the writers are the bottleneck
+            stalled = 1;
+            WaitForSingleObject(exporter->freed, 10);
+        }
+    }
+    exporter->stalledFrames += stalled;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, exporter->pbo[index & 1]);
+    unsigned char* mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, exporter->frameBytes, GL_MAP_READ_BIT);
+    if (mapped != NULL) {
+        size_t row = (size_t)exporter->width * 4;
+        for (int y = 0; y < exporter->height; y++) {
+            unsigned char* dest = slot->pixels + (exporter->height - 1 - y) * row;
+            memcpy(dest, mapped + y * row, row);
+            for (size_t x = 3; x < row; x += 4) dest[x] = 0xFF;
+        }
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    slot->index = index;
+    exporter->submitted++;
+    InterlockedExchange(&slot->state, S_READY);
+    SetEvent(exporter->signal);
+}
+
+//Queue the readback of this frame and pass the previous one to the writers
+void exportFrame(EDATA* exporter, int index) {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, exporter->fbo);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, exporter->pbo[index & 1]);
+    glReadPixels(0, 0, exporter->width, exporter->height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    if (exporter->pending >= 0) collectExport(exporter, exporter->pending);
+    exporter->pending = index;
+
+    double now = glfwGetTime();
+    if (now - exporter->reported >= 1.0) {
+        exporter->reported = now;
+        metrics.exportFps = (float)((index + 1) / (now - exporter->started));
+        std::cout << "Export: " << index + 1 << "/" << exporter->frames << " frames, " << metrics.exportFps << " fps" << std::endl;
+    }
+}
+
+void closeExport(EDATA* exporter) {
+    if (exporter->pending >= 0) collectExport(exporter, exporter->pending);
+    exporter->pending = -1;
+    //Only wait for the frames that were handed over; the window can close before the full count
+    while (exporter->written < exporter->submitted) WaitForSingleObject(exporter->freed, 10);
+    exporter->running = 0;
+    for (int i = 0; i < exporter->writerCount; i++) {
+        SetEvent(exporter->signal);
+        WaitForSingleObject(exporter->writers[i], INFINITE);
+        CloseHandle(exporter->writers[i]);
+    }
+    CloseHandle(exporter->signal);
+    CloseHandle(exporter->freed);
+    int frames = exporter->submitted;
+    double elapsed = glfwGetTime() - exporter->started;
+    metrics.exportFps = (float)(frames / elapsed);
+    if (exporter->file != NULL && exporter->file != INVALID_HANDLE_VALUE) {
+        if (frames < exporter->frames) {
+            //A short export rewrites the header so the clip still matches its file size
+            OVERLAPPED at = {};
+            at.Offset = offsetof(CLIPHEADER, frames);
+            DWORD out;
+            WriteFile(exporter->file, &frames, sizeof(frames), &out, &at);
+            std::cout << "Export stopped early at " << frames << "/" << exporter->frames << " frames." << std::endl;
+        }
+        CloseHandle(exporter->file);
+    }
+    for (int i = 0; i < EXPORT_SLOTS; i++) HeapFree(GetProcessHeap(), 0, exporter->slots[i].pixels);
+    gpuDelete(GPU_BUFFER, 2, exporter->pbo);
+    gpuDelete(GPU_RENDERBUFFER, 1, &exporter->color);
+    gpuDelete(GPU_FRAMEBUFFER, 1, &exporter->fbo);
+    std::cout << "Export done: " << frames << " frames in " << elapsed << "s, " << metrics.exportFps << " fps ("
+        << (double)frames / exportFps / elapsed << "x realtime, " << exporter->stalledFrames << " frames waited on the writers)" << std::endl;
+}
+
+/*Vulkan backend. The same passes as the GL path, recorded by VK_WORKERS
+* threads into one primary command buffer each (light, bloom chain, final
+* composite) and submitted together. Frames in flight are paced with a single
+* timeline semaphore. The bright-pass target and the second bloom target are
+* never live at the same time, so they are bound to the same allocation.
+* SPIR-V is built from shader/vk by the nnb_shaders CMake target (glslc, e.g.
+* glslc light.frag -o light.frag.spv); themes and the scene block are read the
+* same way as on GL, so presets and theme crossfades look the same.
+*/
+typedef struct vkImage {
+    VkImage image;
+    VkImageView view;
+    VkDeviceMemory memory;
+    int width;
+    int height;
+} VKIMAGE;
+
+typedef struct vkUniforms {
+    float pm[16];
+    float proj[16];
+    float rl[4];
+    float gl[4];
+    float bl[4];
+    float wl[4];
+    SCENEBLOCK from; //The scene uniform block, as glLightPass uploads it
+    SCENEBLOCK to;
+    float timing[4];
+    float clock[4]; //Scene clock, theme fade
+} VKUNIFORMS;
+
+typedef struct vkPush {
+    float rot[16];
+    float xOffs;
+    float offs;
+    int horizontal;
+    float flipY;
+    float textColor[4];
+} VKPUSH;
+
+struct vkData;
+typedef struct vkJob {
+    struct vkData* vk;
+    int index;
+    int recorded;
+    HANDLE thread;
+    HANDLE start;
+    HANDLE done;
+} VKJOB;
+
+typedef struct vkData {
+    VkInstance instance;
+    VkSurfaceKHR surface;
+    VkPhysicalDevice gpu;
+    VkDevice device;
+    uint32_t queueFamily;
+    VkQueue queue;
+    GLFWwindow* window;
+
+    VkSwapchainKHR swapchain;
+    VkFormat format;
+    VkExtent2D extent;
+    uint32_t imageCount;
+    VkImage swapImages[8];
+    VkImageView swapViews[8];
+    VkFramebuffer swapFramebuffers[8];
+    VkSemaphore rendered[8];
+
+    VkRenderPass hdrPass;
+    VkRenderPass blurPass;
+    VkRenderPass presentPass;
+    VKIMAGE lit;
+    VKIMAGE bright;
+    VKIMAGE ping;
+    VKIMAGE pong;
+    VkDeviceMemory bloomMemory;
+    VkFramebuffer litFB;
+    VkFramebuffer pingFB;
+    VkFramebuffer pongFB;
+
+    VkSampler clampSampler;
+    VkSampler repeatSampler;
+    VkDescriptorSetLayout frameLayout;
+    VkDescriptorSetLayout textureLayout;
+    VkPipelineLayout layout;
+    VkPipeline light;
+    VkPipeline bloom;
+    VkPipeline assembly;
+    VkPipeline flat;
+    VkPipeline dots;
+    VkPipeline text;
+    VkDescriptorPool pool;
+
+    VKIMAGE themeMaps[THEME_MAX][THEME_MAPS];
+    VKIMAGE flatMaps[THEME_MAPS];
+    int themeReady[THEME_MAX];
+    int themeCurrent;
+    int themePrevious;
+    float themeFade;
+    volatile int* themeRequest;
+    VKIMAGE overlay;
+    VKIMAGE dotMatrix;
+    VKIMAGE atlas;
+    VKIMAGE slides[32];
+    unsigned int slideCount;
+    ATLASGLYPH glyphs[128];
+
+    VkDescriptorSet frameSets[VK_FRAMES];
+    VkDescriptorSet themeSets[THEME_MAX];
+    VkDescriptorSet brightSet;
+    VkDescriptorSet pingSet;
+    VkDescriptorSet pongSet;
+    VkDescriptorSet assemblySet;
+    VkDescriptorSet overlaySet;
+    VkDescriptorSet dotSet;
+    VkDescriptorSet glyphSet;
+    VkDescriptorSet slideSets[32];
+
+    VkBuffer quads;
+    VkDeviceMemory quadMemory;
+    VkBuffer uniforms[VK_FRAMES];
+    VkBuffer textVertices[VK_FRAMES];
+    VkDeviceMemory hostMemory;
+    unsigned char* hostMapped;
+    VkDeviceSize uniformOffset[VK_FRAMES];
+    VkDeviceSize textOffset[VK_FRAMES];
+    int textCount[2];
+
+    VkSemaphore timeline;
+    uint64_t frameNumber;
+    VkSemaphore acquired[VK_FRAMES];
+    VkCommandPool pools[VK_FRAMES][VK_WORKERS];
+    VkCommandBuffer commands[VK_FRAMES][VK_WORKERS];
+    VkCommandPool uploadPool;
+    VKJOB jobs[VK_WORKERS];
+    HANDLE done[VK_WORKERS];
+    volatile int running;
+
+    FRAME* frame;
+    int slot;
+    uint32_t imageIndex;
+    int skip;
+} VKDATA;
+
+#define VK_CHECK(call) \
+    do { \
+        VkResult vkr = (call); \
+        if (vkr != VK_SUCCESS) { \
+            std::cout << "\033[0;91m" << #call << " failed with " << vkr << "\033[0m" << std::endl; \
+            return -1; \
+        } \
+    } while (FALSE)
+
+uint32_t vkMemoryType(VKDATA* vk, uint32_t bits, VkMemoryPropertyFlags flags) {
+    VkPhysicalDeviceMemoryProperties props;
+    vkGetPhysicalDeviceMemoryProperties(vk->gpu, &props);
+    for (uint32_t i = 0; i < props.memoryTypeCount; i++) {
+        if ((bits & (1 << i)) && (props.memoryTypes[i].propertyFlags & flags) == flags) return i;
+    }
+    return 0;
+}
+
+int vkBuffer(VKDATA* vk, VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer* buffer) {
+    VkBufferCreateInfo info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    info.size = size;
+    info.usage = usage;
+    info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VK_CHECK(vkCreateBuffer(vk->device, &info, NULL, buffer));
+    return 0;
+}
+
+int vkAllocate(VKDATA* vk, VkMemoryRequirements req, VkMemoryPropertyFlags flags, VkDeviceMemory* memory) {
+    VkMemoryAllocateInfo info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+    info.allocationSize = req.size;
+    info.memoryTypeIndex = vkMemoryType(vk, req.memoryTypeBits, flags);
+    VK_CHECK(vkAllocateMemory(vk->device, &info, NULL, memory));
+    return 0;
+}
+
+int vkCreateImage2D(VKDATA* vk, VKIMAGE* img, int w, int h, VkFormat format, VkImageUsageFlags usage, VkDeviceMemory shared) {
+    VkImageCreateInfo info = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+    info.imageType = VK_IMAGE_TYPE_2D;
+    info.format = format;
+    info.extent.width = w;
+    info.extent.height = h;
+    info.extent.depth = 1;
+    info.mipLevels = 1;
+    info.arrayLayers = 1;
+    info.samples = VK_SAMPLE_COUNT_1_BIT;
+    info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    info.usage = usage;
+    info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VK_CHECK(vkCreateImage(vk->device, &info, NULL, &img->image));
+    img->width = w;
+    img->height = h;
+    VkMemoryRequirements req;
+    vkGetImageMemoryRequirements(vk->device, img->image, &req);
+    if (shared == VK_NULL_HANDLE) {
+        if (vkAllocate(vk, req, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &img->memory)) return -1;
+        shared = img->memory;
+    }
+    VK_CHECK(vkBindImageMemory(vk->device, img->image, shared, 0));
+
+    VkImageViewCreateInfo view = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+    view.image = img->image;
+    view.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    view.format = format;
+    view.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    view.subresourceRange.levelCount = 1;
+    view.subresourceRange.layerCount = 1;
+    VK_CHECK(vkCreateImageView(vk->device, &view, NULL, &img->view));
+    return 0;
+}
+
+int vkUpload(VKDATA* vk, VKIMAGE* img, VkFormat format, int w, int h, int bpp, const unsigned char* pixels) {
+    if (vkCreateImage2D(vk, img, w, h, format, VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_NULL_HANDLE)) return -1;
+    VkDeviceSize size = (VkDeviceSize)w * h * bpp;
+    VkBuffer staging;
+    VkDeviceMemory stagingMemory;
+    if (vkBuffer(vk, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, &staging)) return -1;
+    VkMemoryRequirements req;
+    vkGetBufferMemoryRequirements(vk->device, staging, &req);
+    if (vkAllocate(vk, req, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &stagingMemory)) return -1;
+    VK_CHECK(vkBindBufferMemory(vk->device, staging, stagingMemory, 0));
+    void* mapped;
+    VK_CHECK(vkMapMemory(vk->device, stagingMemory, 0, size, 0, &mapped));
+    memcpy(mapped, pixels, size);
+    vkUnmapMemory(vk->device, stagingMemory);
+
+    VkCommandBufferAllocateInfo alloc = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+    alloc.commandPool = vk->uploadPool;
+    alloc.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc.commandBufferCount = 1;
+    VkCommandBuffer cmd;
+    VK_CHECK(vkAllocateCommandBuffers(vk->device, &alloc, &cmd));
+    VkCommandBufferBeginInfo begin = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(cmd, &begin);
+
+    VkImageMemoryBarrier barrier = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = img->image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.layerCount = 1;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+    VkBufferImageCopy copy = {};
+    copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copy.imageSubresource.layerCount = 1;
+    copy.imageExtent.width = w;
+    copy.imageExtent.height = h;
+    copy.imageExtent.depth = 1;
+    vkCmdCopyBufferToImage(cmd, staging, img->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy);
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
+    vkEndCommandBuffer(cmd);
+
+    VkSubmitInfo submit = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit.commandBufferCount = 1;
+    submit.pCommandBuffers = &cmd;
+    VK_CHECK(vkQueueSubmit(vk->queue, 1, &submit, VK_NULL_HANDLE));
+    vkQueueWaitIdle(vk->queue);
+    vkFreeCommandBuffers(vk->device, vk->uploadPool, 1, &cmd);
+    vkDestroyBuffer(vk->device, staging, NULL);
+    vkFreeMemory(vk->device, stagingMemory, NULL);
+    return 0;
+}
+
+int vkTexture(VKDATA* vk, VKIMAGE* img, const char* path) {
+    CIMAGE* image = cacheImage(path, 0);
+    if (image == NULL) {
+        errorCallback(-1, "Unable to load texture!");
+        return -1;
+    }
+    int result = vkUpload(vk, img, VK_FORMAT_R8G8B8A8_UNORM, image->width, image->height, 4, image->pixels);
+    releaseImage(image);
+    return result;
+}
+
+int vkGlyphAtlas(VKDATA* vk) {
+    unsigned char* pixels = buildGlyphAtlas(vk->glyphs);
+    if (pixels == NULL) return -1;
+    int result = vkUpload(vk, &vk->atlas, VK_FORMAT_R8_UNORM, GLYPH_ATLAS, GLYPH_ATLAS, 1, pixels);
+    HeapFree(GetProcessHeap(), 0, pixels);
+    return result;
+}
+
+//Same layout as drawText, but into a vertex buffer so every string is one draw.
+int vkText(VKDATA* vk, float* out, int count, char* message, float x, float y, float size) {
+    float xinit = x;
+    for (char* c = message; *c != '\0' && count < VK_TEXT_CHARS; c++) {
+        if (*c == '\n') {
+            x = xinit;
+            y += 68;
+        }
+        ATLASGLYPH g = vk->glyphs[*c & 0x7f];
+        float xpos = x + g.left * size;
+        float ypos = y - (g.height - g.top) * size;
+        float w = g.width * size;
+        float h = g.height * size;
+        float vertices[24] = {
+            xpos,   ypos + h, g.u0, g.v0,
+            xpos,   ypos,   g.u0, g.v1,
+            xpos + w, ypos,   g.u1, g.v1,
+            xpos,   ypos + h, g.u0, g.v0,
+            xpos + w, ypos,   g.u1, g.v1,
+            xpos + w, ypos + h, g.u1, g.v0
+        };
+        memcpy(out + count * 24, vertices, sizeof(vertices));
+        count++;
+        x += (g.advance >> 6) * size;
+    }
+    return count;
+}
+
+VkShaderModule vkShader(VKDATA* vk, const char* path) {
+    std::streamsize size;
+    char* code = readFile(path, &size);
+    VkShaderModule module = VK_NULL_HANDLE;
+    if (code == NULL) {
+        std::cout << "\033[0;91mMissing SPIR-V " << path << "\033[0m" << std::endl;
+        return module;
+    }
+    VkShaderModuleCreateInfo info = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+    info.codeSize = (size_t)size - 1;
+    info.pCode = (const uint32_t*)code;
+    vkCreateShaderModule(vk->device, &info, NULL, &module);
+    HeapFree(GetProcessHeap(), 0, code);
+    return module;
+}
+
+VkPipeline vkPipeline(VKDATA* vk, const char* vpath, const char* fpath, VkRenderPass pass, int attachments, int textLayout) {
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkShaderModule vs = vkShader(vk, vpath);
+    VkShaderModule fs = vkShader(vk, fpath);
+    if (vs == VK_NULL_HANDLE || fs == VK_NULL_HANDLE) return pipeline;
+
+    VkPipelineShaderStageCreateInfo stages[2] = {};
+    stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages[0].module = vs;
+    stages[0].pName = "main";
+    stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages[1].module = fs;
+    stages[1].pName = "main";
+
+    VkVertexInputBindingDescription binding = { 0, (uint32_t)((textLayout ? 4 : 5) * sizeof(float)), VK_VERTEX_INPUT_RATE_VERTEX };
+    VkVertexInputAttributeDescription attributes[2] = {
+        { 0, 0, textLayout ? VK_FORMAT_R32G32_SFLOAT : VK_FORMAT_R32G32B32_SFLOAT, 0 },
+        { 1, 0, VK_FORMAT_R32G32_SFLOAT, (uint32_t)((textLayout ? 2 : 3) * sizeof(float)) }
+    };
+    VkPipelineVertexInputStateCreateInfo input = { VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
+    input.vertexBindingDescriptionCount = 1;
+    input.pVertexBindingDescriptions = &binding;
+    input.vertexAttributeDescriptionCount = 2;
+    input.pVertexAttributeDescriptions = attributes;
+    VkPipelineInputAssemblyStateCreateInfo assembly = { VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO };
+    assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkPipelineViewportStateCreateInfo viewport = { VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
+    viewport.viewportCount = 1;
+    viewport.scissorCount = 1;
+    VkPipelineRasterizationStateCreateInfo raster = { VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO };
+    raster.polygonMode = VK_POLYGON_MODE_FILL;
+    raster.cullMode = VK_CULL_MODE_NONE;
+    raster.lineWidth = 1.0f;
+    VkPipelineMultisampleStateCreateInfo multisample = { VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO };
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    VkPipelineColorBlendAttachmentState blend[2] = {};
+    blend[0].colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    blend[1].colorWriteMask = blend[0].colorWriteMask;
+    VkPipelineColorBlendStateCreateInfo colorBlend = { VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO };
+    colorBlend.attachmentCount = attachments;
+    colorBlend.pAttachments = blend;
+    VkDynamicState dynamicStates[2] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamic = { VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO };
+    dynamic.dynamicStateCount = 2;
+    dynamic.pDynamicStates = dynamicStates;
+
+    VkGraphicsPipelineCreateInfo info = { VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
+    info.stageCount = 2;
+    info.pStages = stages;
+    info.pVertexInputState = &input;
+    info.pInputAssemblyState = &assembly;
+    info.pViewportState = &viewport;
+    info.pRasterizationState = &raster;
+    info.pMultisampleState = &multisample;
+    info.pColorBlendState = &colorBlend;
+    info.pDynamicState = &dynamic;
+    info.layout = vk->layout;
+    info.renderPass = pass;
+    vkCreateGraphicsPipelines(vk->device, VK_NULL_HANDLE, 1, &info, NULL, &pipeline);
+    vkDestroyShaderModule(vk->device, vs, NULL);
+    vkDestroyShaderModule(vk->device, fs, NULL);
+    if (pipeline != VK_NULL_HANDLE) std::cout << vpath << " and " << fpath << " compiled successfully." << std::endl;
+    return pipeline;
+}
+
+VkRenderPass vkRenderPass(VKDATA* vk, VkFormat format, int attachments, VkImageLayout finalLayout) {
+    VkAttachmentDescription desc[2] = {};
+    VkAttachmentReference refs[2] = {};
+    for (int i = 0; i < attachments; i++) {
+        desc[i].format = format;
+        desc[i].samples = VK_SAMPLE_COUNT_1_BIT;
+        desc[i].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        desc[i].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        desc[i].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        desc[i].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        //Always UNDEFINED: every pass rewrites its targets, and the aliased bloom targets must not be preserved
+        desc[i].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        desc[i].finalLayout = finalLayout;
+        refs[i].attachment = i;
+        refs[i].layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    }
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = attachments;
+    subpass.pColorAttachments = refs;
+    VkSubpassDependency deps[2] = {};
+    deps[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    deps[0].dstSubpass = 0;
+    deps[0].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    deps[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    deps[0].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    deps[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    deps[1].srcSubpass = 0;
+    deps[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    deps[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    deps[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    deps[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    deps[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    VkRenderPassCreateInfo info = { VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
+    info.attachmentCount = attachments;
+    info.pAttachments = desc;
+    info.subpassCount = 1;
+    info.pSubpasses = &subpass;
+    info.dependencyCount = 2;
+    info.pDependencies = deps;
+    VkRenderPass pass = VK_NULL_HANDLE;
+    vkCreateRenderPass(vk->device, &info, NULL, &pass);
+    return pass;
+}
+
+VkFramebuffer vkFramebuffer(VKDATA* vk, VkRenderPass pass, VkImageView* views, int count, int w, int h) {
+    VkFramebufferCreateInfo info = { VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO };
+    info.renderPass = pass;
+    info.attachmentCount = count;
+    info.pAttachments = views;
+    info.width = w;
+    info.height = h;
+    info.layers = 1;
+    VkFramebuffer fb = VK_NULL_HANDLE;
+    vkCreateFramebuffer(vk->device, &info, NULL, &fb);
+    return fb;
+}
+
+int vkSwapchain(VKDATA* vk) {
+    VkSurfaceCapabilitiesKHR caps;
+    VK_CHECK(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vk->gpu, vk->surface, &caps));
+    uint32_t formatCount = 0;
+    vkGetPhysicalDeviceSurfaceFormatsKHR(vk->gpu, vk->surface, &formatCount, NULL);
+    VkSurfaceFormatKHR formats[64];
+    if (formatCount > 64) formatCount = 64;
+    vkGetPhysicalDeviceSurfaceFormatsKHR(vk->gpu, vk->surface, &formatCount, formats);
+    VkSurfaceFormatKHR chosen = formats[0];
+    for (uint32_t i = 0; i < formatCount; i++) {
+        if (formats[i].format == VK_FORMAT_B8G8R8A8_UNORM || formats[i].format == VK_FORMAT_R8G8B8A8_UNORM) chosen = formats[i];
+    }
+    vk->format = chosen.format;
+    vk->extent = caps.currentExtent;
+    if (vk->extent.width == 0xFFFFFFFF) {
+        int w, h;
+        glfwGetFramebufferSize(vk->window, &w, &h);
+        vk->extent.width = w;
+        vk->extent.height = h;
+    }
+
+    VkSwapchainCreateInfoKHR info = { VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR };
+    info.surface = vk->surface;
+    info.minImageCount = caps.minImageCount + 1;
+    if (caps.maxImageCount > 0 && info.minImageCount > caps.maxImageCount) info.minImageCount = caps.maxImageCount;
+    if (info.minImageCount > 8) info.minImageCount = 8;
+    info.imageFormat = chosen.format;
+    info.imageColorSpace = chosen.colorSpace;
+    info.imageExtent = vk->extent;
+    info.imageArrayLayers = 1;
+    info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    info.preTransform = caps.currentTransform;
+    info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    info.presentMode = VK_PRESENT_MODE_FIFO_KHR;
+    info.clipped = VK_TRUE;
+    info.oldSwapchain = vk->swapchain;
+    VkSwapchainKHR swapchain;
+    VK_CHECK(vkCreateSwapchainKHR(vk->device, &info, NULL, &swapchain));
+    if (vk->swapchain != VK_NULL_HANDLE) {
+        for (uint32_t i = 0; i < vk->imageCount; i++) {
+            vkDestroyFramebuffer(vk->device, vk->swapFramebuffers[i], NULL);
+            vkDestroyImageView(vk->device, vk->swapViews[i], NULL);
+        }
+        vkDestroySwapchainKHR(vk->device, vk->swapchain, NULL);
+    }
+    vk->swapchain = swapchain;
+
+    vk->imageCount = 8;
+    VK_CHECK(vkGetSwapchainImagesKHR(vk->device, vk->swapchain, &vk->imageCount, vk->swapImages));
+    for (uint32_t i = 0; i < vk->imageCount; i++) {
+        VkImageViewCreateInfo view = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+        view.image = vk->swapImages[i];
+        view.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        view.format = vk->format;
+        view.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        view.subresourceRange.levelCount = 1;
+        view.subresourceRange.layerCount = 1;
+        VK_CHECK(vkCreateImageView(vk->device, &view, NULL, &vk->swapViews[i]));
+        if (vk->presentPass != VK_NULL_HANDLE) vk->swapFramebuffers[i] = vkFramebuffer(vk, vk->presentPass, &vk->swapViews[i], 1, vk->extent.width, vk->extent.height);
+        if (vk->rendered[i] == VK_NULL_HANDLE) {
+            VkSemaphoreCreateInfo sem = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+            VK_CHECK(vkCreateSemaphore(vk->device, &sem, NULL, &vk->rendered[i]));
+        }
+    }
+    return 0;
+}
+
+VkDescriptorSet vkTextureSet(VKDATA* vk, VKIMAGE* a, VKIMAGE* b, VKIMAGE* c, VkSampler sampler) {
+    VkDescriptorSetAllocateInfo alloc = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+    alloc.descriptorPool = vk->pool;
+    alloc.descriptorSetCount = 1;
+    alloc.pSetLayouts = &vk->textureLayout;
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    if (vkAllocateDescriptorSets(vk->device, &alloc, &set) != VK_SUCCESS) return set;
+    VKIMAGE* images[3] = { a, b, c };
+    VkDescriptorImageInfo infos[3];
+    VkWriteDescriptorSet writes[3] = {};
+    for (int i = 0; i < 3; i++) {
+        infos[i].sampler = sampler;
+        infos[i].imageView = images[i]->view;
+        infos[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = set;
+        writes[i].dstBinding = i;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        writes[i].pImageInfo = &infos[i];
+    }
+    vkUpdateDescriptorSets(vk->device, 3, writes, 0, NULL);
+    return set;
+}
+
+void vkBeginPass(VkCommandBuffer cmd, VkRenderPass pass, VkFramebuffer fb, VkExtent2D extent, float clear) {
+    VkClearValue clears[2];
+    for (int i = 0; i < 2; i++) {
+        clears[i].color.float32[0] = clear;
+        clears[i].color.float32[1] = clear;
+        clears[i].color.float32[2] = clear;
+        clears[i].color.float32[3] = 1.0f;
+    }
+    VkRenderPassBeginInfo begin = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+    begin.renderPass = pass;
+    begin.framebuffer = fb;
+    begin.renderArea.extent = extent;
+    begin.clearValueCount = 2;
+    begin.pClearValues = clears;
+    vkCmdBeginRenderPass(cmd, &begin, VK_SUBPASS_CONTENTS_INLINE);
+    VkViewport viewport = { 0.0f, 0.0f, (float)extent.width, (float)extent.height, 0.0f, 1.0f };
+    VkRect2D scissor = { { 0, 0 }, extent };
+    vkCmdSetViewport(cmd, 0, 1, &viewport);
+    vkCmdSetScissor(cmd, 0, 1, &scissor);
+}
+
+void vkDrawQuad(VKDATA* vk, VkCommandBuffer cmd, VkPipeline pipeline, VkDescriptorSet textures, VKPUSH* push, int quad) {
+    VkDescriptorSet sets[2] = { vk->frameSets[vk->slot], textures };
+    VkDeviceSize offset = 0;
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, vk->layout, 0, 2, sets, 0, NULL);
+    vkCmdPushConstants(cmd, vk->layout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(VKPUSH), push);
+    vkCmdBindVertexBuffers(cmd, 0, 1, &vk->quads, &offset);
+    vkCmdBindIndexBuffer(cmd, vk->quads, sizeof(quadVertices), VK_INDEX_TYPE_UINT32);
+    vkCmdDrawIndexed(cmd, 6, 1, 0, quad * 4, 0);
+}
+
+void vkRecordLight(VKDATA* vk, VkCommandBuffer cmd) {
+    VKPUSH push = {};
+    push.flipY = 1.0f;
+    VkExtent2D extent = { (uint32_t)vk->lit.width, (uint32_t)vk->lit.height };
+    vkBeginPass(cmd, vk->hdrPass, vk->litFB, extent, 0.0f);
+    //Set 2 holds the theme fading out; the shader only samples it mid-crossfade
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, vk->layout, 2, 1, &vk->themeSets[vk->themePrevious], 0, NULL);
+    vkDrawQuad(vk, cmd, vk->light, vk->themeSets[vk->themeCurrent], &push, Q_BANNER);
+    vkCmdEndRenderPass(cmd);
+}
+
+void vkRecordBloom(VKDATA* vk, VkCommandBuffer cmd) {
+    VKPUSH push = {};
+    VkExtent2D extent = { (uint32_t)vk->ping.width, (uint32_t)vk->ping.height };
+    push.flipY = 1.0f;
+    push.horizontal = 1;
+    vkBeginPass(cmd, vk->blurPass, vk->pingFB, extent, 0.0f);
+    vkDrawQuad(vk, cmd, vk->bloom, vk->brightSet, &push, Q_BANNER);
+    vkCmdEndRenderPass(cmd);
+    for (int i = 0; i <= BLOOM_PASSES; i++) {
+        //The first vertical pass is where [pong] takes over [bright]'s memory
+        push.horizontal = 0;
+        vkBeginPass(cmd, vk->blurPass, vk->pongFB, extent, 0.0f);
+        vkDrawQuad(vk, cmd, vk->bloom, vk->pingSet, &push, Q_BANNER);
+        vkCmdEndRenderPass(cmd);
+        if (i == BLOOM_PASSES) break;
+        push.horizontal = 1;
+        vkBeginPass(cmd, vk->blurPass, vk->pingFB, extent, 0.0f);
+        vkDrawQuad(vk, cmd, vk->bloom, vk->pongSet, &push, Q_BANNER);
+        vkCmdEndRenderPass(cmd);
+    }
+}
+
+void vkRecordComposite(VKDATA* vk, VkCommandBuffer cmd) {
+    FRAME* frame = vk->frame;
+    VKPUSH push = {};
+    push.flipY = -1.0f; //Only the swapchain is flipped, offscreen targets keep GL's row order
+    vkBeginPass(cmd, vk->presentPass, vk->swapFramebuffers[vk->imageIndex], vk->extent, frame->slideshow ? 1.0f : 0.0f);
+    if (!frame->slideshow) {
+        vkDrawQuad(vk, cmd, vk->assembly, vk->assemblySet, &push, Q_BANNER);
+    }else {
+        glm::mat4 rotation = dotRotation(PI / 3, frame->width, frame->height);
+        memcpy(push.rot, &rotation[0][0], sizeof(push.rot));
+        push.offs = frame->dotOffset;
+        vkDrawQuad(vk, cmd, vk->dots, vk->dotSet, &push, Q_DOTS);
+        rotation = dotRotation(PI * 7 / 6, frame->width, frame->height);
+        memcpy(push.rot, &rotation[0][0], sizeof(push.rot));
+        vkDrawQuad(vk, cmd, vk->dots, vk->dotSet, &push, Q_DOTS);
+
+        push.xOffs = -frame->slideTransition;
+        if (vk->slideCount > 0) vkDrawQuad(vk, cmd, vk->flat, vk->slideSets[frame->slide], &push, Q_SLIDE);
+        push.xOffs = -frame->slideTransition + 2.0f;
+        if (vk->slideCount > 0) vkDrawQuad(vk, cmd, vk->flat, vk->slideSets[frame->nextSlide], &push, Q_SLIDE);
+        push.xOffs = 0.0f;
+        vkDrawQuad(vk, cmd, vk->flat, vk->overlaySet, &push, Q_OVERLAY);
+
+        VkDescriptorSet sets[2] = { vk->frameSets[vk->slot], vk->glyphSet };
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, vk->text);
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, vk->layout, 0, 2, sets, 0, NULL);
+        VkDeviceSize textStart = 0; //The buffer is already bound at its place in host memory
+        vkCmdBindVertexBuffers(cmd, 0, 1, &vk->textVertices[vk->slot], &textStart);
+        push.textColor[0] = push.textColor[1] = push.textColor[2] = 1.0f;
+        vkCmdPushConstants(cmd, vk->layout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(VKPUSH), &push);
+        vkCmdDraw(cmd, vk->textCount[0] * 6, 1, 0, 0);
+        push.textColor[0] = 0.97647f;
+        push.textColor[1] = 0.92549f;
+        push.textColor[2] = 0.35686f;
+        vkCmdPushConstants(cmd, vk->layout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(VKPUSH), &push);
+        vkCmdDraw(cmd, (vk->textCount[1] - vk->textCount[0]) * 6, 1, vk->textCount[0] * 6, 0);
+    }
+    vkCmdEndRenderPass(cmd);
+}
+
+DWORD WINAPI VulkanWorker(LPVOID lpParam) {
+    VKJOB* job = (VKJOB*)lpParam;
+    VKDATA* vk = job->vk;
+    while (true) {
+        WaitForSingleObject(job->start, INFINITE);
+        if (!vk->running) break;
+        job->recorded = 0;
+        if (job->index == VK_JOB_COMPOSITE || !vk->frame->slideshow) {
+            VkCommandBuffer cmd = vk->commands[vk->slot][job->index];
+            VkCommandBufferBeginInfo begin = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            vkBeginCommandBuffer(cmd, &begin);
+            if (job->index == VK_JOB_LIGHT) vkRecordLight(vk, cmd);
+            else if (job->index == VK_JOB_BLOOM) vkRecordBloom(vk, cmd);
+            else vkRecordComposite(vk, cmd);
+            vkEndCommandBuffer(cmd);
+            job->recorded = 1;
+        }
+        SetEvent(job->done);
+    }
+    return 0;
+}
+
+int vkInit(void* data, GLFWwindow* window, int width, int height) {
+    VKDATA* vk = (VKDATA*)data;
+    vk->window = window;
+    gladLoadVulkanUserPtr(NULL, (GLADuserptrloadfunc)glfwGetInstanceProcAddress, NULL);
+
+    uint32_t extensionCount;
+    const char** extensions = glfwGetRequiredInstanceExtensions(&extensionCount);
+    VkApplicationInfo app = { VK_STRUCTURE_TYPE_APPLICATION_INFO };
+    app.pApplicationName = "Nashville Nights Band Digital Banner";
+    app.apiVersion = VK_API_VERSION_1_2;
+    VkInstanceCreateInfo instanceInfo = { VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO };
+    instanceInfo.pApplicationInfo = &app;
+    instanceInfo.enabledExtensionCount = extensionCount;
+    instanceInfo.ppEnabledExtensionNames = extensions;
+    VK_CHECK(vkCreateInstance(&instanceInfo, NULL, &vk->instance));
+    gladLoadVulkanUserPtr(NULL, (GLADuserptrloadfunc)glfwGetInstanceProcAddress, vk->instance);
+    VK_CHECK(glfwCreateWindowSurface(vk->instance, window, NULL, &vk->surface));
+
+    //Take the first real GPU; a CPU device (lavapipe) is only used when nothing else can present
+    uint32_t gpuCount = 0;
+    vkEnumeratePhysicalDevices(vk->instance, &gpuCount, NULL);
+    VkPhysicalDevice gpus[16];
+    if (gpuCount > 16) gpuCount = 16;
+    vkEnumeratePhysicalDevices(vk->instance, &gpuCount, gpus);
+    int best = -1;
+    for (uint32_t i = 0; i < gpuCount; i++) {
+        VkPhysicalDeviceProperties props;
+        vkGetPhysicalDeviceProperties(gpus[i], &props);
+        if (props.apiVersion < VK_API_VERSION_1_2) continue;
+        uint32_t familyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(gpus[i], &familyCount, NULL);
+        VkQueueFamilyProperties families[16];
+        if (familyCount > 16) familyCount = 16;
+        vkGetPhysicalDeviceQueueFamilyProperties(gpus[i], &familyCount, families);
+        for (uint32_t f = 0; f < familyCount; f++) {
+            VkBool32 present = VK_FALSE;
+            vkGetPhysicalDeviceSurfaceSupportKHR(gpus[i], f, vk->surface, &present);
+            if (!(families[f].queueFlags & VK_QUEUE_GRAPHICS_BIT) || !present) continue;
+            int score = props.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU ? 3 : props.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU ? 1 : 2;
+            if (score > best) {
+                best = score;
+                vk->gpu = gpus[i];
+                vk->queueFamily = f;
+            }
+            break;
+        }
+    }
+    if (best < 0) {
+        errorCallback(-1, "No Vulkan 1.2 device can present to this window.");
+        return -1;
+    }
+    VkPhysicalDeviceProperties gpuProps;
+    vkGetPhysicalDeviceProperties(vk->gpu, &gpuProps);
+    std::cout << "Vulkan device: " << gpuProps.deviceName << std::endl;
+    gladLoadVulkanUserPtr(vk->gpu, (GLADuserptrloadfunc)glfwGetInstanceProcAddress, vk->instance);
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queueInfo = { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+    queueInfo.queueFamilyIndex = vk->queueFamily;
+    queueInfo.queueCount = 1;
+    queueInfo.pQueuePriorities = &priority;
+    VkPhysicalDeviceVulkan12Features features12 = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES };
+    features12.timelineSemaphore = VK_TRUE;
+    const char* deviceExtensions[1] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    VkDeviceCreateInfo deviceInfo = { VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
+    deviceInfo.pNext = &features12;
+    deviceInfo.queueCreateInfoCount = 1;
+    deviceInfo.pQueueCreateInfos = &queueInfo;
+    deviceInfo.enabledExtensionCount = 1;
+    deviceInfo.ppEnabledExtensionNames = deviceExtensions;
+    VK_CHECK(vkCreateDevice(vk->gpu, &deviceInfo, NULL, &vk->device));
+    vkGetDeviceQueue(vk->device, vk->queueFamily, 0, &vk->queue);
+
+    VkCommandPoolCreateInfo poolInfo = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    poolInfo.queueFamilyIndex = vk->queueFamily;
+    VK_CHECK(vkCreateCommandPool(vk->device, &poolInfo, NULL, &vk->uploadPool));
+    for (int f = 0; f < VK_FRAMES; f++) {
+        for (int j = 0; j < VK_WORKERS; j++) {
+            //One pool per worker per frame in flight, so recording never needs a lock
+            VK_CHECK(vkCreateCommandPool(vk->device, &poolInfo, NULL, &vk->pools[f][j]));
+            VkCommandBufferAllocateInfo alloc = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            alloc.commandPool = vk->pools[f][j];
+            alloc.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            alloc.commandBufferCount = 1;
+            VK_CHECK(vkAllocateCommandBuffers(vk->device, &alloc, &vk->commands[f][j]));
+        }
+        VkSemaphoreCreateInfo sem = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+        VK_CHECK(vkCreateSemaphore(vk->device, &sem, NULL, &vk->acquired[f]));
+    }
+    VkSemaphoreTypeCreateInfo timelineType = { VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO };
+    timelineType.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    timelineType.initialValue = 0;
+    VkSemaphoreCreateInfo timelineInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+    timelineInfo.pNext = &timelineType;
+    VK_CHECK(vkCreateSemaphore(vk->device, &timelineInfo, NULL, &vk->timeline));
+
+    if (vkSwapchain(vk)) return -1;
+    vk->hdrPass = vkRenderPass(vk, VK_FORMAT_R16G16B16A16_SFLOAT, 2, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vk->blurPass = vkRenderPass(vk, VK_FORMAT_R16G16B16A16_SFLOAT, 1, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    vk->presentPass = vkRenderPass(vk, vk->format, 1, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+    for (uint32_t i = 0; i < vk->imageCount; i++) vk->swapFramebuffers[i] = vkFramebuffer(vk, vk->presentPass, &vk->swapViews[i], 1, vk->extent.width, vk->extent.height);
+
+    VkImageUsageFlags targetUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    if (vkCreateImage2D(vk, &vk->lit, width, height, VK_FORMAT_R16G16B16A16_SFLOAT, targetUsage, VK_NULL_HANDLE)) return -1;
+    if (vkCreateImage2D(vk, &vk->ping, width, height, VK_FORMAT_R16G16B16A16_SFLOAT, targetUsage, VK_NULL_HANDLE)) return -1;
+    if (vkCreateImage2D(vk, &vk->bright, width, height, VK_FORMAT_R16G16B16A16_SFLOAT, targetUsage, VK_NULL_HANDLE)) return -1;
+    vk->bloomMemory = vk->bright.memory;
+    if (vkCreateImage2D(vk, &vk->pong, width, height, VK_FORMAT_R16G16B16A16_SFLOAT, targetUsage, vk->bloomMemory)) return -1;
+    VkImageView litViews[2] = { vk->lit.view, vk->bright.view };
+    vk->litFB = vkFramebuffer(vk, vk->hdrPass, litViews, 2, width, height);
+    vk->pingFB = vkFramebuffer(vk, vk->blurPass, &vk->ping.view, 1, width, height);
+    vk->pongFB = vkFramebuffer(vk, vk->blurPass, &vk->pong.view, 1, width, height);
+
+    std::cout << "Generating Textures..." << std::endl;
+    //There is no staging ring here, so every theme that fits the budget goes up now and a switch only swaps descriptor sets
+    unsigned char flat[THEME_MAPS][4] = { { 255, 255, 255, 255 }, { 128, 128, 255, 255 }, { 0, 0, 0, 255 } };
+    for (int k = 0; k < THEME_MAPS; k++) if (vkUpload(vk, &vk->flatMaps[k], VK_FORMAT_R8G8B8A8_UNORM, 1, 1, 4, flat[k])) return -1;
+    LONG64 themeBytes = 0;
+    for (int i = 0; i < themeCount; i++) {
+        LONG64 bytes = 0;
+        int ok = 1;
+        for (int k = 0; k < THEME_MAPS && ok; k++) {
+            int w, h, c;
+            if (themeTable[i].maps[k] == NULL) continue;
+            ok = stbi_info(themeTable[i].maps[k], &w, &h, &c);
+            bytes += (LONG64)w * h * 4;
+        }
+        if (!ok || themeBytes + bytes > THEME_BUDGET) {
+            errorCallback(-1, "Theme map missing or over THEME_BUDGET; the theme is left out.");
+            continue;
+        }
+        for (int k = 0; k < THEME_MAPS && ok; k++) if (themeTable[i].maps[k] != NULL) ok = !vkTexture(vk, &vk->themeMaps[i][k], themeTable[i].maps[k]);
+        if (!ok) return -1;
+        themeBytes += bytes;
+        vk->themeReady[i] = 1;
+    }
+    vk->themeCurrent = *vk->themeRequest >= 0 && *vk->themeRequest < themeCount && vk->themeReady[*vk->themeRequest] ? *vk->themeRequest : 0;
+    if (!vk->themeReady[vk->themeCurrent]) return -1;
+    vk->themePrevious = vk->themeCurrent;
+    vk->themeFade = 1.0f;
+    *vk->themeRequest = vk->themeCurrent;
+    if (vkTexture(vk, &vk->overlay, "./img/90banner.png")) return -1;
+    if (vkTexture(vk, &vk->dotMatrix, "./img/dotmatrix.png")) return -1;
+    std::cout << "Loading font..." << std::endl;
+    if (vkGlyphAtlas(vk)) return -1;
+    char slidePath[60];
+    std::ifstream slideFile;
+    for (vk->slideCount = 0; vk->slideCount < 32; vk->slideCount++) {
+        sprintf_s(slidePath, "./http/slides/s%d.png", vk->slideCount);
+        slideFile.open(slidePath);
+        if (!slideFile.is_open()) break; //Animated slides are GL only for now
+        slideFile.close();
+        if (vkTexture(vk, &vk->slides[vk->slideCount], slidePath)) return -1;
+    }
+
+    VkSamplerCreateInfo samplerInfo = { VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+    samplerInfo.magFilter = VK_FILTER_LINEAR;
+    samplerInfo.minFilter = VK_FILTER_LINEAR;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    VK_CHECK(vkCreateSampler(vk->device, &samplerInfo, NULL, &vk->clampSampler));
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    VK_CHECK(vkCreateSampler(vk->device, &samplerInfo, NULL, &vk->repeatSampler));
+
+    VkDescriptorSetLayoutBinding uniformBinding = { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, NULL };
+    VkDescriptorSetLayoutCreateInfo layoutInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &uniformBinding;
+    VK_CHECK(vkCreateDescriptorSetLayout(vk->device, &layoutInfo, NULL, &vk->frameLayout));
+    VkDescriptorSetLayoutBinding textureBindings[3];
+    for (int i = 0; i < 3; i++) textureBindings[i] = { (uint32_t)i, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, NULL };
+    layoutInfo.bindingCount = 3;
+    layoutInfo.pBindings = textureBindings;
+    VK_CHECK(vkCreateDescriptorSetLayout(vk->device, &layoutInfo, NULL, &vk->textureLayout));
+    VkDescriptorSetLayout setLayouts[3] = { vk->frameLayout, vk->textureLayout, vk->textureLayout };
+    VkPushConstantRange pushRange = { VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(VKPUSH) };
+    VkPipelineLayoutCreateInfo pipelineLayout = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+    pipelineLayout.setLayoutCount = 3;
+    pipelineLayout.pSetLayouts = setLayouts;
+    pipelineLayout.pushConstantRangeCount = 1;
+    pipelineLayout.pPushConstantRanges = &pushRange;
+    VK_CHECK(vkCreatePipelineLayout(vk->device, &pipelineLayout, NULL, &vk->layout));
+
+    VkDescriptorPoolSize poolSizes[2] = {
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_FRAMES },
+        { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 3 * (48 + THEME_MAX) }
+    };
+    VkDescriptorPoolCreateInfo descriptorPool = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+    descriptorPool.maxSets = VK_FRAMES + 48 + THEME_MAX;
+    descriptorPool.poolSizeCount = 2;
+    descriptorPool.pPoolSizes = poolSizes;
+    VK_CHECK(vkCreateDescriptorPool(vk->device, &descriptorPool, NULL, &vk->pool));
+    for (int i = 0; i < themeCount; i++) {
+        if (!vk->themeReady[i]) continue;
+        VKIMAGE* maps[THEME_MAPS];
+        for (int k = 0; k < THEME_MAPS; k++) maps[k] = themeTable[i].maps[k] != NULL ? &vk->themeMaps[i][k] : &vk->flatMaps[k];
+        vk->themeSets[i] = vkTextureSet(vk, maps[0], maps[1], maps[2], vk->repeatSampler);
+    }
+    vk->brightSet = vkTextureSet(vk, &vk->bright, &vk->bright, &vk->bright, vk->clampSampler);
+    vk->pingSet = vkTextureSet(vk, &vk->ping, &vk->ping, &vk->ping, vk->clampSampler);
+    vk->pongSet = vkTextureSet(vk, &vk->pong, &vk->pong, &vk->pong, vk->clampSampler);
+    vk->assemblySet = vkTextureSet(vk, &vk->lit, &vk->pong, &vk->pong, vk->clampSampler);
+    vk->overlaySet = vkTextureSet(vk, &vk->overlay, &vk->overlay, &vk->overlay, vk->repeatSampler);
+    vk->dotSet = vkTextureSet(vk, &vk->dotMatrix, &vk->dotMatrix, &vk->dotMatrix, vk->repeatSampler);
+    vk->glyphSet = vkTextureSet(vk, &vk->atlas, &vk->atlas, &vk->atlas, vk->clampSampler);
+    for (unsigned int i = 0; i < vk->slideCount; i++) vk->slideSets[i] = vkTextureSet(vk, &vk->slides[i], &vk->slides[i], &vk->slides[i], vk->repeatSampler);
+
+    //Static quads and indices in one device buffer, per-frame uniforms and text in one mapped host buffer
+    VkMemoryRequirements req;
+    if (vkBuffer(vk, sizeof(quadVertices) + sizeof(quadIndices), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, &vk->quads)) return -1;
+    vkGetBufferMemoryRequirements(vk->device, vk->quads, &req);
+    if (vkAllocate(vk, req, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &vk->quadMemory)) return -1;
+    VK_CHECK(vkBindBufferMemory(vk->device, vk->quads, vk->quadMemory, 0));
+    void* quadMapped;
+    VK_CHECK(vkMapMemory(vk->device, vk->quadMemory, 0, VK_WHOLE_SIZE, 0, &quadMapped));
+    memcpy(quadMapped, quadVertices, sizeof(quadVertices));
+    memcpy((char*)quadMapped + sizeof(quadVertices), quadIndices, sizeof(quadIndices));
+    vkUnmapMemory(vk->device, vk->quadMemory);
+
+    VkDeviceSize hostSize = 0;
+    VkMemoryRequirements uniformReq, textReq;
+    for (int f = 0; f < VK_FRAMES; f++) {
+        if (vkBuffer(vk, sizeof(VKUNIFORMS), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, &vk->uniforms[f])) return -1;
+        if (vkBuffer(vk, VK_TEXT_CHARS * 24 * sizeof(float), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, &vk->textVertices[f])) return -1;
+        vkGetBufferMemoryRequirements(vk->device, vk->uniforms[f], &uniformReq);
+        vkGetBufferMemoryRequirements(vk->device, vk->textVertices[f], &textReq);
+        hostSize = (hostSize + uniformReq.alignment - 1) / uniformReq.alignment * uniformReq.alignment;
+        vk->uniformOffset[f] = hostSize;
+        hostSize += uniformReq.size;
+        hostSize = (hostSize + textReq.alignment - 1) / textReq.alignment * textReq.alignment;
+        vk->textOffset[f] = hostSize;
+        hostSize += textReq.size;
+    }
+    req.size = hostSize;
+    req.memoryTypeBits = uniformReq.memoryTypeBits & textReq.memoryTypeBits;
+    if (vkAllocate(vk, req, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, &vk->hostMemory)) return -1;
+    VK_CHECK(vkMapMemory(vk->device, vk->hostMemory, 0, VK_WHOLE_SIZE, 0, (void**)&vk->hostMapped));
+    for (int f = 0; f < VK_FRAMES; f++) {
+        VK_CHECK(vkBindBufferMemory(vk->device, vk->uniforms[f], vk->hostMemory, vk->uniformOffset[f]));
+        VK_CHECK(vkBindBufferMemory(vk->device, vk->textVertices[f], vk->hostMemory, vk->textOffset[f]));
+        VkDescriptorSetAllocateInfo alloc = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+        alloc.descriptorPool = vk->pool;
+        alloc.descriptorSetCount = 1;
+        alloc.pSetLayouts = &vk->frameLayout;
+        VK_CHECK(vkAllocateDescriptorSets(vk->device, &alloc, &vk->frameSets[f]));
+        VkDescriptorBufferInfo bufferInfo = { vk->uniforms[f], 0, sizeof(VKUNIFORMS) };
+        VkWriteDescriptorSet write = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+        write.dstSet = vk->frameSets[f];
+        write.dstBinding = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        write.pBufferInfo = &bufferInfo;
+        vkUpdateDescriptorSets(vk->device, 1, &write, 0, NULL);
+    }
+
+    vk->light = vkPipeline(vk, "shader\\vk\\bgmain.vert.spv", "shader\\vk\\light.frag.spv", vk->hdrPass, 2, 0);
+    vk->bloom = vkPipeline(vk, "shader\\vk\\flat.vert.spv", "shader\\vk\\bloom.frag.spv", vk->blurPass, 1, 0);
+    vk->assembly = vkPipeline(vk, "shader\\vk\\flat.vert.spv", "shader\\vk\\assembly.frag.spv", vk->presentPass, 1, 0);
+    vk->flat = vkPipeline(vk, "shader\\vk\\flat.vert.spv", "shader\\vk\\flat.frag.spv", vk->presentPass, 1, 0);
+    vk->dots = vkPipeline(vk, "shader\\vk\\dot.vert.spv", "shader\\vk\\flat.frag.spv", vk->presentPass, 1, 0);
+    vk->text = vkPipeline(vk, "shader\\vk\\text.vert.spv", "shader\\vk\\text.frag.spv", vk->presentPass, 1, 1);
+    if (!vk->light || !vk->bloom || !vk->assembly || !vk->flat || !vk->dots || !vk->text) return -1;
+    std::cout << "Shaders Compiled!" << std::endl;
+
+    vk->running = 1;
+    for (int j = 0; j < VK_WORKERS; j++) {
+        vk->jobs[j].vk = vk;
+        vk->jobs[j].index = j;
+        vk->jobs[j].start = CreateEventA(NULL, FALSE, FALSE, NULL);
+        vk->jobs[j].done = CreateEventA(NULL, FALSE, FALSE, NULL);
+        vk->done[j] = vk->jobs[j].done;
+        DWORD workerID;
+        vk->jobs[j].thread = CreateThread(NULL, 0, VulkanWorker, &vk->jobs[j], 0, &workerID);
+    }
+    return 0;
+}
+
+void vkDrawFrame(void* data, FRAME* frame) {
+    VKDATA* vk = (VKDATA*)data;
+    vk->skip = 1;
+    vk->frameNumber++;
+    vk->slot = vk->frameNumber % VK_FRAMES;
+    if (vk->frameNumber > VK_FRAMES) {
+        //Never more than VK_FRAMES ahead of the GPU; this is the only place the CPU waits
+        uint64_t value = vk->frameNumber - VK_FRAMES;
+        VkSemaphoreWaitInfo wait = { VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+        wait.semaphoreCount = 1;
+        wait.pSemaphores = &vk->timeline;
+        wait.pValues = &value;
+        vkWaitSemaphores(vk->device, &wait, UINT64_MAX);
+    }
+    VkResult result = vkAcquireNextImageKHR(vk->device, vk->swapchain, UINT64_MAX, vk->acquired[vk->slot], VK_NULL_HANDLE, &vk->imageIndex);
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+        vkDeviceWaitIdle(vk->device);
+        vkSwapchain(vk);
+        vk->frameNumber--;
+        return;
+    }
+    for (int j = 0; j < VK_WORKERS; j++) vkResetCommandPool(vk->device, vk->pools[vk->slot][j], 0);
+
+    VKUNIFORMS* uniforms = (VKUNIFORMS*)(vk->hostMapped + vk->uniformOffset[vk->slot]);
+    glm::mat4 pm = glm::transpose(glm::perspective(2.65625f, (1.0f * frame->width) / frame->height, 0.1f, 100.0f));
+    glm::mat4 orth = glm::ortho(0.0f, (float)frame->width, 0.0f, (float)frame->height, -1.f, 1.f);
+    memcpy(uniforms->pm, &pm[0][0], sizeof(uniforms->pm));
+    memcpy(uniforms->proj, &orth[0][0], sizeof(uniforms->proj));
+    for (int i = 0; i < 3; i++) {
+        uniforms->rl[i] = frame->rl[i];
+        uniforms->gl[i] = frame->gl[i];
+        uniforms->bl[i] = frame->bl[i];
+        uniforms->wl[i] = frame->wl[i];
+    }
+    //Themes switch and crossfade the way themeFrame does it, less the loading
+    int request = *vk->themeRequest;
+    if (request >= 0 && request < themeCount && request != vk->themeCurrent) {
+        if (vk->themeReady[request]) {
+            vk->themePrevious = vk->themeCurrent;
+            vk->themeCurrent = request;
+            vk->themeFade = 0.0f;
+            std::cout << "Theme switched to " << themeTable[request].name << std::endl;
+        }else *vk->themeRequest = vk->themeCurrent;
+    }
+    if (vk->themeFade < 1.0f) {
+        vk->themeFade += (float)(frame->dt / THEME_FADE);
+        if (vk->themeFade >= 1.0f) {
+            vk->themeFade = 1.0f;
+            vk->themePrevious = vk->themeCurrent;
+        }
+    }
+    memcpy(&uniforms->from, frame->scene, offsetof(SCENE, start));
+    uniforms->clock[0] = (float)(frame->scene->now - frame->scene->start);
+    uniforms->clock[1] = vk->themeFade;
+    if (frame->slideshow) {
+        float* text = (float*)(vk->hostMapped + vk->textOffset[vk->slot]);
+        int count = vkText(vk, text, 0, frame->clock, 100, frame->height - 50, 0.5f);
+        vk->textCount[0] = vkText(vk, text, count, frame->showtime, 100, frame->height - 105, 0.5f);
+        vk->textCount[1] = vkText(vk, text, vk->textCount[0], frame->venue, 650, frame->height - 90, 0.7f);
+    }
+
+    vk->frame = frame;
+    for (int j = 0; j < VK_WORKERS; j++) SetEvent(vk->jobs[j].start);
+    WaitForMultipleObjects(VK_WORKERS, vk->done, TRUE, INFINITE);
+
+    VkCommandBuffer buffers[VK_WORKERS];
+    uint32_t bufferCount = 0;
+    for (int j = 0; j < VK_WORKERS; j++) if (vk->jobs[j].recorded) buffers[bufferCount++] = vk->commands[vk->slot][j];
+    VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    VkSemaphore signals[2] = { vk->rendered[vk->imageIndex], vk->timeline };
+    uint64_t signalValues[2] = { 0, vk->frameNumber };
+    uint64_t waitValue = 0;
+    VkTimelineSemaphoreSubmitInfo timelineSubmit = { VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO };
+    timelineSubmit.waitSemaphoreValueCount = 1;
+    timelineSubmit.pWaitSemaphoreValues = &waitValue;
+    timelineSubmit.signalSemaphoreValueCount = 2;
+    timelineSubmit.pSignalSemaphoreValues = signalValues;
+    VkSubmitInfo submit = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit.pNext = &timelineSubmit;
+    submit.waitSemaphoreCount = 1;
+    submit.pWaitSemaphores = &vk->acquired[vk->slot];
+    submit.pWaitDstStageMask = &waitStage;
+    submit.commandBufferCount = bufferCount;
+    submit.pCommandBuffers = buffers;
+    submit.signalSemaphoreCount = 2;
+    submit.pSignalSemaphores = signals;
+    if (vkQueueSubmit(vk->queue, 1, &submit, VK_NULL_HANDLE) == VK_SUCCESS) vk->skip = 0;
+}
+
+void vkPresent(void* data, GLFWwindow* window) {
+    VKDATA* vk = (VKDATA*)data;
+    if (vk->skip) return;
+    VkPresentInfoKHR present = { VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
+    present.waitSemaphoreCount = 1;
+    present.pWaitSemaphores = &vk->rendered[vk->imageIndex];
+    present.swapchainCount = 1;
+    present.pSwapchains = &vk->swapchain;
+    present.pImageIndices = &vk->imageIndex;
+    VkResult result = vkQueuePresentKHR(vk->queue, &present);
+    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
+        vkDeviceWaitIdle(vk->device);
+        vkSwapchain(vk);
+    }
+}
+
+void vkDestroyImage2D(VKDATA* vk, VKIMAGE* img) {
+    vkDestroyImageView(vk->device, img->view, NULL);
+    vkDestroyImage(vk->device, img->image, NULL);
+    vkFreeMemory(vk->device, img->memory, NULL);
+    *img = {};
+}
+
+/*Stops the workers and destroys what vkInit made, newest first. Safe on a
+* half-finished vkInit: handles it never got to are still null, and Vulkan
+* ignores those, so this is also the cleanup for a failed init.
+*/
+void vkShutdown(VKDATA* vk) {
+    if (vk->running) {
+        vk->running = 0;
+        for (int j = 0; j < VK_WORKERS; j++) SetEvent(vk->jobs[j].start);
+        for (int j = 0; j < VK_WORKERS; j++) {
+            WaitForSingleObject(vk->jobs[j].thread, INFINITE);
+            CloseHandle(vk->jobs[j].thread);
+            CloseHandle(vk->jobs[j].start);
+            CloseHandle(vk->jobs[j].done);
+        }
+    }
+    if (vk->device != VK_NULL_HANDLE) {
+        vkDeviceWaitIdle(vk->device);
+        VkPipeline pipelines[6] = { vk->light, vk->bloom, vk->assembly, vk->flat, vk->dots, vk->text };
+        for (int i = 0; i < 6; i++) vkDestroyPipeline(vk->device, pipelines[i], NULL);
+        for (int f = 0; f < VK_FRAMES; f++) {
+            vkDestroyBuffer(vk->device, vk->uniforms[f], NULL);
+            vkDestroyBuffer(vk->device, vk->textVertices[f], NULL);
+        }
+        vkFreeMemory(vk->device, vk->hostMemory, NULL);
+        vkDestroyBuffer(vk->device, vk->quads, NULL);
+        vkFreeMemory(vk->device, vk->quadMemory, NULL);
+        //The pool takes every descriptor set with it
+        vkDestroyDescriptorPool(vk->device, vk->pool, NULL);
+        vkDestroyPipelineLayout(vk->device, vk->layout, NULL);
+        vkDestroyDescriptorSetLayout(vk->device, vk->textureLayout, NULL);
+        vkDestroyDescriptorSetLayout(vk->device, vk->frameLayout, NULL);
+        vkDestroySampler(vk->device, vk->repeatSampler, NULL);
+        vkDestroySampler(vk->device, vk->clampSampler, NULL);
+        for (unsigned int i = 0; i < vk->slideCount; i++) vkDestroyImage2D(vk, &vk->slides[i]);
+        vkDestroyImage2D(vk, &vk->atlas);
+        vkDestroyImage2D(vk, &vk->dotMatrix);
+        vkDestroyImage2D(vk, &vk->overlay);
+        for (int i = 0; i < themeCount; i++) for (int k = 0; k < THEME_MAPS; k++) vkDestroyImage2D(vk, &vk->themeMaps[i][k]);
+        for (int k = 0; k < THEME_MAPS; k++) vkDestroyImage2D(vk, &vk->flatMaps[k]);
+        vkDestroyFramebuffer(vk->device, vk->pongFB, NULL);
+        vkDestroyFramebuffer(vk->device, vk->pingFB, NULL);
+        vkDestroyFramebuffer(vk->device, vk->litFB, NULL);
+        //[pong] is bound to [bright]'s memory and owns none of its own
+        vkDestroyImage2D(vk, &vk->pong);
+        vkDestroyImage2D(vk, &vk->bright);
+        vkDestroyImage2D(vk, &vk->ping);
+        vkDestroyImage2D(vk, &vk->lit);
+        for (uint32_t i = 0; i < vk->imageCount; i++) {
+            vkDestroyFramebuffer(vk->device, vk->swapFramebuffers[i], NULL);
+            vkDestroyImageView(vk->device, vk->swapViews[i], NULL);
+        }
+        vkDestroyRenderPass(vk->device, vk->presentPass, NULL);
+        vkDestroyRenderPass(vk->device, vk->blurPass, NULL);
+        vkDestroyRenderPass(vk->device, vk->hdrPass, NULL);
+        vkDestroySwapchainKHR(vk->device, vk->swapchain, NULL);
+        for (int i = 0; i < 8; i++) vkDestroySemaphore(vk->device, vk->rendered[i], NULL);
+        vkDestroySemaphore(vk->device, vk->timeline, NULL);
+        for (int f = 0; f < VK_FRAMES; f++) {
+            vkDestroySemaphore(vk->device, vk->acquired[f], NULL);
+            for (int j = 0; j < VK_WORKERS; j++) vkDestroyCommandPool(vk->device, vk->pools[f][j], NULL);
+        }
+        vkDestroyCommandPool(vk->device, vk->uploadPool, NULL);
+        vkDestroyDevice(vk->device, NULL);
+    }
+    if (vk->surface != VK_NULL_HANDLE) vkDestroySurfaceKHR(vk->instance, vk->surface, NULL);
+    if (vk->instance != VK_NULL_HANDLE) vkDestroyInstance(vk->instance, NULL);
+    volatile int* themeRequest = vk->themeRequest;
+    *vk = {};
+    vk->themeRequest = themeRequest;
+}
+
+/*Shared-memory frame output for local capture (OBS plugins, the stream PC's
+* encoder). The finished frame is read into a ring of fenced pixel pack
+* buffers; once a fence has passed, a publisher thread copies the buffer into
+* the next slot of a named file mapping, so the render thread never waits on
+* the readback. Consumers map SHM_NAME read-only and use the slot in place;
+* stages after the first publish under SHM_NAME with their index appended.
+*
+* Layout: SHMHEADER, then SHM_SLOTS frames of slotBytes each at dataOffset.
+* Each slot is a seqlock: slot.seq is 0 while it is being written and the
+* frame's sequence number once complete, and header.writeSeq is the newest
+* complete frame. A reader takes writeSeq, uses slot writeSeq % SHM_SLOTS and
+* checks slot.seq is unchanged afterwards.
+*/
+typedef struct shmSlot {
+    volatile LONG64 seq;
+    LONG64 timestamp; //QueryPerformanceCounter at readback, in microseconds
+    unsigned int width;
+    unsigned int height;
+    unsigned int format;
+    unsigned int pad;
+} SHMSLOT;
+
+typedef struct shmHeader {
+    char magic[4];
+    unsigned int version;
+    unsigned int slots;
+    unsigned int slotBytes;
+    unsigned int dataOffset;
+    unsigned int pad;
+    volatile LONG64 writeSeq;
+    SHMSLOT slot[SHM_SLOTS];
+} SHMHEADER;
+
+typedef struct shmReadback {
+    unsigned int pbo;
+    unsigned char* mapped;
+    GLsync fence;
+    volatile LONG state;
+    LONG64 seq;
+    LONG64 timestamp;
+} SHMREADBACK;
+
+typedef struct shmData {
+    HANDLE mapping;
+    SHMHEADER* header;
+    unsigned char* frames;
+    int width;
+    int height;
+    size_t frameBytes;
+    int persistent;
+    LONG64 seq;
+    SHMREADBACK readback[SHM_PBOS];
+    HANDLE signal;
+    HANDLE thread;
+    volatile LONG running;
+} SHMDATA;
+
+void shmRingName(char* name, int stage) {
+    if (stage == 0) sprintf_s(name, 64, "%s", SHM_NAME);
+    else sprintf_s(name, 64, "%s%d", SHM_NAME, stage);
+}
+
+LONG64 shmNow() {
+    LARGE_INTEGER now, freq;
+    QueryPerformanceCounter(&now);
+    QueryPerformanceFrequency(&freq);
+    return now.QuadPart / freq.QuadPart * 1000000 + now.QuadPart % freq.QuadPart * 1000000 / freq.QuadPart;
+}
+
+void shmPublish(SHMDATA* shm, SHMREADBACK* rb, unsigned char* pixels) {
+    int index = (int)(rb->seq % SHM_SLOTS);
+    SHMSLOT* slot = &shm->header->slot[index];
+    InterlockedExchange64(&slot->seq, 0);
+    memcpy(shm->frames + (size_t)index * shm->header->slotBytes, pixels, shm->frameBytes);
+    slot->timestamp = rb->timestamp;
+    slot->width = shm->width;
+    slot->height = shm->height;
+    slot->format = SHM_BGRA8 | SHM_BOTTOM_UP;
+    InterlockedExchange64(&slot->seq, rb->seq);
+    InterlockedExchange64(&shm->header->writeSeq, rb->seq);
+    InterlockedIncrement(&metrics.shmFrames);
+}
+
+//Only used with persistent mapping; otherwise the render thread publishes when it unmaps
+DWORD WINAPI ShmPublisher(LPVOID lpParam) {
+    SHMDATA* shm = (SHMDATA*)lpParam;
+    while (shm->running) {
+        SHMREADBACK* next = NULL;
+        for (int i = 0; i < SHM_PBOS; i++) {
+            if (shm->readback[i].state == S_READY && (next == NULL || shm->readback[i].seq < next->seq)) next = &shm->readback[i];
+        }
+        if (next == NULL) {
+            WaitForSingleObject(shm->signal, 10);
+            continue;
+        }
+        shmPublish(shm, next, next->mapped);
+        InterlockedExchange(&next->state, S_FREE);
+    }
+    return 0;
+}
+
+int openShm(SHMDATA* shm, int width, int height, const char* name) {
+    shm->width = width;
+    shm->height = height;
+    shm->frameBytes = (size_t)width * height * 4;
+    unsigned int slotBytes = (unsigned int)((shm->frameBytes + 4095) & ~(size_t)4095);
+    unsigned int dataOffset = (unsigned int)((sizeof(SHMHEADER) + 4095) & ~(size_t)4095);
+    ULONGLONG size = dataOffset + (ULONGLONG)slotBytes * SHM_SLOTS;
+    shm->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)(size >> 32), (DWORD)size, name);
+    if (shm->mapping == NULL) {
+        errorCallback(-1, "Unable to create the shared frame ring!");
+        return -1;
+    }
+    shm->header = (SHMHEADER*)MapViewOfFile(shm->mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (shm->header == NULL) {
+        CloseHandle(shm->mapping);
+        return -1;
+    }
+    memset(shm->header, 0, sizeof(SHMHEADER));
+    shm->header->version = SHM_VERSION;
+    shm->header->slots = SHM_SLOTS;
+    shm->header->slotBytes = slotBytes;
+    shm->header->dataOffset = dataOffset;
+    MemoryBarrier();
+    memcpy(shm->header->magic, "NNBR", 4);
+    shm->frames = (unsigned char*)shm->header + dataOffset;
+
+    shm->persistent = GLAD_GL_VERSION_4_4;
+    for (int i = 0; i < SHM_PBOS; i++) {
+        gpuCreate(GPU_BUFFER, 1, &shm->readback[i].pbo, "shm");
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, shm->readback[i].pbo);
+        gpuStorage(GPU_BUFFER, shm->readback[i].pbo, 0, shm->frameBytes);
+        if (shm->persistent) {
+            GLbitfield access = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_PIXEL_PACK_BUFFER, shm->frameBytes, NULL, access);
+            shm->readback[i].mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, shm->frameBytes, access);
+        }else glBufferData(GL_PIXEL_PACK_BUFFER, shm->frameBytes, NULL, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    if (shm->persistent) {
+        shm->signal = CreateEventA(NULL, FALSE, FALSE, NULL);
+        shm->running = 1;
+        DWORD publisherID;
+        shm->thread = CreateThread(NULL, 0, ShmPublisher, shm, 0, &publisherID);
+    }
+    std::cout << "Publishing frames to " << name << " (" << SHM_SLOTS << " slots)" << std::endl;
+    return 0;
+}
+
+//Called by the render thread after the frame is drawn and before it is presented
+void shmFrame(SHMDATA* shm, unsigned int framebuffer) {
+    for (int i = 0; i < SHM_PBOS; i++) {
+        SHMREADBACK* rb = &shm->readback[i];
+        if (rb->state != S_UPLOADING) continue;
+        if (glClientWaitSync(rb->fence, 0, 0) == GL_TIMEOUT_EXPIRED) continue;
+        glDeleteSync(rb->fence);
+        if (shm->persistent) {
+            InterlockedExchange(&rb->state, S_READY);
+            SetEvent(shm->signal);
+            continue;
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+        unsigned char* mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, shm->frameBytes, GL_MAP_READ_BIT);
+        if (mapped != NULL) {
+            shmPublish(shm, rb, mapped);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        rb->state = S_FREE;
+    }
+
+    SHMREADBACK* rb = NULL;
+    for (int i = 0; i < SHM_PBOS && rb == NULL; i++) if (shm->readback[i].state == S_FREE) rb = &shm->readback[i];
+    if (rb == NULL) {
+        //Every buffer is still in flight; skip this frame rather than stall the show
+        InterlockedIncrement(&metrics.shmDropped);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        return;
+    }
+    rb->seq = ++shm->seq;
+    rb->timestamp = shmNow();
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+    glReadPixels(0, 0, shm->width, shm->height, GL_BGRA, GL_UNSIGNED_BYTE, 0);
+    rb->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    rb->state = S_UPLOADING;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void closeShm(SHMDATA* shm) {
+    shm->running = 0;
+    if (shm->thread != NULL) {
+        WaitForSingleObject(shm->thread, INFINITE);
+        CloseHandle(shm->thread);
+        CloseHandle(shm->signal);
+        shm->thread = NULL;
+    }
+    for (int i = 0; i < SHM_PBOS; i++) {
+        if (shm->readback[i].state == S_UPLOADING) glDeleteSync(shm->readback[i].fence);
+        gpuDelete(GPU_BUFFER, 1, &shm->readback[i].pbo);
+    }
+    if (shm->header != NULL) UnmapViewOfFile(shm->header);
+    if (shm->mapping != NULL) CloseHandle(shm->mapping);
+    shm->header = NULL;
+    shm->mapping = NULL;
+}
+
+/*Test consumer, run as a second process with -consume [seconds] [stage]. Maps the
+* ring read-only, follows writeSeq and reports latency from readback to
+* pickup, frames dropped between pickups and torn reads once a second.
+*/
+int consumeShm(int seconds, int stage) {
+    char name[64];
+    shmRingName(name, stage);
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if (mapping == NULL) {
+        std::cout << "No frame ring at " << name << ", is the banner running with -shm?" << std::endl;
+        return -1;
+    }
+    SHMHEADER* header = (SHMHEADER*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (header == NULL || memcmp(header->magic, "NNBR", 4) != 0 || header->version != SHM_VERSION) {
+        std::cout << "Frame ring is not a version " << SHM_VERSION << " NNBR ring." << std::endl;
+        return -1;
+    }
+    unsigned char* frames = (unsigned char*)header + header->dataOffset;
+    LONG64 last = header->writeSeq;
+    LONG64 started = shmNow(), reported = started;
+    long received = 0, dropped = 0, torn = 0;
+    double latencySum = 0.0, latencyMax = 0.0;
+    unsigned int checksum = 0;
+    while (seconds <= 0 || shmNow() - started < (LONG64)seconds * 1000000) {
+        LONG64 seq = header->writeSeq;
+        if (seq == last) {
+            Sleep(1);
+            continue;
+        }
+        SHMSLOT* slot = &header->slot[seq % header->slots];
+        LONG64 timestamp = slot->timestamp;
+        //Touch the frame in place the way a capture consumer would, one byte per row
+        unsigned char* pixels = frames + (size_t)(seq % header->slots) * header->slotBytes;
+        for (unsigned int y = 0; y < slot->height; y++) checksum += pixels[(size_t)y * slot->width * 4];
+        if (slot->seq != seq) {
+            torn++;
+            continue;
+        }
+        double latency = (shmNow() - timestamp) / 1000.0;
+        latencySum += latency;
+        if (latency > latencyMax) latencyMax = latency;
+        if (last != 0 && seq > last + 1) dropped += (long)(seq - last - 1);
+        last = seq;
+        received++;
+        if (shmNow() - reported >= 1000000) {
+            reported = shmNow();
+            std::cout << "frames " << received << " dropped " << dropped << " torn " << torn
+                << " latency avg " << latencySum / received << "ms max " << latencyMax << "ms" << std::endl;
+        }
+    }
+    std::cout << "Done: " << received << " frames, " << dropped << " dropped, " << torn << " torn, avg latency "
+        << (received > 0 ? latencySum / received : 0.0) << "ms (" << checksum << ")" << std::endl;
+    UnmapViewOfFile(header);
+    CloseHandle(mapping);
+    return 0;
+}
+
+/*UDP output shared by the LED, DMX and sync senders. Senders connect their
+* socket so each send skips the route lookup, queue a frame's packets in a
+* UDPBATCH and hand over the lot at once. Winsock has no sendmmsg, so the
+* batch goes out back to back from the sender's own thread. A PACER wakes
+* that thread on a high resolution waitable timer and spins the last stretch,
+* keeping the packet rate steady whatever the render thread is doing.
+*/
+typedef struct udpBatch {
+    int count;
+    int length[UDP_BATCH];
+    unsigned char packets[UDP_BATCH][UDP_PACKET];
+} UDPBATCH;
+
+typedef struct pacer {
+    HANDLE timer;
+    int coarse;
+    LONG64 period;
+    LONG64 due;
+} PACER;
+
+int netReady = 0;
+
+int netStartup() {
+    if (netReady) return 0;
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) {
+        errorCallback(-1, "Unable to start Winsock!");
+        return -1;
+    }
+    netReady = 1;
+    return 0;
+}
+
+SOCKET udpSender(const char* host, int port) {
+    if (netStartup()) return INVALID_SOCKET;
+    char service[8];
+    sprintf_s(service, "%d", port);
+    addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_protocol = IPPROTO_UDP;
+    addrinfo* address = NULL;
+    if (getaddrinfo(host, service, &hints, &address) != 0 || address == NULL) {
+        errorCallback(-1, "Unable to resolve the UDP output host!");
+        return INVALID_SOCKET;
+    }
+    SOCKET s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s != INVALID_SOCKET && connect(s, address->ai_addr, (int)address->ai_addrlen) == SOCKET_ERROR) {
+        closesocket(s);
+        s = INVALID_SOCKET;
+    }
+    freeaddrinfo(address);
+    if (s == INVALID_SOCKET) {
+        errorCallback(-1, "Unable to open the UDP output socket!");
+        return INVALID_SOCKET;
+    }
+    //Room for a whole batch, so a frame never waits on the socket buffer
+    int buffer = UDP_BATCH * UDP_PACKET * 2;
+    setsockopt(s, SOL_SOCKET, SO_SNDBUF, (const char*)&buffer, sizeof(buffer));
+    BOOL broadcast = TRUE;
+    setsockopt(s, SOL_SOCKET, SO_BROADCAST, (const char*)&broadcast, sizeof(broadcast));
+    return s;
+}
+
+//Bound to every interface; receives time out after [timeoutMs] so the caller can check its clock
+SOCKET udpListener(int port, int timeoutMs) {
+    if (netStartup()) return INVALID_SOCKET;
+    SOCKET s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s == INVALID_SOCKET) return INVALID_SOCKET;
+    BOOL reuse = TRUE;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+    DWORD timeout = timeoutMs;
+    setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons((u_short)port);
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(s, (sockaddr*)&address, sizeof(address)) == SOCKET_ERROR) {
+        errorCallback(-1, "Unable to bind the UDP port!");
+        closesocket(s);
+        return INVALID_SOCKET;
+    }
+    return s;
+}
+
+//Returns how many packets went out; the batch is emptied either way
+int udpSend(SOCKET s, UDPBATCH* batch) {
+    int sent = 0;
+    for (int i = 0; i < batch->count; i++) if (send(s, (const char*)batch->packets[i], batch->length[i], 0) == batch->length[i]) sent++;
+    batch->count = 0;
+    return sent;
+}
+
+void startPacer(PACER* pacer, int rate) {
+    pacer->timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    //Without a high resolution timer Sleep falls back to the 15.6ms system tick unless it is raised
+    pacer->coarse = pacer->timer == NULL && timeBeginPeriod(1) == TIMERR_NOERROR;
+    pacer->period = 1000000 / (rate > 0 ? rate : 1);
+    pacer->due = shmNow();
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+}
+
+//Waits for the next tick; returns how many were missed. A sender that falls
+//more than a tick behind starts again from now rather than bursting to catch up.
+int pace(PACER* pacer) {
+    pacer->due += pacer->period;
+    LONG64 now = shmNow();
+    int missed = 0;
+    if (now > pacer->due) {
+        missed = (int)((now - pacer->due) / pacer->period);
+        if (missed > 0) pacer->due = now;
+        return missed;
+    }
+    if (pacer->due - now > PACER_SPIN) {
+        if (pacer->timer != NULL) {
+            LARGE_INTEGER relative;
+            relative.QuadPart = -(pacer->due - now - PACER_SPIN) * 10;
+            SetWaitableTimer(pacer->timer, &relative, 0, NULL, NULL, FALSE);
+            WaitForSingleObject(pacer->timer, INFINITE);
+        }else Sleep((DWORD)((pacer->due - now - PACER_SPIN) / 1000));
+    }
+    while (shmNow() < pacer->due) YieldProcessor();
+    return 0;
+}
+
+void closePacer(PACER* pacer) {
+    if (pacer->timer != NULL) CloseHandle(pacer->timer);
+    if (pacer->coarse) timeEndPeriod(1);
+    pacer->timer = NULL;
+    pacer->coarse = 0;
+}
+
+/*LED pixel mapping, with -led [map]. The first stage's finished frame is
+* blitted into a small mipmapped copy, and one draw samples it at every LED
+* in the map, at the mip level matching the LED's footprint, into a target
+* LED_ROW texels wide. That target is read back through fenced pixel pack
+* buffers like the shared frame ring, and the render thread only copies a
+* finished one over to the sender through [exchange]. LedSender wakes at the
+* map's rate and sends the newest frame as DDP (port 4048, what WLED, FPP
+* and most pixel controllers take), repeating the last one when the show has
+* not produced a new one in time.
+*
+* The map is a JSON array of flat objects, with coordinates from 0 to 1 from
+* the top left of the banner:
+*   {"host":"10.0.0.50", "port":4048, "rate":60, "size":0.01}   output and default footprint
+*   {"x0":0, "y0":0, "x1":1, "y1":0, "count":300}               a strip of evenly spaced LEDs
+*   ... "rows":8, "serpentine":1                                 a grid, optionally zig-zag wired
+*   {"x":0.5, "y":0.5, "size":0.1}                               a single LED
+* LEDs are numbered in the order they appear.
+*/
+typedef struct ledReadback {
+    unsigned int pbo;
+    GLsync fence;
+    int state;
+    LONG64 timestamp;
+} LEDREADBACK;
+
+typedef struct ledData {
+    int count;
+    int rows;
+    float* map;
+    char host[64];
+    int port;
+    int rate;
+    float size;
+    int sourceW;
+    int sourceH;
+    unsigned int source;
+    unsigned int sourceFBO;
+    unsigned int leds;
+    unsigned int target;
+    unsigned int targetFBO;
+    unsigned int VAO;
+    unsigned int program;
+    GLint uFrame, uLeds;
+    LONG generation;
+    size_t frameBytes;
+    LEDREADBACK readback[LED_PBOS];
+    unsigned char* frames[LED_SLOTS];
+    LONG64 stamps[LED_SLOTS];
+    int back;
+    volatile LONG exchange;
+    SOCKET socket;
+    UDPBATCH* batch;
+    HANDLE thread;
+    volatile LONG running;
+} LEDDATA;
+
+void ledAdd(LEDDATA* led, float x, float y, float size) {
+    if (led->count >= LED_MAX) return;
+    float* entry = led->map + (size_t)led->count * 3;
+    entry[0] = x;
+    entry[1] = y;
+    entry[2] = size;
+    led->count++;
+}
+
+int loadLedMap(LEDDATA* led, const char* path) {
+    std::streamsize size;
+    char* json = readFile(path, &size);
+    if (json == NULL) {
+        errorCallback(-1, "Unable to read the LED map!");
+        return -1;
+    }
+    led->map = (float*)HeapAlloc(GetProcessHeap(), 0, sizeof(float) * 3 * LED_MAX);
+    if (led->map == NULL) return -1;
+    sprintf_s(led->host, "127.0.0.1");
+    led->port = LED_PORT;
+    led->rate = LED_RATE;
+    led->size = LED_SIZE;
+    const char* end = json + size - 1;
+    const char* object;
+    char value[64];
+    for (const char* close = jsonObject(json, end, &object); close != NULL; close = jsonObject(close + 1, end, &object)) {
+        if (jsonField(object, close, "host", led->host, sizeof(led->host))) {
+            if (jsonField(object, close, "port", value, sizeof(value))) led->port = atoi(value);
+            if (jsonField(object, close, "rate", value, sizeof(value)) && atoi(value) > 0) led->rate = atoi(value);
+            if (jsonField(object, close, "size", value, sizeof(value))) led->size = (float)atof(value);
+            continue;
+        }
+        float footprint = jsonField(object, close, "size", value, sizeof(value)) ? (float)atof(value) : led->size;
+        if (jsonField(object, close, "count", value, sizeof(value))) {
+            int count = atoi(value);
+            float p[4] = {};
+            const char* keys[4] = { "x0", "y0", "x1", "y1" };
+            for (int k = 0; k < 4; k++) if (jsonField(object, close, keys[k], value, sizeof(value))) p[k] = (float)atof(value);
+            int rows = jsonField(object, close, "rows", value, sizeof(value)) && atoi(value) > 1 ? atoi(value) : 1;
+            int serpentine = jsonField(object, close, "serpentine", value, sizeof(value)) && atoi(value);
+            for (int r = 0; r < rows; r++) {
+                float y = rows > 1 ? p[1] + (p[3] - p[1]) * r / (rows - 1) : 0.0f;
+                for (int i = 0; i < count; i++) {
+                    int column = serpentine && (r & 1) ? count - 1 - i : i;
+                    float t = count > 1 ? (float)column / (count - 1) : 0.0f;
+                    //A single row runs from one end to the other; a grid steps down between them
+                    if (rows > 1) ledAdd(led, p[0] + (p[2] - p[0]) * t, y, footprint);
+                    else ledAdd(led, p[0] + (p[2] - p[0]) * t, p[1] + (p[3] - p[1]) * t, footprint);
+                }
+            }
+            continue;
+        }
+        float x, y;
+        if (!jsonField(object, close, "x", value, sizeof(value))) continue;
+        x = (float)atof(value);
+        if (!jsonField(object, close, "y", value, sizeof(value))) continue;
+        y = (float)atof(value);
+        ledAdd(led, x, y, footprint);
+    }
+    HeapFree(GetProcessHeap(), 0, json);
+    if (led->count == 0) {
+        errorCallback(-1, "The LED map has no LEDs!");
+        return -1;
+    }
+    if (led->count == LED_MAX) errorCallback(-1, "The LED map is over LED_MAX; the rest are left out.");
+    return 0;
+}
+
+DWORD WINAPI LedSender(LPVOID lpParam) {
+    LEDDATA* led = (LEDDATA*)lpParam;
+    PACER pacer;
+    startPacer(&pacer, led->rate);
+    int front = 2, ready = 0;
+    unsigned char sequence = 0;
+    while (led->running) {
+        int missed = pace(&pacer);
+        if (missed > 0) InterlockedExchangeAdd(&metrics.ledLate, missed);
+        if (led->exchange & LED_FRESH) {
+            front = InterlockedExchange(&led->exchange, front) & ~LED_FRESH;
+            ready = 1;
+            metrics.ledLatencyMs = (shmNow() - led->stamps[front]) / 1000.0f;
+        }
+        if (!ready) continue;
+
+        //DDP: 10 byte header, RGB data at a byte offset, push set on the last packet of the frame
+        const unsigned char* pixels = led->frames[front];
+        UDPBATCH* batch = led->batch;
+        for (int first = 0; first < led->count && batch->count < UDP_BATCH; first += LED_PER_PACKET) {
+            int n = led->count - first < LED_PER_PACKET ? led->count - first : LED_PER_PACKET;
+            unsigned char* packet = batch->packets[batch->count];
+            unsigned int offset = first * 3, length = n * 3;
+            sequence = sequence % 15 + 1;
+            packet[0] = 0x40 | (first + n >= led->count ? 0x01 : 0x00);
+            packet[1] = sequence;
+            packet[2] = 0x0B; //RGB, 8 bits per channel
+            packet[3] = 1;
+            packet[4] = (unsigned char)(offset >> 24);
+            packet[5] = (unsigned char)(offset >> 16);
+            packet[6] = (unsigned char)(offset >> 8);
+            packet[7] = (unsigned char)offset;
+            packet[8] = (unsigned char)(length >> 8);
+            packet[9] = (unsigned char)length;
+            for (int i = 0; i < n; i++) memcpy(packet + 10 + i * 3, pixels + (size_t)(first + i) * 4, 3);
+            batch->length[batch->count++] = 10 + length;
+        }
+        int packets = batch->count;
+        int sent = udpSend(led->socket, batch);
+        InterlockedExchangeAdd(&metrics.ledPackets, sent);
+        if (sent < packets) InterlockedExchangeAdd(&metrics.ledDropped, packets - sent);
+        InterlockedIncrement(&metrics.ledFrames);
+    }
+    closePacer(&pacer);
+    return 0;
+}
+
+int openLed(LEDDATA* led, const char* path, int width, int height) {
+    if (loadLedMap(led, path)) return -1;
+    led->socket = udpSender(led->host, led->port);
+    if (led->socket == INVALID_SOCKET) return -1;
+    led->rows = (led->count + LED_ROW - 1) / LED_ROW;
+    led->sourceW = width / LED_SCALE > 0 ? width / LED_SCALE : 1;
+    led->sourceH = height / LED_SCALE > 0 ? height / LED_SCALE : 1;
+
+    //Where each LED samples: texture space is bottom up, the map top down
+    float* texels = (float*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(float) * 4 * LED_ROW * led->rows);
+    if (texels == NULL) return -1;
+    for (int i = 0; i < led->count; i++) {
+        float* entry = led->map + (size_t)i * 3;
+        float footprint = entry[2] * led->sourceW;
+        texels[i * 4] = entry[0];
+        texels[i * 4 + 1] = 1.0f - entry[1];
+        texels[i * 4 + 2] = footprint > 1.0f ? log2f(footprint) : 0.0f;
+    }
+    gpuCreate(GPU_TEXTURE, 1, &led->leds, "led");
+    glBindTexture(GL_TEXTURE_2D, led->leds);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, LED_ROW, led->rows, 0, GL_RGBA, GL_FLOAT, texels);
+    gpuStorage(GPU_TEXTURE, led->leds, GL_RGBA32F, gpuTextureBytes(GL_RGBA32F, LED_ROW, led->rows, 0));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    HeapFree(GetProcessHeap(), 0, texels);
+
+    gpuCreate(GPU_TEXTURE, 1, &led->source, "led");
+    glBindTexture(GL_TEXTURE_2D, led->source);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, led->sourceW, led->sourceH, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    gpuStorage(GPU_TEXTURE, led->source, GL_RGBA8, gpuTextureBytes(GL_RGBA8, led->sourceW, led->sourceH, 1));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    gpuCreate(GPU_TEXTURE, 1, &led->target, "led");
+    glBindTexture(GL_TEXTURE_2D, led->target);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, LED_ROW, led->rows, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    gpuStorage(GPU_TEXTURE, led->target, GL_RGBA8, gpuTextureBytes(GL_RGBA8, LED_ROW, led->rows, 0));
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    gpuCreate(GPU_FRAMEBUFFER, 1, &led->sourceFBO, "led");
+    glBindFramebuffer(GL_FRAMEBUFFER, led->sourceFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, led->source, 0);
+    gpuCreate(GPU_FRAMEBUFFER, 1, &led->targetFBO, "led");
+    glBindFramebuffer(GL_FRAMEBUFFER, led->targetFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, led->target, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    gpuCreate(GPU_VERTEXARRAY, 1, &led->VAO, "led");
+    led->program = acquireProgram("shader/led.vs", "shader/led.fs");
+    led->generation = gpuGeneration;
+    led->uFrame = glGetUniformLocation(led->program, "frame");
+    led->uLeds = glGetUniformLocation(led->program, "leds");
+
+    led->frameBytes = (size_t)LED_ROW * led->rows * 4;
+    for (int i = 0; i < LED_PBOS; i++) {
+        gpuCreate(GPU_BUFFER, 1, &led->readback[i].pbo, "led");
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, led->readback[i].pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, led->frameBytes, NULL, GL_STREAM_READ);
+        gpuStorage(GPU_BUFFER, led->readback[i].pbo, 0, led->frameBytes);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    for (int i = 0; i < LED_SLOTS; i++) {
+        led->frames[i] = (unsigned char*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, led->frameBytes);
+        if (led->frames[i] == NULL) return -1;
+    }
+    led->batch = (UDPBATCH*)HeapAlloc(GetProcessHeap(), 0, sizeof(UDPBATCH));
+    if (led->batch == NULL) return -1;
+    led->batch->count = 0;
+    led->back = 0;
+    led->exchange = 1;
+    led->running = 1;
+    DWORD senderID;
+    led->thread = CreateThread(NULL, 0, LedSender, led, 0, &senderID);
+    std::cout << "LED output: " << led->count << " LEDs to " << led->host << ":" << led->port << " at " << led->rate << " Hz" << std::endl;
+    return 0;
+}
+
+//Called by the render thread after the frame is drawn and before it is presented
+void ledFrame(LEDDATA* led, unsigned int framebuffer, int width, int height) {
+    for (int i = 0; i < LED_PBOS; i++) {
+        LEDREADBACK* rb = &led->readback[i];
+        if (rb->state != S_UPLOADING) continue;
+        if (glClientWaitSync(rb->fence, 0, 0) == GL_TIMEOUT_EXPIRED) continue;
+        glDeleteSync(rb->fence);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+        unsigned char* mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, led->frameBytes, GL_MAP_READ_BIT);
+        if (mapped != NULL) {
+            memcpy(led->frames[led->back], mapped, led->frameBytes);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            led->stamps[led->back] = rb->timestamp;
+            led->back = InterlockedExchange(&led->exchange, led->back | LED_FRESH) & ~LED_FRESH;
+        }
+        rb->state = S_FREE;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    LEDREADBACK* rb = NULL;
+    for (int i = 0; i < LED_PBOS && rb == NULL; i++) if (led->readback[i].state == S_FREE) rb = &led->readback[i];
+    if (rb == NULL) return;
+
+    //The passes after this one expect their own bindings back
+    GLint program, vertexArray, activeTexture, bound[2];
+    glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vertexArray);
+    glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+    for (int i = 0; i < 2; i++) {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &bound[i]);
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, led->sourceFBO);
+    glBlitFramebuffer(0, 0, width, height, 0, 0, led->sourceW, led->sourceH, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, led->source);
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, led->targetFBO);
+    glViewport(0, 0, LED_ROW, led->rows);
+    glUseProgram(led->program);
+    glUniform1i(led->uFrame, 0);
+    glUniform1i(led->uLeds, 1);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, led->leds);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, led->source);
+    glBindVertexArray(led->VAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    rb->timestamp = shmNow();
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbo);
+    glReadPixels(0, 0, LED_ROW, led->rows, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    rb->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    rb->state = S_UPLOADING;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, width, height);
+    for (int i = 0; i < 2; i++) {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, bound[i]);
+    }
+    glActiveTexture(activeTexture);
+    glBindVertexArray(vertexArray);
+    glUseProgram(program);
+}
+
+void closeLed(LEDDATA* led) {
+    led->running = 0;
+    if (led->thread != NULL) {
+        WaitForSingleObject(led->thread, INFINITE);
+        CloseHandle(led->thread);
+        led->thread = NULL;
+    }
+    if (led->socket != INVALID_SOCKET && led->socket != 0) closesocket(led->socket);
+    for (int i = 0; i < LED_PBOS; i++) {
+        if (led->readback[i].state == S_UPLOADING) glDeleteSync(led->readback[i].fence);
+        gpuDelete(GPU_BUFFER, 1, &led->readback[i].pbo);
+    }
+    gpuDelete(GPU_FRAMEBUFFER, 1, &led->sourceFBO);
+    gpuDelete(GPU_FRAMEBUFFER, 1, &led->targetFBO);
+    gpuDelete(GPU_VERTEXARRAY, 1, &led->VAO);
+    unsigned int textures[3] = { led->leds, led->source, led->target };
+    gpuDelete(GPU_TEXTURE, 3, textures);
+    if (led->program) releaseAsset(led->program, 1, led->generation);
+    for (int i = 0; i < LED_SLOTS; i++) if (led->frames[i] != NULL) HeapFree(GetProcessHeap(), 0, led->frames[i]);
+    if (led->batch != NULL) HeapFree(GetProcessHeap(), 0, led->batch);
+    if (led->map != NULL) HeapFree(GetProcessHeap(), 0, led->map);
+    *led = {};
+}
+
+/*Test receiver standing in for a pixel controller, run as a second process
+* with -ledrecv [seconds] [port]. Reassembles DDP frames and reports frames,
+* pixels, lost packets and the gap between frames once a second.
+*/
+int receiveLed(int seconds, int port) {
+    SOCKET s = udpListener(port > 0 ? port : LED_PORT, 100);
+    if (s == INVALID_SOCKET) return -1;
+    std::cout << "Listening for DDP on port " << (port > 0 ? port : LED_PORT) << std::endl;
+    unsigned char packet[UDP_PACKET];
+    LONG64 started = shmNow(), reported = started, lastFrame = 0;
+    long frames = 0, packets = 0, lost = 0, pixels = 0;
+    double gapMax = 0.0;
+    int expected = 0;
+    unsigned int frameBytes = 0;
+    while (seconds <= 0 || shmNow() - started < (LONG64)seconds * 1000000) {
+        int length = recv(s, (char*)packet, sizeof(packet), 0);
+        if (length >= 10 && (packet[0] & 0xC0) == 0x40) {
+            packets++;
+            int sequence = packet[1];
+            if (expected != 0 && sequence != 0 && sequence != expected) lost++;
+            expected = sequence != 0 ? sequence % 15 + 1 : 0;
+            unsigned int offset = (unsigned int)packet[4] << 24 | packet[5] << 16 | packet[6] << 8 | packet[7];
+            unsigned int data = (unsigned int)packet[8] << 8 | packet[9];
+            if (offset + data > frameBytes) frameBytes = offset + data;
+            if (packet[0] & 0x01) {
+                LONG64 now = shmNow();
+                if (lastFrame != 0 && (now - lastFrame) / 1000.0 > gapMax) gapMax = (now - lastFrame) / 1000.0;
+                lastFrame = now;
+                frames++;
+                pixels = frameBytes / 3;
+            }
+        }
+        if (shmNow() - reported >= 1000000) {
+            reported = shmNow();
+            std::cout << "frames " << frames << " packets " << packets << " lost " << lost << " pixels " << pixels
+                << " max gap " << gapMax << "ms" << std::endl;
+            gapMax = 0.0;
+        }
+    }
+    std::cout << "Done: " << frames << " frames, " << packets << " packets, " << lost << " lost" << std::endl;
+    closesocket(s);
+    return 0;
+}
+
+/*DMX output, with -dmx [patch]. The render thread publishes each frame's
+* light state (the colours the banner is showing and where its three lights
+* sit) through [exchange]; DmxSender wakes at DMX_RATE, renders every patched
+* universe from the newest state and follows them with a sync packet, so
+* every fixture changes on the same frame. Universes that share a socket go
+* out in one UDPBATCH with the sync at its end. Art-Net goes to port 6454
+* (broadcast unless a host is set); sACN goes to each universe's multicast
+* group on port 5568, or to the host. sACN universes are 1 to 63999, Art-Net
+* universes 0 to 32767; fixtures outside that are skipped.
+*
+* The patch is a JSON array of flat objects:
+*   {"protocol":"artnet", "host":"2.0.0.10", "rate":44}        output; protocol artnet or sacn
+*   {"profile":"par", "channels":"DRGBS"}                       a fixture profile
+*   {"fixture":"stage left", "profile":"par", "light":"red", "universe":0, "address":1}
+* A profile's channels are one letter each: R G B colour, W white (the
+* shared part of the colour), D dimmer (the colour channels are then scaled
+* up to full), P/T pan and tilt from the light's position with p/t their
+* fine bytes, S shutter open, F full and - or 0 off. A fixture follows the
+* red, green or blue light, or the mix of all three.
+*/
+typedef struct dmxLights {
+    float color[4][3];
+    float position[4][2];
+} DMXLIGHTS;
+
+typedef struct dmxProfile {
+    char name[32];
+    char channels[DMX_CHANNELS];
+} DMXPROFILE;
+
+typedef struct dmxFixture {
+    int profile;
+    int light;
+    int universe;
+    int address;
+} DMXFIXTURE;
+
+typedef struct dmxUniverse {
+    int number;
+    SOCKET socket;
+    unsigned char sequence;
+    unsigned char data[512];
+} DMXUNIVERSE;
+
+typedef struct dmxData {
+    int protocol;
+    char host[64];
+    int rate;
+    DMXPROFILE profiles[DMX_PROFILES];
+    int profileCount;
+    DMXFIXTURE fixtures[DMX_FIXTURES];
+    int fixtureCount;
+    DMXUNIVERSE universes[DMX_UNIVERSES];
+    int universeCount;
+    SOCKET sync;
+    unsigned char syncSequence;
+    unsigned char cid[16];
+    DMXLIGHTS lights[DMX_SLOTS];
+    int back;
+    volatile LONG exchange;
+    UDPBATCH* batch;
+    HANDLE thread;
+    volatile LONG running;
+} DMXDATA;
+
+const char* dmxLightNames[4] = { "red", "green", "blue", "mix" };
+
+int dmxUniverseIndex(DMXDATA* dmx, int number) {
+    for (int i = 0; i < dmx->universeCount; i++) if (dmx->universes[i].number == number) return i;
+    if (dmx->universeCount == DMX_UNIVERSES) return -1;
+    DMXUNIVERSE* universe = &dmx->universes[dmx->universeCount];
+    *universe = {};
+    universe->number = number;
+    universe->socket = INVALID_SOCKET;
+    return dmx->universeCount++;
+}
+
+int loadDmxPatch(DMXDATA* dmx, const char* path) {
+    std::streamsize size;
+    char* json = readFile(path, &size);
+    if (json == NULL) {
+        errorCallback(-1, "Unable to read the DMX patch!");
+        return -1;
+    }
+    dmx->protocol = DMX_ARTNET;
+    dmx->host[0] = '\0';
+    dmx->rate = DMX_RATE;
+    const char* end = json + size - 1;
+    const char* object;
+    char value[64];
+    //Profiles first, so fixtures can name one from anywhere in the file
+    for (const char* close = jsonObject(json, end, &object); close != NULL; close = jsonObject(close + 1, end, &object)) {
+        if (jsonField(object, close, "protocol", value, sizeof(value))) {
+            dmx->protocol = streq(value, "SACN", 0, 5) ? DMX_SACN : DMX_ARTNET;
+            jsonField(object, close, "host", dmx->host, sizeof(dmx->host));
+            if (jsonField(object, close, "rate", value, sizeof(value)) && atoi(value) > 0) dmx->rate = atoi(value);
+            continue;
+        }
+        if (jsonField(object, close, "fixture", value, sizeof(value)) || dmx->profileCount == DMX_PROFILES) continue;
+        DMXPROFILE* profile = &dmx->profiles[dmx->profileCount];
+        if (!jsonField(object, close, "profile", profile->name, sizeof(profile->name))) continue;
+        if (!jsonField(object, close, "channels", profile->channels, sizeof(profile->channels))) continue;
+        dmx->profileCount++;
+    }
+    for (const char* close = jsonObject(json, end, &object); close != NULL && dmx->fixtureCount < DMX_FIXTURES; close = jsonObject(close + 1, end, &object)) {
+        if (!jsonField(object, close, "fixture", value, sizeof(value))) continue;
+        DMXFIXTURE* fixture = &dmx->fixtures[dmx->fixtureCount];
+        fixture->profile = -1;
+        if (jsonField(object, close, "profile", value, sizeof(value))) {
+            for (int p = 0; p < dmx->profileCount; p++) if (streq(value, dmx->profiles[p].name, 0, 32)) fixture->profile = p;
+        }
+        fixture->light = 3;
+        if (jsonField(object, close, "light", value, sizeof(value))) {
+            for (int l = 0; l < 4; l++) if (streq(value, dmxLightNames[l], 0, 8)) fixture->light = l;
+        }
+        int number = jsonField(object, close, "universe", value, sizeof(value)) ? atoi(value) : 0;
+        fixture->address = jsonField(object, close, "address", value, sizeof(value)) ? atoi(value) : 1;
+        if (fixture->profile < 0 || fixture->address < 1) {
+            errorCallback(-1, "DMX fixture with an unknown profile or a bad address, skipped.");
+            continue;
+        }
+        if (dmx->protocol == DMX_SACN ? number < 1 || number > DMX_SYNC_UNIVERSE : number < 0 || number > 0x7FFF) {
+            errorCallback(-1, "DMX fixture on a universe the protocol cannot address, skipped.");
+            continue;
+        }
+        if (fixture->address + (int)strlen(dmx->profiles[fixture->profile].channels) - 1 > 512) {
+            errorCallback(-1, "DMX fixture runs past the end of its universe, skipped.");
+            continue;
+        }
+        fixture->universe = dmxUniverseIndex(dmx, number);
+        if (fixture->universe < 0) continue;
+        dmx->fixtureCount++;
+    }
+    HeapFree(GetProcessHeap(), 0, json);
+    if (dmx->fixtureCount == 0) {
+        errorCallback(-1, "The DMX patch has no fixtures!");
+        return -1;
+    }
+    return 0;
+}
+
+unsigned char dmxByte(float value) {
+    if (value <= 0.0f) return 0;
+    if (value >= 1.0f) return 255;
+    return (unsigned char)(value * 255.0f + 0.5f);
+}
+
+//Writes every fixture's channels into its universe from one light state
+void dmxRender(DMXDATA* dmx, DMXLIGHTS* lights) {
+    for (int f = 0; f < dmx->fixtureCount; f++) {
+        DMXFIXTURE* fixture = &dmx->fixtures[f];
+        const char* channels = dmx->profiles[fixture->profile].channels;
+        unsigned char* out = dmx->universes[fixture->universe].data + fixture->address - 1;
+        float* c = lights->color[fixture->light];
+        float* p = lights->position[fixture->light];
+        float rgb[3] = { c[0], c[1], c[2] };
+        float level = fmaxf(rgb[0], fmaxf(rgb[1], rgb[2]));
+        if (strchr(channels, 'D') != NULL && level > 0.0f) for (int i = 0; i < 3; i++) rgb[i] /= level;
+        float white = fminf(rgb[0], fminf(rgb[1], rgb[2]));
+        unsigned int pan = (unsigned int)(fminf(fmaxf(p[0], 0.0f), 1.0f) * 65535.0f);
+        unsigned int tilt = (unsigned int)(fminf(fmaxf(p[1], 0.0f), 1.0f) * 65535.0f);
+        for (int i = 0; channels[i] != '\0'; i++) {
+            switch (channels[i]) {
+            case 'R': out[i] = dmxByte(rgb[0]); break;
+            case 'G': out[i] = dmxByte(rgb[1]); break;
+            case 'B': out[i] = dmxByte(rgb[2]); break;
+            case 'W': out[i] = dmxByte(white); break;
+            case 'D': out[i] = dmxByte(level); break;
+            case 'P': out[i] = (unsigned char)(pan >> 8); break;
+            case 'p': out[i] = (unsigned char)pan; break;
+            case 'T': out[i] = (unsigned char)(tilt >> 8); break;
+            case 't': out[i] = (unsigned char)tilt; break;
+            case 'S': case 'F': out[i] = 255; break;
+            default: out[i] = 0; break;
+            }
+        }
+    }
+}
+
+int dmxArtnet(unsigned char* packet, DMXUNIVERSE* universe) {
+    memcpy(packet, "Art-Net", 8);
+    packet[8] = 0x00; //OpDmx, little endian
+    packet[9] = 0x50;
+    packet[10] = 0;
+    packet[11] = 14;
+    packet[12] = universe->sequence;
+    packet[13] = 0;
+    packet[14] = (unsigned char)(universe->number & 0xFF);
+    packet[15] = (unsigned char)((universe->number >> 8) & 0x7F);
+    packet[16] = 512 >> 8;
+    packet[17] = 512 & 0xFF;
+    memcpy(packet + 18, universe->data, 512);
+    return 18 + 512;
+}
+
+int dmxArtSync(unsigned char* packet) {
+    memcpy(packet, "Art-Net", 8);
+    packet[8] = 0x00; //OpSync
+    packet[9] = 0x52;
+    packet[10] = 0;
+    packet[11] = 14;
+    packet[12] = 0;
+    packet[13] = 0;
+    return 14;
+}
+
+//E1.31 root layer; [vector] is data (4) or extended (8), [length] the whole packet
+void dmxRoot(unsigned char* packet, DMXDATA* dmx, unsigned int vector, int length) {
+    static const unsigned char identifier[12] = { 0x41, 0x53, 0x43, 0x2d, 0x45, 0x31, 0x2e, 0x31, 0x37, 0x00, 0x00, 0x00 };
+    memset(packet, 0, length);
+    packet[1] = 0x10;
+    memcpy(packet + 4, identifier, 12);
+    packet[16] = (unsigned char)(0x70 | ((length - 16) >> 8));
+    packet[17] = (unsigned char)(length - 16);
+    packet[21] = (unsigned char)vector;
+    memcpy(packet + 22, dmx->cid, 16);
+    packet[38] = (unsigned char)(0x70 | ((length - 38) >> 8));
+    packet[39] = (unsigned char)(length - 38);
+}
+
+int dmxSacn(unsigned char* packet, DMXDATA* dmx, DMXUNIVERSE* universe) {
+    int length = 126 + 512;
+    dmxRoot(packet, dmx, 4, length);
+    packet[43] = 2; //Framing: data
+    sprintf_s((char*)packet + 44, 64, "Nashville Nights Banner");
+    packet[108] = 100;
+    packet[109] = DMX_SYNC_UNIVERSE >> 8;
+    packet[110] = DMX_SYNC_UNIVERSE & 0xFF;
+    packet[111] = universe->sequence;
+    packet[113] = (unsigned char)(universe->number >> 8);
+    packet[114] = (unsigned char)universe->number;
+    packet[115] = (unsigned char)(0x70 | ((length - 115) >> 8));
+    packet[116] = (unsigned char)(length - 115);
+    packet[117] = 2;
+    packet[118] = 0xa1;
+    packet[122] = 1;
+    packet[123] = 513 >> 8;
+    packet[124] = 513 & 0xFF;
+    memcpy(packet + 126, universe->data, 512);
+    return length;
+}
+
+int dmxSacnSync(unsigned char* packet, DMXDATA* dmx) {
+    int length = 49;
+    dmxRoot(packet, dmx, 8, length);
+    packet[43] = 1; //Framing: synchronization
+    packet[44] = dmx->syncSequence++;
+    packet[45] = DMX_SYNC_UNIVERSE >> 8;
+    packet[46] = DMX_SYNC_UNIVERSE & 0xFF;
+    return length;
+}
+
+SOCKET dmxSocket(DMXDATA* dmx, int universe) {
+    if (dmx->host[0] != '\0') return udpSender(dmx->host, dmx->protocol == DMX_SACN ? DMX_SACN_PORT : DMX_ARTNET_PORT);
+    if (dmx->protocol == DMX_ARTNET) return udpSender("255.255.255.255", DMX_ARTNET_PORT);
+    char group[32];
+    sprintf_s(group, "239.255.%d.%d", (universe >> 8) & 0xFF, universe & 0xFF);
+    return udpSender(group, DMX_SACN_PORT);
+}
+
+DWORD WINAPI DmxSender(LPVOID lpParam) {
+    DMXDATA* dmx = (DMXDATA*)lpParam;
+    PACER pacer;
+    startPacer(&pacer, dmx->rate);
+    int front = 2, ready = 0, ticks = 0;
+    float jitter = 0.0f;
+    while (dmx->running) {
+        int missed = pace(&pacer);
+        if (missed > 0) InterlockedExchangeAdd(&metrics.dmxLate, missed);
+        float late = (shmNow() - pacer.due) / 1000.0f;
+        if (late > jitter) jitter = late;
+        if (++ticks >= dmx->rate) {
+            metrics.dmxJitterMs = jitter;
+            jitter = 0.0f;
+            ticks = 0;
+        }
+        if (dmx->exchange & DMX_FRESH) {
+            front = InterlockedExchange(&dmx->exchange, front) & ~DMX_FRESH;
+            ready = 1;
+        }
+        if (!ready) continue;
+
+        dmxRender(dmx, &dmx->lights[front]);
+        //Every universe of the frame, then the sync that makes them take effect together;
+        //packets queue while the socket stays the same and go out as one batch
+        int sent = 0;
+        UDPBATCH* batch = dmx->batch;
+        SOCKET queued = INVALID_SOCKET;
+        for (int u = 0; u < dmx->universeCount; u++) {
+            DMXUNIVERSE* universe = &dmx->universes[u];
+            if (batch->count > 0 && (universe->socket != queued || batch->count == UDP_BATCH)) sent += udpSend(queued, batch);
+            queued = universe->socket;
+            universe->sequence = universe->sequence % 255 + 1;
+            unsigned char* packet = batch->packets[batch->count];
+            batch->length[batch->count++] = dmx->protocol == DMX_SACN ? dmxSacn(packet, dmx, universe) : dmxArtnet(packet, universe);
+        }
+        if (batch->count > 0 && (dmx->sync != queued || batch->count == UDP_BATCH)) sent += udpSend(queued, batch);
+        batch->length[batch->count] = dmx->protocol == DMX_SACN ? dmxSacnSync(batch->packets[batch->count], dmx) : dmxArtSync(batch->packets[batch->count]);
+        batch->count++;
+        sent += udpSend(dmx->sync, batch);
+        InterlockedExchangeAdd(&metrics.dmxPackets, sent);
+        InterlockedIncrement(&metrics.dmxFrames);
+    }
+    closePacer(&pacer);
+    return 0;
+}
+
+int openDmx(DMXDATA* dmx, const char* path) {
+    if (loadDmxPatch(dmx, path)) return -1;
+    //Sockets are per universe only where the destination is; otherwise they share one
+    for (int u = 0; u < dmx->universeCount; u++) {
+        DMXUNIVERSE* universe = &dmx->universes[u];
+        if (u > 0 && (dmx->host[0] != '\0' || dmx->protocol == DMX_ARTNET)) universe->socket = dmx->universes[0].socket;
+        else universe->socket = dmxSocket(dmx, universe->number);
+        if (universe->socket == INVALID_SOCKET) return -1;
+    }
+    dmx->sync = dmx->protocol == DMX_SACN && dmx->host[0] == '\0' ? dmxSocket(dmx, DMX_SYNC_UNIVERSE) : dmx->universes[0].socket;
+    if (dmx->sync == INVALID_SOCKET) return -1;
+    LARGE_INTEGER seed;
+    QueryPerformanceCounter(&seed);
+    for (int i = 0; i < 16; i++) dmx->cid[i] = (unsigned char)(fnv1a("NNB", (unsigned int)(seed.QuadPart + i)) >> 8);
+    dmx->batch = (UDPBATCH*)HeapAlloc(GetProcessHeap(), 0, sizeof(UDPBATCH));
+    if (dmx->batch == NULL) return -1;
+    dmx->back = 0;
+    dmx->exchange = 1;
+    dmx->running = 1;
+    DWORD senderID;
+    dmx->thread = CreateThread(NULL, 0, DmxSender, dmx, 0, &senderID);
+    std::cout << "DMX output: " << dmx->fixtureCount << " fixtures in " << dmx->universeCount << " universes over "
+        << (dmx->protocol == DMX_SACN ? "sACN" : "Art-Net") << " at " << dmx->rate << " Hz" << std::endl;
+    return 0;
+}
+
+//Called by the render thread once a frame with the state it just drew
+void dmxFrame(DMXDATA* dmx, FRAME* frame) {
+    DMXLIGHTS* lights = &dmx->lights[dmx->back];
+    const float* colors[3] = { frame->rc, frame->gc, frame->bc };
+    const float* positions[3] = { frame->rl, frame->gl, frame->bl };
+    for (int i = 0; i < 3; i++) lights->color[3][i] = 0.0f;
+    lights->position[3][0] = lights->position[3][1] = 0.0f;
+    for (int l = 0; l < 3; l++) {
+        for (int i = 0; i < 3; i++) {
+            lights->color[l][i] = colors[l][i];
+            lights->color[3][i] += colors[l][i] / 3.0f;
+        }
+        //The lights swing through x -6 to 6 and y 1.5 to 2.5
+        lights->position[l][0] = (positions[l][0] + 6.0f) / 12.0f;
+        lights->position[l][1] = positions[l][1] - 1.5f;
+        lights->position[3][0] += lights->position[l][0] / 3.0f;
+        lights->position[3][1] += lights->position[l][1] / 3.0f;
+    }
+    dmx->back = InterlockedExchange(&dmx->exchange, dmx->back | DMX_FRESH) & ~DMX_FRESH;
+}
+
+void closeDmx(DMXDATA* dmx) {
+    dmx->running = 0;
+    if (dmx->thread != NULL) {
+        WaitForSingleObject(dmx->thread, INFINITE);
+        CloseHandle(dmx->thread);
+    }
+    //Sockets are shared between universes, so each is closed once
+    SOCKET closed[DMX_UNIVERSES + 1];
+    int closedCount = 0;
+    for (int u = 0; u <= dmx->universeCount; u++) {
+        SOCKET s = u < dmx->universeCount ? dmx->universes[u].socket : dmx->sync;
+        int known = s == INVALID_SOCKET || s == 0;
+        for (int i = 0; i < closedCount && !known; i++) known = closed[i] == s;
+        if (known) continue;
+        closesocket(s);
+        closed[closedCount++] = s;
+    }
+    if (dmx->batch != NULL) HeapFree(GetProcessHeap(), 0, dmx->batch);
+    *dmx = {};
+}
+
+/*Test listener standing in for the rig, run as a second process with
+* -dmxrecv [seconds] [port]. Takes Art-Net and sACN alike and reports, once a
+* second, the frames (syncs) received, the universes seen, the widest gap
+* between syncs and the first channels of the lowest universe. sACN is only
+* heard here when the patch sends it unicast to this machine on port 5568.
+*/
+int receiveDmx(int seconds, int port) {
+    if (port <= 0) port = DMX_ARTNET_PORT;
+    SOCKET s = udpListener(port, 100);
+    if (s == INVALID_SOCKET) return -1;
+    std::cout << "Listening for Art-Net and sACN on port " << port << std::endl;
+    unsigned char packet[UDP_PACKET];
+    unsigned char first[8] = {};
+    int lowest = -1;
+    int seen[DMX_UNIVERSES];
+    int seenCount = 0;
+    LONG64 started = shmNow(), reported = started, lastSync = 0;
+    long syncs = 0, packets = 0;
+    double gapMax = 0.0;
+    while (seconds <= 0 || shmNow() - started < (LONG64)seconds * 1000000) {
+        int length = recv(s, (char*)packet, sizeof(packet), 0);
+        int universe = -1, sync = 0;
+        const unsigned char* data = NULL;
+        if (length >= 14 && memcmp(packet, "Art-Net", 8) == 0) {
+            if (packet[9] == 0x50 && length >= 18 + 8) {
+                universe = packet[14] | packet[15] << 8;
+                data = packet + 18;
+            }else if (packet[9] == 0x52) sync = 1;
+        }else if (length >= 49 && memcmp(packet + 4, "ASC-E1.17", 9) == 0) {
+            if (packet[21] == 4 && length >= 126 + 8) {
+                universe = packet[113] << 8 | packet[114];
+                data = packet + 126;
+            }else if (packet[21] == 8) sync = 1;
+        }
+        if (length > 0) packets++;
+        if (universe >= 0) {
+            int known = 0;
+            for (int i = 0; i < seenCount && !known; i++) known = seen[i] == universe;
+            if (!known && seenCount < DMX_UNIVERSES) seen[seenCount++] = universe;
+            if (lowest < 0 || universe <= lowest) {
+                lowest = universe;
+                memcpy(first, data, sizeof(first));
+            }
+        }
+        if (sync) {
+            LONG64 now = shmNow();
+            if (lastSync != 0 && (now - lastSync) / 1000.0 > gapMax) gapMax = (now - lastSync) / 1000.0;
+            lastSync = now;
+            syncs++;
+        }
+        if (shmNow() - reported >= 1000000) {
+            reported = shmNow();
+            std::cout << "frames " << syncs << " packets " << packets << " universes " << seenCount << " max gap " << gapMax << "ms";
+            if (lowest >= 0) {
+                std::cout << ", universe " << lowest << ":";
+                for (int i = 0; i < 8; i++) std::cout << " " << (int)first[i];
+            }
+            std::cout << std::endl;
+            gapMax = 0.0;
+        }
+    }
+    std::cout << "Done: " << syncs << " frames, " << packets << " packets" << std::endl;
+    closesocket(s);
+    return 0;
+}
+
+/*Lighting console input, with -dmxin [mapping]. DmxListener takes Art-Net
+* (port 6454) or sACN (port 5568, joining each mapped universe's group) and
+* writes the mapped channels into its own copy of the parameters. When a
+* packet changes any of them the whole set goes to the render thread through
+* [exchange], so a fader flood costs one copy per packet and the render
+* thread only ever sees the newest values. The stage takes them right before
+* it builds its frame and reports, once presented, how long the newest
+* change took from the wire to the swap.
+*
+* The mapping is a JSON array of flat objects:
+*   {"protocol":"artnet", "stage":0, "hold":3}                 input; hold is seconds without data
+*   {"parameter":"red.r", "universe":0, "channel":1}            one console channel per parameter
+* Parameters are red, green or blue with .r, .g or .b for the lights' colour,
+* master for their intensity, mode (slideshow above half) and preset (1 up
+* recalls that preset, 0 leaves it). Colours follow the console as soon as
+* any of a light's channels arrive, with no fade, and go back to the stage's
+* own colours when the console has been silent for the hold time. Mode and
+* preset act when the console changes them, so the CLI and HTTP keep working;
+* the values in the first packet, and the first after a hold runs out, are
+* only taken as where the console's faders start.
+*/
+typedef struct dmxInputState {
+    float values[DMXIN_PARAMETERS];
+    int touched;
+    LONG64 stamp;
+} DMXINSTATE;
+
+typedef struct dmxInputChannel {
+    int parameter;
+    int universe;
+    int channel;
+} DMXINCHANNEL;
+
+typedef struct dmxInput {
+    int protocol;
+    int stage;
+    float hold;
+    DMXINCHANNEL channels[DMXIN_CHANNELS];
+    int channelCount;
+    SOCKET socket;
+    DMXINSTATE current;
+    DMXINSTATE states[DMXIN_SLOTS];
+    int back;
+    volatile LONG exchange;
+    int front;
+    LONG64 applied;
+    LONG64 pending;
+    int mode; //-1 until the console's first value is seen
+    int preset;
+    HANDLE thread;
+    volatile LONG running;
+} DMXINPUT;
+
+const char* dmxInputNames[DMXIN_PARAMETERS] = {
+    "red.r", "red.g", "red.b", "green.r", "green.g", "green.b", "blue.r", "blue.g", "blue.b", "master", "mode", "preset"
+};
+
+int loadDmxInput(DMXINPUT* in, const char* path) {
+    std::streamsize size;
+    char* json = readFile(path, &size);
+    if (json == NULL) {
+        errorCallback(-1, "Unable to read the console mapping!");
+        return -1;
+    }
+    in->protocol = DMX_ARTNET;
+    in->hold = DMXIN_HOLD;
+    const char* end = json + size - 1;
+    const char* object;
+    char value[64];
+    for (const char* close = jsonObject(json, end, &object); close != NULL; close = jsonObject(close + 1, end, &object)) {
+        if (jsonField(object, close, "protocol", value, sizeof(value))) {
+            in->protocol = streq(value, "SACN", 0, 5) ? DMX_SACN : DMX_ARTNET;
+            if (jsonField(object, close, "stage", value, sizeof(value))) in->stage = atoi(value);
+            if (jsonField(object, close, "hold", value, sizeof(value))) in->hold = (float)atof(value);
+            continue;
+        }
+        if (!jsonField(object, close, "parameter", value, sizeof(value)) || in->channelCount == DMXIN_CHANNELS) continue;
+        DMXINCHANNEL* channel = &in->channels[in->channelCount];
+        channel->parameter = -1;
+        for (int p = 0; p < DMXIN_PARAMETERS; p++) if (streq(value, dmxInputNames[p], 0, 8)) channel->parameter = p;
+        channel->universe = jsonField(object, close, "universe", value, sizeof(value)) ? atoi(value) : 0;
+        channel->channel = jsonField(object, close, "channel", value, sizeof(value)) ? atoi(value) : 0;
+        if (channel->parameter < 0 || channel->channel < 1 || channel->channel > 512) {
+            errorCallback(-1, "Console mapping with an unknown parameter or a bad channel, skipped.");
+            continue;
+        }
+        in->channelCount++;
+    }
+    HeapFree(GetProcessHeap(), 0, json);
+    //The protocol can come after the channels, so the universe range is checked once it is known
+    int kept = 0;
+    for (int i = 0; i < in->channelCount; i++) {
+        int universe = in->channels[i].universe;
+        if (in->protocol == DMX_SACN ? universe < 1 || universe > DMX_SYNC_UNIVERSE : universe < 0 || universe > 0x7FFF) {
+            errorCallback(-1, "Console mapping on a universe the protocol cannot address, skipped.");
+            continue;
+        }
+        in->channels[kept++] = in->channels[i];
+    }
+    in->channelCount = kept;
+    if (in->channelCount == 0) {
+        errorCallback(-1, "The console mapping has no channels!");
+        return -1;
+    }
+    return 0;
+}
+
+//Finds the universe and DMX slots in an Art-Net or sACN data packet; returns the slot count
+int dmxInputParse(const unsigned char* packet, int length, int* universe, const unsigned char** data) {
+    if (length >= 18 && memcmp(packet, "Art-Net", 8) == 0 && packet[8] == 0x00 && packet[9] == 0x50) {
+        int count = packet[16] << 8 | packet[17];
+        *universe = packet[14] | (packet[15] & 0x7F) << 8;
+        *data = packet + 18;
+        return count < length - 18 ? count : length - 18;
+    }
+    //E1.31 data, null start code, not preview data
+    if (length >= 126 && memcmp(packet + 4, "ASC-E1.17", 9) == 0 && packet[21] == 4 && packet[43] == 2 && packet[125] == 0 && !(packet[112] & 0x80)) {
+        int count = (packet[123] << 8 | packet[124]) - 1;
+        *universe = packet[113] << 8 | packet[114];
+        *data = packet + 126;
+        return count < length - 126 ? count : length - 126;
+    }
+    return 0;
+}
+
+DWORD WINAPI DmxListener(LPVOID lpParam) {
+    DMXINPUT* in = (DMXINPUT*)lpParam;
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+    unsigned char packet[UDP_PACKET];
+    while (in->running) {
+        int length = recv(in->socket, (char*)packet, sizeof(packet), 0);
+        if (length <= 0) continue;
+        LONG64 now = shmNow();
+        InterlockedIncrement(&metrics.dmxInPackets);
+        int universe;
+        const unsigned char* data;
+        int count = dmxInputParse(packet, length, &universe, &data);
+        int changed = 0, matched = 0;
+        for (int i = 0; i < in->channelCount; i++) {
+            DMXINCHANNEL* channel = &in->channels[i];
+            if (channel->universe != universe || channel->channel > count) continue;
+            matched = 1;
+            float value = data[channel->channel - 1] / 255.0f;
+            if (!(in->current.touched & (1 << channel->parameter)) || in->current.values[channel->parameter] != value) changed = 1;
+            in->current.values[channel->parameter] = value;
+            in->current.touched |= 1 << channel->parameter;
+        }
+        if (!matched) continue;
+        //Consoles repeat the universe even when nothing moves; those only refresh the hold
+        in->current.stamp = changed ? now : -now;
+        in->states[in->back] = in->current;
+        in->back = InterlockedExchange(&in->exchange, in->back | DMXIN_FRESH) & ~DMXIN_FRESH;
+    }
+    return 0;
+}
+
+//Returns 1, without opening anything, when the mapping is for another stage
+int openDmxInput(DMXINPUT* in, const char* path, int stage) {
+    if (loadDmxInput(in, path)) return -1;
+    if (in->stage != stage) return 1;
+    in->socket = udpListener(in->protocol == DMX_SACN ? DMX_SACN_PORT : DMX_ARTNET_PORT, 100);
+    if (in->socket == INVALID_SOCKET) return -1;
+    if (in->protocol == DMX_SACN) {
+        for (int i = 0; i < in->channelCount; i++) {
+            int universe = in->channels[i].universe;
+            int joined = 0;
+            for (int j = 0; j < i && !joined; j++) joined = in->channels[j].universe == universe;
+            if (joined) continue;
+            ip_mreq group = {};
+            group.imr_multiaddr.s_addr = htonl(0xEFFF0000 | (universe & 0xFFFF));
+            group.imr_interface.s_addr = htonl(INADDR_ANY);
+            if (setsockopt(in->socket, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char*)&group, sizeof(group)) == SOCKET_ERROR) {
+                errorCallback(-1, "Unable to join an sACN universe; only unicast sACN will be heard.");
+            }
+        }
+    }
+    in->back = 0;
+    in->exchange = 1;
+    in->front = 2;
+    in->mode = -1;
+    in->preset = -1;
+    in->running = 1;
+    DWORD listenerID;
+    in->thread = CreateThread(NULL, 0, DmxListener, in, 0, &listenerID);
+    std::cout << "Console input: " << in->channelCount << " channels over "
+        << (in->protocol == DMX_SACN ? "sACN" : "Art-Net") << " to stage " << in->stage + 1 << std::endl;
+    return 0;
+}
+
+//Render thread, right before the frame is built; [data] is the stage's thread data
+void dmxInputFrame(DMXINPUT* in, SCENE* scene, char* data, INSTANCE* instance) {
+    if (in->exchange & DMXIN_FRESH) {
+        in->front = InterlockedExchange(&in->exchange, in->front) & ~DMXIN_FRESH;
+        DMXINSTATE* state = &in->states[in->front];
+        LONG64 stamp = state->stamp < 0 ? -state->stamp : state->stamp;
+        if (state->stamp > 0) in->pending = state->stamp;
+        if (stamp > in->applied) in->applied = stamp;
+        float* values = state->values;
+        float master = state->touched & (1 << DMXIN_MASTER) ? values[DMXIN_MASTER] : 1.0f;
+        for (int l = 0; l < 3; l++) {
+            if (!(state->touched & (7 << l * 3))) continue;
+            scene->live |= 1 << l;
+            for (int i = 0; i < 3; i++) scene->liveLights[l][i] = values[l * 3 + i] * master;
+        }
+        if (state->touched & (1 << DMXIN_MODE)) {
+            int mode = values[DMXIN_MODE] >= 0.5f;
+            if (in->mode >= 0 && mode != in->mode) writeFlags(data + D_FLAGS, F_SLIDESHOW_MODE, mode ? F_SLIDESHOW_MODE : 0);
+            in->mode = mode;
+        }
+        if (state->touched & (1 << DMXIN_PRESET)) {
+            int preset = (int)(values[DMXIN_PRESET] * 255.0f + 0.5f);
+            if (in->preset >= 0 && preset != in->preset && preset > 0) InterlockedExchange(&instance->presetRequest, preset - 1);
+            in->preset = preset;
+        }
+    }
+    //Console gone: hand the lights back
+    if (scene->live && in->hold > 0.0f && shmNow() - in->applied > (LONG64)(in->hold * 1000000)) {
+        scene->live = 0;
+        in->mode = -1;
+        in->preset = -1;
+        std::cout << "Console input lost, lights back to the stage colours." << std::endl;
+    }
+}
+
+//After the frame is presented; [frameMs] is the frame period it should land within
+void dmxInputPresented(DMXINPUT* in, float frameMs) {
+    if (in->pending == 0) return;
+    float latency = (shmNow() - in->pending) / 1000.0f;
+    in->pending = 0;
+    metrics.dmxInLatencyMs = latency;
+    if (latency > metrics.dmxInLatencyMaxMs) metrics.dmxInLatencyMaxMs = latency;
+    if (latency > frameMs) InterlockedIncrement(&metrics.dmxInLate);
+}
+
+void closeDmxInput(DMXINPUT* in) {
+    in->running = 0;
+    if (in->thread != NULL) {
+        WaitForSingleObject(in->thread, INFINITE);
+        CloseHandle(in->thread);
+    }
+    if (in->socket != INVALID_SOCKET && in->socket != 0) closesocket(in->socket);
+    *in = {};
+}
+
+/*OSC control, with -osc [port]. OscListener decodes each datagram, message
+* or bundle, into a working copy of every stage's controllable state, stamping
+* each field it touches, and publishes the stages it touched once the whole
+* datagram is decoded. The render thread takes the newest copy through
+* [exchange] at the top of its frame and applies the fields stamped since it
+* last looked, so a bundle lands in one frame and a fader sending hundreds of
+* messages a second costs one copy per datagram with only the last value
+* drawn. Nothing queues.
+*
+* Addresses, with an optional stage number after /banner (/banner/2/mode):
+*   /banner/color/1 i         light 1-3 to colour 0-7, as COLOR
+*   /banner/rgb/1 f f f       light 1-3 to any colour, held until /color
+*   /banner/mode i            1 slideshow, 0 banner (T and F work too)
+*   /banner/venue s
+*   /banner/showtime s|i      "HH:MM" or minutes after midnight
+*   /banner/preset s|i        by name, or by number from 1
+*   /banner/slide i           jump to a slide, from 0
+* Numbers may be sent as i or f. No pattern matching.
+*/
+typedef struct oscState {
+    LONG64 changed[OSC_FIELDS];
+    char colors[3];
+    float rgb[3][3];
+    int mode;
+    char venue[D_NAMESIZE];
+    int showtime;
+    int preset;
+    int slide;
+} OSCSTATE;
+
+typedef struct oscStage {
+    OSCSTATE work;
+    OSCSTATE states[OSC_SLOTS];
+    int back;
+    volatile LONG exchange;
+    int front;
+    LONG64 applied[OSC_FIELDS];
+    int touched;
+} OSCSTAGE;
+
+typedef struct oscData {
+    SOCKET socket;
+    OSCSTAGE stages[INSTANCE_MAX];
+    LONG64 sequence;
+    HANDLE thread;
+    volatile LONG running;
+} OSCDATA;
+
+OSCDATA osc = {};
+
+//OSC strings are null terminated and padded to four bytes; returns the byte after, or NULL
+const unsigned char* oscString(const unsigned char* p, const unsigned char* end, const char** out) {
+    const unsigned char* s = p;
+    while (p < end && *p != '\0') p++;
+    if (p >= end) return NULL;
+    *out = (const char*)s;
+    p = s + ((p - s) / 4 + 1) * 4;
+    return p <= end ? p : NULL;
+}
+
+unsigned int oscWord(const unsigned char* p) {
+    return (unsigned int)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+typedef struct oscArg {
+    char type;
+    int i;
+    float f;
+    const char* s;
+} OSCARG;
+
+//Decodes up to [max] arguments; returns how many, or -1 when the message is malformed
+int oscArgs(const unsigned char* p, const unsigned char* end, OSCARG* args, int max) {
+    const char* types;
+    if (p == end) return 0;
+    p = oscString(p, end, &types);
+    if (p == NULL || types[0] != ',') return -1;
+    int count = 0;
+    for (types++; *types != '\0' && count < max; types++, count++) {
+        OSCARG* arg = &args[count];
+        arg->type = *types;
+        arg->s = NULL;
+        switch (*types) {
+        case 'i':
+        case 'f':
+            if (end - p < 4) return -1;
+            arg->i = (int)oscWord(p);
+            memcpy(&arg->f, &arg->i, 4);
+            if (*types == 'i') arg->f = (float)arg->i;
+            else arg->i = (int)floorf(arg->f + 0.5f);
+            p += 4;
+            break;
+        case 's':
+            p = oscString(p, end, &arg->s);
+            if (p == NULL) return -1;
+            break;
+        case 'T':
+        case 'F':
+            arg->i = *types == 'T';
+            arg->f = (float)arg->i;
+            break;
+        default:
+            return -1;
+        }
+    }
+    return count;
+}
+
+int oscNumber(OSCARG* arg) {
+    return arg->type == 'i' || arg->type == 'f' || arg->type == 'T' || arg->type == 'F';
+}
+
+//Applies one message to the working copies; returns 0 if it was understood
+int oscMessage(OSCDATA* o, const unsigned char* p, const unsigned char* end) {
+    const char* address;
+    p = oscString(p, end, &address);
+    if (p == NULL || !streq((char*)address, "/BANNER/", 0, 8)) return -1;
+    OSCARG args[4];
+    int count = oscArgs(p, end, args, 4);
+    if (count < 0) return -1;
+    address += 8;
+    int stage = 0;
+    if (*address >= '1' && *address <= '9') {
+        stage = atoi(address) - 1;
+        while (*address >= '0' && *address <= '9') address++;
+        if (*address++ != '/' || stage >= instanceCount) return -1;
+    }
+    OSCSTAGE* s = &o->stages[stage];
+    OSCSTATE* w = &s->work;
+    LONG64 seq = ++o->sequence;
+    int field = -1;
+    if (streq((char*)address, "COLOR/", 0, 6) || streq((char*)address, "RGB/", 0, 4)) {
+        int rgb = address[0] == 'r' || address[0] == 'R';
+        int light = atoi(address + (rgb ? 4 : 6)) - 1;
+        if (light < 0 || light > 2) return -1;
+        if (rgb) {
+            if (count < 3 || !oscNumber(&args[0]) || !oscNumber(&args[1]) || !oscNumber(&args[2])) return -1;
+            for (int i = 0; i < 3; i++) w->rgb[light][i] = fminf(fmaxf(args[i].f, 0.0f), 1.0f);
+            field = OSC_RGB + light;
+        }else {
+            if (count < 1 || !oscNumber(&args[0]) || args[0].i < 0 || args[0].i > 7) return -1;
+            w->colors[light] = (char)args[0].i;
+            field = OSC_COLOR + light;
+        }
+    }else if (streq((char*)address, "MODE", 0, 5)) {
+        if (count < 1 || !oscNumber(&args[0])) return -1;
+        w->mode = args[0].i != 0;
+        field = OSC_MODE;
+    }else if (streq((char*)address, "VENUE", 0, 6)) {
+        //sprintf_s would abort the process on an oversized name, and anyone on the network can send one
+        if (count < 1 || args[0].type != 's' || strlen(args[0].s) >= sizeof(w->venue)) return -1;
+        sprintf_s(w->venue, "%s", args[0].s);
+        field = OSC_VENUE;
+    }else if (streq((char*)address, "SHOWTIME", 0, 9)) {
+        //Checked before it is stored, so a rejected value never rides out with a later valid stamp
+        int showtime = -1;
+        if (count < 1) return -1;
+        if (args[0].type == 's') {
+            int hr = 0, mn = 0;
+            if (sscanf_s(args[0].s, "%d:%d", &hr, &mn) != 2) {
+                hr = atoi(args[0].s) / 100;
+                mn = atoi(args[0].s) % 100;
+            }
+            showtime = hr * 60 + mn;
+        }else if (oscNumber(&args[0])) showtime = args[0].i;
+        if (showtime < 0 || showtime >= 24 * 60) return -1;
+        w->showtime = showtime;
+        field = OSC_SHOWTIME;
+    }else if (streq((char*)address, "PRESET", 0, 7)) {
+        int preset = -1;
+        if (count < 1) return -1;
+        if (args[0].type == 's') {
+            AcquireSRWLockShared(&presetLock);
+            preset = findPreset(args[0].s);
+            ReleaseSRWLockShared(&presetLock);
+        }else if (oscNumber(&args[0])) preset = args[0].i - 1;
+        if (preset < 0 || preset >= presetCount) return -1;
+        w->preset = preset;
+        field = OSC_PRESET;
+    }else if (streq((char*)address, "SLIDE", 0, 6)) {
+        if (count < 1 || !oscNumber(&args[0]) || args[0].i < 0) return -1;
+        w->slide = args[0].i;
+        field = OSC_SLIDE;
+    }
+    if (field < 0) return -1;
+    w->changed[field] = seq;
+    s->touched = 1;
+    return 0;
+}
+
+//A bundle's elements may be bundles themselves; their time tags are ignored and everything applies now
+void oscPacket(OSCDATA* o, const unsigned char* p, const unsigned char* end, int depth) {
+    if (end - p >= 16 && memcmp(p, "#bundle", 8) == 0) {
+        if (depth == 0) InterlockedIncrement(&metrics.oscBundles);
+        for (p += 16; end - p >= 4; ) {
+            unsigned int size = oscWord(p);
+            p += 4;
+            if (size > (unsigned int)(end - p) || size % 4 != 0) {
+                InterlockedIncrement(&metrics.oscDropped);
+                return;
+            }
+            if (depth < OSC_DEPTH) oscPacket(o, p, p + size, depth + 1);
+            p += size;
+        }
+        return;
+    }
+    InterlockedIncrement(&metrics.oscMessages);
+    if (oscMessage(o, p, end)) InterlockedIncrement(&metrics.oscDropped);
+}
+
+DWORD WINAPI OscListener(LPVOID lpParam) {
+    OSCDATA* o = (OSCDATA*)lpParam;
+    unsigned char packet[OSC_PACKET];
+    while (o->running) {
+        int length = recv(o->socket, (char*)packet, sizeof(packet), 0);
+        if (length <= 0 || length % 4 != 0) continue;
+        oscPacket(o, packet, packet + length, 0);
+        for (int n = 0; n < INSTANCE_MAX; n++) {
+            OSCSTAGE* s = &o->stages[n];
+            if (!s->touched) continue;
+            s->touched = 0;
+            s->states[s->back] = s->work;
+            s->back = InterlockedExchange(&s->exchange, s->back | OSC_FRESH) & ~OSC_FRESH;
+        }
+    }
+    return 0;
+}
+
+int openOsc(OSCDATA* o, int port) {
+    o->socket = udpListener(port, 100);
+    if (o->socket == INVALID_SOCKET) return -1;
+    for (int n = 0; n < INSTANCE_MAX; n++) {
+        o->stages[n].back = 0;
+        o->stages[n].exchange = 1;
+        o->stages[n].front = 2;
+    }
+    o->running = 1;
+    DWORD listenerID;
+    o->thread = CreateThread(NULL, 0, OscListener, o, 0, &listenerID);
+    std::cout << "OSC control on port " << port << std::endl;
+    return 0;
+}
+
+//Render thread, at the top of the frame; [data] is the stage's thread data
+void oscFrame(OSCSTAGE* s, char* data, SCENE* scene, ANIMATION* anim, unsigned int slideCount, INSTANCE* instance) {
+    if (!(s->exchange & OSC_FRESH)) return;
+    s->front = InterlockedExchange(&s->exchange, s->front) & ~OSC_FRESH;
+    OSCSTATE* state = &s->states[s->front];
+    int fresh[OSC_FIELDS];
+    for (int f = 0; f < OSC_FIELDS; f++) {
+        fresh[f] = state->changed[f] > s->applied[f];
+        if (!fresh[f]) continue;
+        s->applied[f] = state->changed[f];
+        InterlockedIncrement(&metrics.oscApplied);
+    }
+    for (int l = 0; l < 3; l++) {
+        if (fresh[OSC_COLOR + l]) {
+            data[D_COLOR1 + l] = state->colors[l];
+            scene->live &= ~(1 << l);
+        }
+        if (fresh[OSC_RGB + l]) {
+            for (int i = 0; i < 3; i++) scene->liveLights[l][i] = state->rgb[l][i];
+            scene->live |= 1 << l;
+        }
+    }
+    if (fresh[OSC_MODE]) writeFlags(data + D_FLAGS, F_SLIDESHOW_MODE, state->mode ? F_SLIDESHOW_MODE : 0);
+    if (fresh[OSC_VENUE]) sprintf_s(data + D_VENUENAME, D_NAMESIZE, "%s", state->venue);
+    if (fresh[OSC_SHOWTIME]) *((int*)(data + D_DOWNBEAT)) = state->showtime;
+    if (fresh[OSC_PRESET]) {
+        InterlockedExchange(&instance->presetRequest, state->preset);
+        instance->preset = state->preset;
+    }
+    if (fresh[OSC_SLIDE] && slideCount > 0) {
+        anim->slideID = state->slide % slideCount;
+        //Cut short a transition already running rather than finish it onto the wrong slide
+        anim->slideTransition = 0;
+        if (anim->phase < PI) anim->phase = PI;
+    }
+}
+
+void closeOsc(OSCDATA* o) {
+    o->running = 0;
+    if (o->thread != NULL) {
+        WaitForSingleObject(o->thread, INFINITE);
+        CloseHandle(o->thread);
+    }
+    if (o->socket != INVALID_SOCKET && o->socket != 0) closesocket(o->socket);
+    *o = {};
+}
+
+/*Gamepad and footswitch control, with -gamepad [map]. GamepadPoller reads
+* every connected joystick at GAMEPAD_RATE on its own thread, through the
+* gamepad layout when GLFW has a mapping for the device and its raw buttons
+* otherwise (most USB footswitches), and counts each press against its
+* action, stamping the newest. The render thread compares the counts with
+* what it has already acted on, so a long frame only makes it act on several
+* presses at once; none are lost. Latency is taken from the newest press to
+* the swap of the frame that shows it.
+*
+* The map is a JSON array of {"button":0, "action":"next"}, with actions
+* next, previous (slides), mode and preset (recalls the next preset). Button
+* numbers are GLFW_GAMEPAD_BUTTON_* on mapped gamepads (0 A, 1 B, 4 and 5 the
+* bumpers, 12 and 14 the d-pad right and left) and raw indices otherwise.
+* Without a map 0, 5 and 12 advance, 3, 4 and 14 go back, 1 toggles the mode
+* and 2 recalls the next preset.
+*/
+typedef struct gamepad {
+    int actions[GAMEPAD_BUTTONS];
+    unsigned char held[GLFW_JOYSTICK_LAST + 1][GAMEPAD_BUTTONS];
+    volatile LONG presses[GAMEPAD_ACTIONS];
+    volatile LONG64 stamp;
+    LONG handled[GAMEPAD_ACTIONS];
+    LONG64 pending;
+    HANDLE thread;
+    volatile LONG running;
+} GAMEPAD;
+
+const char* gamepadActions[GAMEPAD_ACTIONS] = { "next", "previous", "mode", "preset" };
+
+void loadGamepadMap(GAMEPAD* pad, const char* path) {
+    for (int b = 0; b < GAMEPAD_BUTTONS; b++) pad->actions[b] = -1;
+    std::streamsize size;
+    char* json = path != NULL ? readFile(path, &size) : NULL;
+    if (json == NULL) {
+        if (path != NULL) errorCallback(-1, "Unable to read the gamepad map, using the default buttons.");
+        pad->actions[GLFW_GAMEPAD_BUTTON_A] = pad->actions[GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER] = pad->actions[GLFW_GAMEPAD_BUTTON_DPAD_RIGHT] = GAMEPAD_NEXT;
+        pad->actions[GLFW_GAMEPAD_BUTTON_Y] = pad->actions[GLFW_GAMEPAD_BUTTON_LEFT_BUMPER] = pad->actions[GLFW_GAMEPAD_BUTTON_DPAD_LEFT] = GAMEPAD_PREVIOUS;
+        pad->actions[GLFW_GAMEPAD_BUTTON_B] = GAMEPAD_MODE;
+        pad->actions[GLFW_GAMEPAD_BUTTON_X] = GAMEPAD_PRESET;
+        return;
+    }
+    const char* end = json + size - 1;
+    const char* object;
+    char value[32];
+    for (const char* close = jsonObject(json, end, &object); close != NULL; close = jsonObject(close + 1, end, &object)) {
+        if (!jsonField(object, close, "button", value, sizeof(value))) continue;
+        int button = atoi(value);
+        if (button < 0 || button >= GAMEPAD_BUTTONS || !jsonField(object, close, "action", value, sizeof(value))) continue;
+        for (int a = 0; a < GAMEPAD_ACTIONS; a++) if (streq(value, gamepadActions[a], 0, 9)) pad->actions[button] = a;
+    }
+    HeapFree(GetProcessHeap(), 0, json);
+}
+
+DWORD WINAPI GamepadPoller(LPVOID lpParam) {
+    GAMEPAD* pad = (GAMEPAD*)lpParam;
+    PACER pacer;
+    startPacer(&pacer, GAMEPAD_RATE);
+    while (pad->running) {
+        pace(&pacer);
+        LONG64 now = shmNow();
+        unsigned char buttons[GLFW_JOYSTICK_LAST + 1][GAMEPAD_BUTTONS] = {};
+        int counts[GLFW_JOYSTICK_LAST + 1] = {};
+        //GLFW's joystick table is process-wide, like its windows
+        AcquireSRWLockExclusive(&glfwLock);
+        for (int j = GLFW_JOYSTICK_1; j <= GLFW_JOYSTICK_LAST; j++) {
+            if (!glfwJoystickPresent(j)) continue;
+            GLFWgamepadstate state;
+            if (glfwJoystickIsGamepad(j) && glfwGetGamepadState(j, &state)) {
+                counts[j] = GLFW_GAMEPAD_BUTTON_LAST + 1;
+                memcpy(buttons[j], state.buttons, counts[j]);
+            }else {
+                const unsigned char* raw = glfwGetJoystickButtons(j, &counts[j]);
+                if (counts[j] > GAMEPAD_BUTTONS) counts[j] = GAMEPAD_BUTTONS;
+                if (raw != NULL) memcpy(buttons[j], raw, counts[j]);
+            }
+        }
+        ReleaseSRWLockExclusive(&glfwLock);
+        for (int j = GLFW_JOYSTICK_1; j <= GLFW_JOYSTICK_LAST; j++) {
+            for (int b = 0; b < GAMEPAD_BUTTONS; b++) {
+                int down = b < counts[j] && buttons[j][b] == GLFW_PRESS;
+                if (down && !pad->held[j][b] && pad->actions[b] >= 0) {
+                    pad->stamp = now;
+                    InterlockedIncrement(&pad->presses[pad->actions[b]]);
+                    InterlockedIncrement(&metrics.gamepadPresses);
+                }
+                pad->held[j][b] = (unsigned char)down;
+            }
+        }
+    }
+    closePacer(&pacer);
+    return 0;
+}
+
+int openGamepad(GAMEPAD* pad, const char* path) {
+    loadGamepadMap(pad, path);
+    pad->running = 1;
+    DWORD pollerID;
+    pad->thread = CreateThread(NULL, 0, GamepadPoller, pad, 0, &pollerID);
+    if (pad->thread == NULL) return -1;
+    int present = 0;
+    AcquireSRWLockExclusive(&glfwLock);
+    for (int j = GLFW_JOYSTICK_1; j <= GLFW_JOYSTICK_LAST; j++) present += glfwJoystickPresent(j);
+    ReleaseSRWLockExclusive(&glfwLock);
+    std::cout << "Gamepad input at " << GAMEPAD_RATE << " Hz, " << present << " connected" << std::endl;
+    return 0;
+}
+
+//Render thread, at the top of the frame; acts on every press since the last one
+void gamepadFrame(GAMEPAD* pad, char* data, ANIMATION* anim, unsigned int slideCount, INSTANCE* instance) {
+    LONG64 stamp = pad->stamp;
+    LONG count[GAMEPAD_ACTIONS];
+    int any = 0;
+    for (int a = 0; a < GAMEPAD_ACTIONS; a++) {
+        LONG presses = pad->presses[a];
+        count[a] = presses - pad->handled[a];
+        pad->handled[a] = presses;
+        any |= count[a] != 0;
+    }
+    if (!any) return;
+    pad->pending = stamp;
+    int step = (int)((count[GAMEPAD_NEXT] - count[GAMEPAD_PREVIOUS]) % (LONG)(slideCount > 0 ? slideCount : 1));
+    if (step != 0 && slideCount > 0) {
+        anim->slideID = (anim->slideID + slideCount + step) % slideCount;
+        anim->slideTransition = 0;
+        if (anim->phase < PI) anim->phase = PI;
+    }
+    if (count[GAMEPAD_MODE] & 1) writeFlags(data + D_FLAGS, F_SLIDESHOW_MODE, -!readFlags(data + D_FLAGS, F_SLIDESHOW_MODE));
+    if (count[GAMEPAD_PRESET] > 0 && presetCount > 0) {
+        int preset = (instance->preset + count[GAMEPAD_PRESET]) % presetCount;
+        if (preset < 0) preset += presetCount;
+        InterlockedExchange(&instance->presetRequest, preset);
+        instance->preset = preset;
+    }
+}
+
+//After the frame is presented; [frameMs] is the frame period it should land within
+void gamepadPresented(GAMEPAD* pad, float frameMs) {
+    if (pad->pending == 0) return;
+    float latency = (shmNow() - pad->pending) / 1000.0f;
+    pad->pending = 0;
+    metrics.gamepadLatencyMs = latency;
+    if (latency > metrics.gamepadLatencyMaxMs) metrics.gamepadLatencyMaxMs = latency;
+    //A press just after the frame started waits for the next one, so two frames is on time
+    if (latency > frameMs * 2) InterlockedIncrement(&metrics.gamepadLate);
+}
+
+void closeGamepad(GAMEPAD* pad) {
+    pad->running = 0;
+    if (pad->thread != NULL) {
+        WaitForSingleObject(pad->thread, INFINITE);
+        CloseHandle(pad->thread);
+    }
+    pad->thread = NULL;
+}
+
+/*Multi-node sync, with -sync leader|follower [group] [port]. The leader's
+* first stage publishes its animation state at the top of every frame; a
+* sender thread multicasts the newest at SYNC_RATE, and a responder answers
+* followers' clock pings on port + 1. A follower's listener keeps the newest
+* state and pings the leader every SYNC_PING ms, keeping the offset from the
+* round trip with the least delay of the last SYNC_SAMPLES, as NTP does.
+*
+* At the top of each frame the follower works out which leader frame is due
+* now on the leader's clock and steps the leader's state forward to it with
+* the leader's own frame timing, so slide transitions (which start on frame
+* counts) begin on the same frame everywhere, and a follower joining mid-show
+* is in step from its first state. The leader reports when its transitions
+* began, and followers compare their own against that. Followers multicast a
+* report once a second, which -syncwatch [seconds] prints for every node, so
+* several instances on one machine can be checked against each other.
+*/
+typedef struct syncPacket {
+    char magic[4];
+    int type;
+    unsigned int node;
+    int slideshow;
+    LONG64 time;     //State: leader clock at the top of the frame. Ping and pong: the follower's send time
+    LONG64 receive;  //Pong: leader clock on arrival
+    LONG64 transmit; //Pong: leader clock on reply
+    LONG64 period;   //Leader frame interval, microseconds
+    float step;      //What the leader advances its animation by each frame
+    unsigned int transitionFrame;
+    LONG64 transitionStart;
+    ANIMATION anim;
+    float offsetMs;  //Report
+    float delayMs;
+    float errorMs;
+} SYNCPACKET;
+
+typedef struct syncData {
+    int leader;
+    char group[64];
+    int port;
+    unsigned int node;
+    SOCKET socket;
+    SOCKET ping;
+    sockaddr_in leaderAddress;
+    volatile LONG leaderKnown;
+    SYNCPACKET states[SYNC_SLOTS];
+    int back;
+    volatile LONG exchange;
+    int front;
+    int ready;
+    volatile LONG64 offset;
+    volatile LONG offsetReady;
+    LONG64 samples[SYNC_SAMPLES][2];
+    int sampleCount;
+    LONG64 period;
+    float step;
+    unsigned int transitionFrame;
+    LONG64 transitionStart;
+    HANDLE threads[2];
+    volatile LONG running;
+} SYNCDATA;
+
+int syncValid(SYNCPACKET* packet, int length) {
+    return length == sizeof(SYNCPACKET) && memcmp(packet->magic, "NNBS", 4) == 0;
+}
+
+//Leader: multicasts the newest state
+DWORD WINAPI SyncSender(LPVOID lpParam) {
+    SYNCDATA* sync = (SYNCDATA*)lpParam;
+    PACER pacer;
+    startPacer(&pacer, SYNC_RATE);
+    while (sync->running) {
+        pace(&pacer);
+        if (!(sync->exchange & SYNC_FRESH)) continue;
+        sync->front = InterlockedExchange(&sync->exchange, sync->front) & ~SYNC_FRESH;
+        if (send(sync->socket, (const char*)&sync->states[sync->front], sizeof(SYNCPACKET), 0) == sizeof(SYNCPACKET)) InterlockedIncrement(&metrics.syncPackets);
+    }
+    closePacer(&pacer);
+    return 0;
+}
+
+//Leader: answers clock pings, stamping arrival and reply as close to the socket as it can
+DWORD WINAPI SyncResponder(LPVOID lpParam) {
+    SYNCDATA* sync = (SYNCDATA*)lpParam;
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+    SYNCPACKET packet;
+    while (sync->running) {
+        sockaddr_in from;
+        socklen_t fromLength = sizeof(from);
+        int length = recvfrom(sync->ping, (char*)&packet, sizeof(packet), 0, (sockaddr*)&from, &fromLength);
+        LONG64 received = shmNow();
+        if (!syncValid(&packet, length) || packet.type != SYNC_PING_REQUEST) continue;
+        packet.type = SYNC_PONG;
+        packet.receive = received;
+        packet.transmit = shmNow();
+        sendto(sync->ping, (const char*)&packet, sizeof(packet), 0, (sockaddr*)&from, fromLength);
+    }
+    return 0;
+}
+
+void syncPing(SYNCDATA* sync) {
+    SYNCPACKET packet = {};
+    memcpy(packet.magic, "NNBS", 4);
+    packet.type = SYNC_PING_REQUEST;
+    packet.node = sync->node;
+    sockaddr_in to = sync->leaderAddress;
+    to.sin_port = htons((u_short)(sync->port + 1));
+    packet.time = shmNow();
+    if (sendto(sync->ping, (const char*)&packet, sizeof(packet), 0, (sockaddr*)&to, sizeof(to)) != sizeof(packet)) return;
+    LONG64 sent = packet.time;
+    //Anything but the answer to this ping (a late one) is thrown away
+    while (recv(sync->ping, (char*)&packet, sizeof(packet), 0) > 0) {
+        LONG64 arrived = shmNow();
+        if (packet.type != SYNC_PONG || packet.time != sent) continue;
+        LONG64* sample = sync->samples[sync->sampleCount++ % SYNC_SAMPLES];
+        sample[0] = ((packet.receive - sent) + (packet.transmit - arrived)) / 2;
+        sample[1] = (arrived - sent) - (packet.transmit - packet.receive);
+        int best = 0, count = sync->sampleCount < SYNC_SAMPLES ? sync->sampleCount : SYNC_SAMPLES;
+        for (int i = 1; i < count; i++) if (sync->samples[i][1] < sync->samples[best][1]) best = i;
+        InterlockedExchange64(&sync->offset, sync->samples[best][0]);
+        metrics.syncOffsetMs = sync->samples[best][0] / 1000.0f;
+        metrics.syncDelayMs = sync->samples[best][1] / 1000.0f;
+        InterlockedExchange(&sync->offsetReady, 1);
+        return;
+    }
+}
+
+//Follower: keeps the newest leader state, pings, and reports
+DWORD WINAPI SyncFollower(LPVOID lpParam) {
+    SYNCDATA* sync = (SYNCDATA*)lpParam;
+    SOCKET report = udpSender(sync->group, sync->port);
+    LONG64 lastPing = 0, lastReport = shmNow();
+    SYNCPACKET packet;
+    while (sync->running) {
+        sockaddr_in from;
+        socklen_t fromLength = sizeof(from);
+        int length = recvfrom(sync->socket, (char*)&packet, sizeof(packet), 0, (sockaddr*)&from, &fromLength);
+        if (syncValid(&packet, length) && packet.type == SYNC_STATE) {
+            sync->leaderAddress = from;
+            sync->leaderKnown = 1;
+            sync->states[sync->back] = packet;
+            sync->back = InterlockedExchange(&sync->exchange, sync->back | SYNC_FRESH) & ~SYNC_FRESH;
+            InterlockedIncrement(&metrics.syncPackets);
+        }
+        LONG64 now = shmNow();
+        if (sync->leaderKnown && now - lastPing >= SYNC_PING * 1000) {
+            lastPing = now;
+            syncPing(sync);
+        }
+        if (report != INVALID_SOCKET && now - lastReport >= 1000000) {
+            lastReport = now;
+            SYNCPACKET status = {};
+            memcpy(status.magic, "NNBS", 4);
+            status.type = SYNC_REPORT;
+            status.node = sync->node;
+            status.time = now + sync->offset;
+            status.offsetMs = metrics.syncOffsetMs;
+            status.delayMs = metrics.syncDelayMs;
+            status.errorMs = metrics.syncErrorMs;
+            status.transitionFrame = sync->transitionFrame;
+            send(report, (const char*)&status, sizeof(status), 0);
+        }
+    }
+    if (report != INVALID_SOCKET) closesocket(report);
+    return 0;
+}
+
+//[role] is leader or follower; group and port may be left NULL and 0
+int openSync(SYNCDATA* sync, const char* role, const char* group, int port) {
+    sync->leader = streq((char*)role, "LEADER", 0, 7);
+    sprintf_s(sync->group, "%s", group != NULL ? group : SYNC_GROUP);
+    sync->port = port > 0 ? port : SYNC_PORT;
+    sync->node = GetCurrentProcessId();
+    sync->period = 1000000 / 60;
+    sync->step = 1.0f / 60;
+    sync->back = 0;
+    sync->exchange = 1;
+    sync->front = 2;
+    if (sync->leader) {
+        sync->socket = udpSender(sync->group, sync->port);
+        sync->ping = udpListener(sync->port + 1, 100);
+    }else {
+        sync->socket = udpListener(sync->port, 20);
+        if (sync->socket != INVALID_SOCKET) {
+            ip_mreq membership = {};
+            inet_pton(AF_INET, sync->group, &membership.imr_multiaddr);
+            membership.imr_interface.s_addr = htonl(INADDR_ANY);
+            if (setsockopt(sync->socket, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char*)&membership, sizeof(membership)) == SOCKET_ERROR) {
+                errorCallback(-1, "Unable to join the sync group!");
+            }
+        }
+        sync->ping = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        DWORD timeout = SYNC_PING / 2;
+        if (sync->ping != INVALID_SOCKET) setsockopt(sync->ping, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
+    }
+    if (sync->socket == INVALID_SOCKET || sync->ping == INVALID_SOCKET) {
+        errorCallback(-1, "Unable to open the sync sockets!");
+        return -1;
+    }
+    sync->running = 1;
+    DWORD threadID;
+    if (sync->leader) {
+        sync->threads[0] = CreateThread(NULL, 0, SyncSender, sync, 0, &threadID);
+        sync->threads[1] = CreateThread(NULL, 0, SyncResponder, sync, 0, &threadID);
+    }else sync->threads[0] = CreateThread(NULL, 0, SyncFollower, sync, 0, &threadID);
+    std::cout << "Sync " << (sync->leader ? "leader" : "follower") << " on " << sync->group << ":" << sync->port << std::endl;
+    return 0;
+}
+
+/*Render thread, at the top of the frame before it is built. The leader
+* publishes [anim] along with the frame interval [dt] and the step the last
+* frame advanced it by; a follower replaces [anim] with the leader's, stepped
+* to the frame due now, and takes the leader's mode.
+*/
+void syncFrame(SYNCDATA* sync, ANIMATION* anim, char* data, unsigned int slideCount, double dt, double step) {
+    int slideshow = readFlags(data + D_FLAGS, F_SLIDESHOW_MODE) != 0;
+    LONG64 now = shmNow();
+    if (sync->leader) {
+        if (dt > 0.0) sync->period = (LONG64)(sync->period * 0.9 + dt * 1000000 * 0.1);
+        if (step > 0.0) sync->step = (float)(sync->step * 0.9 + step * 0.1);
+        if (slideshow && (anim->frameCount & 1023) == 0) {
+            sync->transitionFrame = anim->frameCount;
+            sync->transitionStart = now;
+        }
+        SYNCPACKET* state = &sync->states[sync->back];
+        *state = {};
+        memcpy(state->magic, "NNBS", 4);
+        state->type = SYNC_STATE;
+        state->node = sync->node;
+        state->slideshow = slideshow;
+        state->time = now;
+        state->period = sync->period;
+        state->step = sync->step;
+        state->transitionFrame = sync->transitionFrame;
+        state->transitionStart = sync->transitionStart;
+        state->anim = *anim;
+        sync->back = InterlockedExchange(&sync->exchange, sync->back | SYNC_FRESH) & ~SYNC_FRESH;
+        return;
+    }
+
+    if (sync->exchange & SYNC_FRESH) {
+        sync->front = InterlockedExchange(&sync->exchange, sync->front) & ~SYNC_FRESH;
+        sync->ready = 1;
+    }
+    if (!sync->ready || !sync->offsetReady) return;
+    SYNCPACKET* state = &sync->states[sync->front];
+    LONG64 leaderNow = now + sync->offset;
+    LONG64 frames = state->period > 0 ? (leaderNow - state->time + state->period / 2) / state->period : 0;
+    if (frames < 0) frames = 0;
+    if (frames > SYNC_AHEAD) {
+        //The leader has gone quiet; run free until it is back
+        InterlockedIncrement(&metrics.syncStale);
+        return;
+    }
+    ANIMATION at = state->anim;
+    for (LONG64 i = 0; i < frames; i++) advanceAnimation(&at, state->slideshow, slideCount, state->step);
+    if (slideCount > 0) at.slideID %= slideCount;
+    *anim = at;
+    if (state->slideshow != slideshow) writeFlags(data + D_FLAGS, F_SLIDESHOW_MODE, state->slideshow ? F_SLIDESHOW_MODE : 0);
+    if (state->slideshow && (at.frameCount & 1023) == 0 && at.frameCount != sync->transitionFrame) {
+        sync->transitionFrame = at.frameCount;
+        sync->transitionStart = leaderNow;
+    }
+    //Once the leader reports the same transition, compare the start times on its clock
+    if (state->transitionFrame == sync->transitionFrame && sync->transitionStart != 0) {
+        metrics.syncErrorMs = (float)(sync->transitionStart - state->transitionStart) / 1000.0f;
+        sync->transitionStart = 0;
+    }
+}
+
+void closeSync(SYNCDATA* sync) {
+    sync->running = 0;
+    for (int i = 0; i < 2; i++) {
+        if (sync->threads[i] == NULL) continue;
+        WaitForSingleObject(sync->threads[i], INFINITE);
+        CloseHandle(sync->threads[i]);
+    }
+    if (sync->socket != INVALID_SOCKET && sync->socket != 0) closesocket(sync->socket);
+    if (sync->ping != INVALID_SOCKET && sync->ping != 0) closesocket(sync->ping);
+    *sync = {};
+}
+
+/*Test watcher, run as another process with -syncwatch [seconds]. Listens on
+* the default group and prints the leader's frame and slide and every
+* follower's report once a second.
+*/
+int watchSync(int seconds) {
+    SOCKET s = udpListener(SYNC_PORT, 100);
+    if (s == INVALID_SOCKET) return -1;
+    ip_mreq membership = {};
+    inet_pton(AF_INET, SYNC_GROUP, &membership.imr_multiaddr);
+    membership.imr_interface.s_addr = htonl(INADDR_ANY);
+    setsockopt(s, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char*)&membership, sizeof(membership));
+    std::cout << "Watching sync on " << SYNC_GROUP << ":" << SYNC_PORT << std::endl;
+    SYNCPACKET packet, leader = {};
+    SYNCPACKET reports[SYNC_NODES];
+    int nodes = 0;
+    LONG64 started = shmNow(), reported = started;
+    while (seconds <= 0 || shmNow() - started < (LONG64)seconds * 1000000) {
+        int length = recv(s, (char*)&packet, sizeof(packet), 0);
+        if (syncValid(&packet, length) && packet.type == SYNC_STATE) leader = packet;
+        if (syncValid(&packet, length) && packet.type == SYNC_REPORT) {
+            int n = 0;
+            while (n < nodes && reports[n].node != packet.node) n++;
+            if (n == nodes && nodes < SYNC_NODES) nodes++;
+            if (n < nodes) reports[n] = packet;
+        }
+        if (shmNow() - reported < 1000000) continue;
+        reported = shmNow();
+        std::cout << "leader frame " << leader.anim.frameCount << " slide " << leader.anim.slideID
+            << " last transition at frame " << leader.transitionFrame << std::endl;
+        for (int n = 0; n < nodes; n++) {
+            std::cout << "  node " << reports[n].node << ": offset " << reports[n].offsetMs << "ms, delay " << reports[n].delayMs
+                << "ms, transition " << reports[n].transitionFrame << " off by " << reports[n].errorMs << "ms" << std::endl;
+        }
+    }
+    closesocket(s);
+    return 0;
+}
+
+/*Slide sync from a master banner to the others. The master (-assets publish)
+* splits every file in its slide folder into ASSET_CHUNK pieces named by
+* their SHA-256, drops any it hasn't stored yet into ASSET_DIR and writes a
+* manifest listing each file's chunks; the set id is the hash of that list.
+* Its own web server hands all of it out. A follower (-assets <master>)
+* polls the manifest and stops there when the set id hasn't changed.
+* Otherwise ASSET_WORKERS threads fetch only the chunks it doesn't hold,
+* verifying each against its name, and the set is assembled into its own
+* ASSET_STAGE folder, which is only renamed into place once complete. Its
+* slides are decoded into the image cache before the folder is offered to
+* the render threads, which swap at the next slide boundary.
+*/
+typedef struct assetFile {
+    char name[MAX_PATH]; //Relative to the slide folder
+    LONG64 size;
+    int first;
+    int chunks;
+} AFILE;
+
+typedef struct assetData {
+    int publish;
+    char base[256];
+    char current[65];
+    unsigned int signature;
+    AFILE files[ASSET_FILES];
+    int fileCount;
+    char (*hashes)[65];
+    int* missing;
+    volatile LONG next;
+    int missingCount;
+    HANDLE thread;
+    volatile int running;
+} ASSETDATA;
+
+ASSETDATA assets = {};
+//The newest staged slide folder, never freed; each stage swaps when it sees a new one
+char* volatile assetStaged = NULL;
+
+BCRYPT_ALG_HANDLE sha256Provider = NULL;
+
+//Hashes a buffer into 64 hex digits
+void sha256(const void* data, size_t size, char* hex) {
+    unsigned char digest[32] = {};
+    if (!BCRYPT_SUCCESS(BCryptHash(sha256Provider, NULL, 0, (PUCHAR)data, (ULONG)size, digest, sizeof(digest)))) errorCallback(-1, "Unable to hash slide data!");
+    for (int i = 0; i < 32; i++) sprintf_s(hex + i * 2, 3, "%02x", digest[i]);
+}
+
+//Writes next to [path] and renames over it, so readers only ever see a whole file
+int assetWrite(const char* path, const char* data, size_t size) {
+    char part[MAX_PATH];
+    sprintf_s(part, "%s.part", path);
+    std::ofstream file(part, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return -1;
+    file.write(data, size);
+    file.close();
+    if (file.fail() || !MoveFileExA(part, path, MOVEFILE_REPLACE_EXISTING)) return -1;
+    return 0;
+}
+
+int assetExists(const char* path) {
+    return GetFileAttributesA(path) != INVALID_FILE_ATTRIBUTES;
+}
+
+void assetChunkPath(char* path, size_t size, const char* hash) {
+    sprintf_s(path, size, "%s/%s.bin", ASSET_DIR, hash);
+}
+
+//Lists the slide folder and one level of clip folders; the signature changes whenever any name, size or date does
+int assetList(ASSETDATA* a, const char* prefix, unsigned int* signature) {
+    char pattern[MAX_PATH];
+    sprintf_s(pattern, "%s/%s*", slideDir, prefix);
+    WIN32_FIND_DATAA found;
+    HANDLE search = FindFirstFileA(pattern, &found);
+    if (search == INVALID_HANDLE_VALUE) return a->fileCount;
+    do {
+        if (found.cFileName[0] == '.') continue;
+        char name[MAX_PATH];
+        sprintf_s(name, "%s%s", prefix, found.cFileName);
+        if (found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            if (prefix[0] != '\0') continue;
+            sprintf_s(name, "%s/", found.cFileName);
+            assetList(a, name, signature);
+            continue;
+        }
+        if (strstr(name, ".part") != NULL || a->fileCount >= ASSET_FILES) continue;
+        AFILE* file = &a->files[a->fileCount++];
+        sprintf_s(file->name, "%s", name);
+        file->size = (LONG64)found.nFileSizeHigh << 32 | found.nFileSizeLow;
+        char stamp[64];
+        sprintf_s(stamp, "%lld/%lu/%lu", file->size, found.ftLastWriteTime.dwHighDateTime, found.ftLastWriteTime.dwLowDateTime);
+        *signature = fnv1a(stamp, fnv1a(name, *signature));
+    } while (FindNextFileA(search, &found));
+    FindClose(search);
+    return a->fileCount;
+}
+
+//Master: chunks whatever changed into the store and replaces the manifest
+int assetPublish(ASSETDATA* a) {
+    LONG64 started = shmNow(), total = 0;
+    size_t capacity = 256;
+    for (int i = 0; i < a->fileCount; i++) capacity += MAX_PATH + 96 + (size_t)(a->files[i].size / ASSET_CHUNK + 1) * 65;
+    char* lines = (char*)HeapAlloc(GetProcessHeap(), 0, capacity);
+    size_t at = 0;
+    int stored = 0;
+    for (int i = 0; i < a->fileCount; i++) {
+        AFILE* file = &a->files[i];
+        char path[MAX_PATH], name[MAX_PATH * 2];
+        sprintf_s(path, "%s/%s", slideDir, file->name);
+        std::streamsize length;
+        char* data = readFile(path, &length);
+        if (data == NULL) continue;
+        file->size = length - 1;
+        total += file->size;
+        jsonEscape(file->name, name, sizeof(name));
+        at += sprintf_s(lines + at, capacity - at, ",\n{\"file\":\"%s\",\"size\":%lld,\"chunks\":\"", name, file->size);
+        for (LONG64 offset = 0; offset < file->size; offset += ASSET_CHUNK) {
+            size_t bytes = (size_t)(file->size - offset < ASSET_CHUNK ? file->size - offset : ASSET_CHUNK);
+            char hash[65], chunkPath[MAX_PATH];
+            sha256(data + offset, bytes, hash);
+            assetChunkPath(chunkPath, sizeof(chunkPath), hash);
+            if (!assetExists(chunkPath)) {
+                if (assetWrite(chunkPath, data + offset, bytes)) errorCallback(-1, "Unable to store slide chunk!");
+                else stored++;
+            }
+            at += sprintf_s(lines + at, capacity - at, "%s%s", offset > 0 ? " " : "", hash);
+        }
+        at += sprintf_s(lines + at, capacity - at, "\"}");
+        HeapFree(GetProcessHeap(), 0, data);
+    }
+    sha256(lines, at, a->current);
+    char* manifest = (char*)HeapAlloc(GetProcessHeap(), 0, capacity + 256);
+    int length = sprintf_s(manifest, capacity + 256, "[\n{\"set\":\"%s\",\"chunk\":%d,\"files\":%d,\"bytes\":%lld}%s\n]\n",
+        a->current, ASSET_CHUNK, a->fileCount, total, lines);
+    int failed = assetWrite(ASSET_MANIFEST, manifest, length);
+    HeapFree(GetProcessHeap(), 0, manifest);
+    HeapFree(GetProcessHeap(), 0, lines);
+    if (failed) {
+        errorCallback(-1, "Unable to write the slide manifest!");
+        return -1;
+    }
+    metrics.assetSyncMs = (float)(shmNow() - started) / 1000.0f;
+    std::cout << "Slides published: set " << std::string(a->current, 12) << ", " << a->fileCount << " files, "
+        << stored << " new chunks in " << metrics.assetSyncMs << " ms" << std::endl;
+    return 0;
+}
+
+DWORD WINAPI AssetPublisher(LPVOID lpParam) {
+    ASSETDATA* a = (ASSETDATA*)lpParam;
+    while (a->running) {
+        unsigned int signature = 2166136261u;
+        a->fileCount = 0;
+        assetList(a, "", &signature);
+        InterlockedIncrement(&metrics.assetChecks);
+        if (signature != a->signature && assetPublish(a) == 0) a->signature = signature;
+        for (int waited = 0; waited < ASSET_POLL && a->running; waited += 100) Sleep(100);
+    }
+    return 0;
+}
+
+DWORD WINAPI AssetFetcher(LPVOID lpParam) {
+    ASSETDATA* a = (ASSETDATA*)lpParam;
+    for (LONG n = InterlockedIncrement(&a->next) - 1; n < a->missingCount; n = InterlockedIncrement(&a->next) - 1) {
+        const char* hash = a->hashes[a->missing[n]];
+        char url[512], path[MAX_PATH], check[65];
+        assetChunkPath(path, sizeof(path), hash);
+        //The same chunk can appear in more than one file
+        if (assetExists(path)) continue;
+        sprintf_s(url, "%s%s.bin", a->base, hash);
+        size_t size = 0;
+        char* data = fetchUrl(url, &size);
+        if (data != NULL) sha256(data, size, check);
+        if (data == NULL || strcmp(check, hash) != 0 || assetWrite(path, data, size)) InterlockedIncrement(&metrics.assetFailed);
+        else {
+            InterlockedIncrement(&metrics.assetChunks);
+            InterlockedExchangeAdd64(&metrics.assetBytes, (LONG64)size);
+        }
+        if (data != NULL) HeapFree(GetProcessHeap(), 0, data);
+    }
+    return 0;
+}
+
+//Reads the file list out of a manifest. Names and hashes both end up in paths, so a name
+//that would leave the slide folder is refused and a chunk list stops at anything but hex
+int assetParse(ASSETDATA* a, const char* json, const char* end) {
+    char* field = (char*)HeapAlloc(GetProcessHeap(), 0, end - json + 1);
+    int hashCount = 0;
+    a->fileCount = 0;
+    const char* object;
+    for (const char* p = json; (p = jsonObject(p, end, &object)) != NULL && a->fileCount < ASSET_FILES; p++) {
+        AFILE* file = &a->files[a->fileCount];
+        if (!jsonField(object, p, "file", file->name, sizeof(file->name))) continue;
+        if (file->name[0] == '/' || file->name[0] == '\\' || strstr(file->name, "..") != NULL || strchr(file->name, ':') != NULL) {
+            errorCallback(-1, "Slide manifest names a file outside the slide folder!");
+            HeapFree(GetProcessHeap(), 0, field);
+            return -1;
+        }
+        jsonField(object, p, "size", field, 32);
+        file->size = atoll(field);
+        jsonField(object, p, "chunks", field, (int)(end - json + 1));
+        file->first = hashCount;
+        file->chunks = 0;
+        for (char* word = field; *word != '\0'; ) {
+            while (*word == ' ') word++;
+            if (strspn(word, "0123456789abcdef") < 64) break;
+            memcpy(a->hashes[hashCount], word, 64);
+            a->hashes[hashCount][64] = '\0';
+            hashCount++;
+            file->chunks++;
+            word += 64;
+        }
+        a->fileCount++;
+    }
+    HeapFree(GetProcessHeap(), 0, field);
+    return hashCount;
+}
+
+//Joins the chunks into a fresh folder and renames it into place once every file is whole
+int assetStage(ASSETDATA* a, char* staged, size_t size) {
+    sprintf_s(staged, size, "%s%.12s", ASSET_STAGE, a->current);
+    if (assetExists(staged)) return 0;
+    char building[MAX_PATH], path[MAX_PATH], chunkPath[MAX_PATH];
+    sprintf_s(building, "%s.part", staged);
+    CreateDirectoryA(building, NULL);
+    for (int i = 0; i < a->fileCount; i++) {
+        AFILE* file = &a->files[i];
+        //Every folder on the way down, not just the first
+        for (char* folder = strchr(file->name, '/'); folder != NULL; folder = strchr(folder + 1, '/')) {
+            sprintf_s(path, "%s/%.*s", building, (int)(folder - file->name), file->name);
+            CreateDirectoryA(path, NULL);
+        }
+        sprintf_s(path, "%s/%s", building, file->name);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        LONG64 written = 0;
+        for (int c = 0; c < file->chunks && out.is_open(); c++) {
+            assetChunkPath(chunkPath, sizeof(chunkPath), a->hashes[file->first + c]);
+            std::streamsize length;
+            char* data = readFile(chunkPath, &length);
+            if (data == NULL) break;
+            out.write(data, length - 1);
+            written += length - 1;
+            HeapFree(GetProcessHeap(), 0, data);
+        }
+        out.close();
+        if (written != file->size || out.fail()) {
+            errorCallback(-1, "Unable to assemble a synced slide!");
+            return -1;
+        }
+    }
+    if (!MoveFileExA(building, staged, 0)) return -1;
+    return 0;
+}
+
+//Follower: one manifest request, and only when the set changed any chunk traffic
+int assetCheck(ASSETDATA* a) {
+    char url[512], set[65] = "";
+    sprintf_s(url, "%smanifest.json", a->base);
+    size_t size = 0;
+    char* json = fetchUrl(url, &size);
+    if (json == NULL) return -1;
+    InterlockedIncrement(&metrics.assetChecks);
+    const char* end = json + size;
+    const char* object;
+    const char* close = jsonObject(json, end, &object);
+    if (close != NULL) jsonField(object, close, "set", set, sizeof(set));
+    if (strlen(set) != 64 || strcmp(set, a->current) == 0) {
+        HeapFree(GetProcessHeap(), 0, json);
+        return 0;
+    }
+
+    LONG64 started = shmNow();
+    LONG failedBefore = metrics.assetFailed, fetchedBefore = metrics.assetChunks;
+    a->hashes = (char(*)[65])HeapAlloc(GetProcessHeap(), 0, (size / 64 + 1) * 65);
+    a->missing = (int*)HeapAlloc(GetProcessHeap(), 0, (size / 64 + 1) * sizeof(int));
+    int hashCount = assetParse(a, json, end);
+    HeapFree(GetProcessHeap(), 0, json);
+    a->missingCount = 0;
+    char path[MAX_PATH];
+    for (int i = 0; i < hashCount; i++) {
+        assetChunkPath(path, sizeof(path), a->hashes[i]);
+        if (!assetExists(path)) a->missing[a->missingCount++] = i;
+    }
+    a->next = 0;
+    HANDLE workers[ASSET_WORKERS] = {};
+    int workerCount = a->missingCount < ASSET_WORKERS ? a->missingCount : ASSET_WORKERS;
+    for (int w = 0; w < workerCount; w++) {
+        DWORD fetcherID;
+        workers[w] = CreateThread(NULL, 0, AssetFetcher, a, 0, &fetcherID);
+    }
+    for (int w = 0; w < workerCount; w++) {
+        WaitForSingleObject(workers[w], INFINITE);
+        CloseHandle(workers[w]);
     }
-    glfwMakeContextCurrent(window);
-    std::cout << "GLFW: Window Created" << std::endl;
-    glfwSetFramebufferSizeCallback(window, resizeCanvas);
 
-    GLFWimage icon;
-    icon.pixels = stbi_load("./img/icon.png", &icon.width, &icon.height, 0, STBI_rgb_alpha);
-    if (icon.pixels == NULL) {
-        errorCallback(-1, stbi_failure_reason());
+    //A set with a bad chunk is not staged; the next poll fetches only what is still missing
+    char staged[MAX_PATH];
+    int result = hashCount < 0 || metrics.assetFailed != failedBefore ? -1 : 0;
+    if (result == 0) {
+        sprintf_s(a->current, "%s", set);
+        result = assetStage(a, staged, sizeof(staged));
     }
-    glfwSetWindowIcon(window, 1, &icon);
-    stbi_image_free(icon.pixels);
-    std::cout << "Image loaded!" << std::endl;
+    if (result == 0) {
+        for (int i = 0; i < a->fileCount; i++) {
+            const char* extension = strrchr(a->files[i].name, '.');
+            if (strchr(a->files[i].name, '/') != NULL || extension == NULL) continue;
+            sprintf_s(path, "%s/%s", staged, a->files[i].name);
+            if (streq((char*)extension, ".png", 0, 5)) releaseImage(cacheImage(path, 0));
+            else if (streq((char*)extension, ".gif", 0, 5)) releaseImage(cacheImage(path, 1));
+        }
+        char* node = (char*)HeapAlloc(GetProcessHeap(), 0, MAX_PATH);
+        sprintf_s(node, MAX_PATH, "%s", staged);
+        InterlockedExchangePointer((PVOID volatile*)&assetStaged, node);
+        metrics.assetSyncMs = (float)(shmNow() - started) / 1000.0f;
+        std::cout << "Slides synced: set " << std::string(set, 12) << ", " << metrics.assetChunks - fetchedBefore << " of "
+            << hashCount << " chunks fetched in " << metrics.assetSyncMs << " ms, showing from the next slide" << std::endl;
+    }else {
+        a->current[0] = '\0';
+        errorCallback(-1, "Slide sync incomplete, retrying on the next poll.");
+    }
+    HeapFree(GetProcessHeap(), 0, a->hashes);
+    HeapFree(GetProcessHeap(), 0, a->missing);
+    a->hashes = NULL;
+    a->missing = NULL;
+    return result;
+}
 
-    gladLoadGL();
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+DWORD WINAPI AssetFollower(LPVOID lpParam) {
+    ASSETDATA* a = (ASSETDATA*)lpParam;
+    while (a->running) {
+        assetCheck(a);
+        for (int waited = 0; waited < ASSET_POLL && a->running; waited += 100) Sleep(100);
+    }
+    return 0;
+}
+
+//[source] is "publish", a master's host name or address, or the URL of its asset folder
+int openAssets(ASSETDATA* a, const char* source) {
+    if (!BCRYPT_SUCCESS(BCryptOpenAlgorithmProvider(&sha256Provider, BCRYPT_SHA256_ALGORITHM, NULL, 0))) {
+        errorCallback(-1, "Unable to open the SHA-256 provider!");
         return -1;
     }
+    CreateDirectoryA(ASSET_DIR, NULL);
+    a->publish = streq((char*)source, "PUBLISH", 0, 8);
+    if (!a->publish) {
+        if (isUrl(source)) sprintf_s(a->base, "%s%s", source, source[strlen(source) - 1] == '/' ? "" : "/");
+        else sprintf_s(a->base, "http://%s/assets/", source);
+    }
+    a->running = 1;
+    DWORD assetID;
+    a->thread = CreateThread(NULL, 0, a->publish ? AssetPublisher : AssetFollower, a, 0, &assetID);
+    if (a->thread == NULL) {
+        a->running = 0;
+        BCryptCloseAlgorithmProvider(sha256Provider, 0);
+        sha256Provider = NULL;
+        return -1;
+    }
+    if (a->publish) std::cout << "Publishing slides from " << slideDir << " at /assets/manifest.json" << std::endl;
+    else std::cout << "Syncing slides from " << a->base << std::endl;
+    return 0;
+}
 
-    std::cout << "Confiruging GL Viewport..." << std::endl;
-    resizeCanvas(window, 1920, 1080);
+void closeAssets(ASSETDATA* a) {
+    a->running = 0;
+    if (a->thread == NULL) return;
+    WaitForSingleObject(a->thread, INFINITE);
+    CloseHandle(a->thread);
+    a->thread = NULL;
+    BCryptCloseAlgorithmProvider(sha256Provider, 0);
+    sha256Provider = NULL;
+}
 
-    unsigned int BGprogram = initShader("shader\\bgmain.vs", "shader\\light.fs");
+/*Show journal writer (the format is with the replay, above). Render threads
+* append records to one of two buffers under journalLock; JournalWriter swaps
+* them every JOURNAL_FLUSH ms and writes the full one out, so a frame never
+* waits on the disk. If the disk falls a whole buffer behind, records are
+* dropped and counted rather than stalling the show. CLI and HTTP changes are
+* tagged by the main thread through instance->journalSource; that tag is best
+* effort, the state in the journal is not.
+*/
+typedef struct journalWriter {
+    HANDLE file;
+    char* buffers[2];
+    int active;
+    size_t used;
+    LONG64 clock;
+    HANDLE thread;
+    volatile int running;
+} JOURNAL;
 
-    unsigned int bloom = initShader("shader\\flat.vs", "shader\\bloom.fs");
+//A stage's state as of its last records
+typedef struct journalStage {
+    char data[256];
+    int theme;
+    ANIMATION anim;
+    SCENE scene;
+} JSTAGE;
 
-    unsigned int assembly = initShader("shader\\flat.vs", "shader\\assembly.fs");
+JOURNAL showJournal = {};
+SRWLOCK journalLock = SRWLOCK_INIT;
 
-    unsigned int fullbanner = initShader("shader\\flat.vs", "shader\\flat.fs");
+void journalWrite(JOURNAL* j, int kind, int source, int stage, unsigned int frame, const void* payload, int length) {
+    JRECORD record = { (unsigned char)(kind | source << 4), (unsigned char)stage, (unsigned short)length, frame };
+    AcquireSRWLockExclusive(&journalLock);
+    int fits = j->file != NULL && j->used + sizeof(record) + length <= JOURNAL_BUFFER;
+    if (fits) {
+        memcpy(j->buffers[j->active] + j->used, &record, sizeof(record));
+        memcpy(j->buffers[j->active] + j->used + sizeof(record), payload, length);
+        j->used += sizeof(record) + length;
+    }
+    ReleaseSRWLockExclusive(&journalLock);
+    InterlockedIncrement(fits ? &metrics.journalRecords : &metrics.journalDropped);
+}
 
-    unsigned int textprog = initShader("shader\\text.vs", "shader\\text.fs");
+void journalFlush(JOURNAL* j) {
+    AcquireSRWLockExclusive(&journalLock);
+    char* full = j->buffers[j->active];
+    size_t used = j->used;
+    j->active ^= 1;
+    j->used = 0;
+    ReleaseSRWLockExclusive(&journalLock);
+    DWORD written = 0;
+    if (used > 0 && !WriteFile(j->file, full, (DWORD)used, &written, NULL)) errorCallback(-1, "Unable to write the show journal!");
+    InterlockedExchangeAdd64(&metrics.journalBytes, written);
+}
 
-    unsigned int dots = initShader("shader\\dot.vs", "shader\\flat.fs");
+DWORD WINAPI JournalWriter(LPVOID lpParam) {
+    JOURNAL* j = (JOURNAL*)lpParam;
+    while (j->running) {
+        Sleep(JOURNAL_FLUSH);
+        journalFlush(j);
+    }
+    return 0;
+}
 
-    std::cout << "Shaders Compiled!" << std::endl;
+int openJournal(JOURNAL* j, const char* path) {
+    HANDLE file = CreateFileA(path, GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        errorCallback(-1, "Unable to create the show journal!");
+        return -1;
+    }
+    JHEADER header = {};
+    memcpy(header.magic, "NNBJ", 4);
+    header.version = JOURNAL_VERSION;
+    header.clock = (LONG64)std::time(0);
+    DWORD written;
+    WriteFile(file, &header, sizeof(header), &written, NULL);
+    j->clock = header.clock;
+    for (int i = 0; i < 2; i++) j->buffers[i] = (char*)HeapAlloc(GetProcessHeap(), 0, JOURNAL_BUFFER);
+    j->file = file;
+    j->running = 1;
+    DWORD writerID;
+    j->thread = CreateThread(NULL, 0, JournalWriter, j, 0, &writerID);
+    std::cout << "Recording the show to " << path << std::endl;
+    return 0;
+}
 
-    float vertices[] = {
-        //POSITIONAL VERTICES       TEXTURE COORDS
-        -1.0f,  -1.0f,  -1.0f,      0.0f,   1.0f,   //0
-        -1.0f,  1.0f,   -1.0f,      0.0f,   0.0f,   //1
-        1.0f,   1.0f,   -1.0f,      1.0f,   0.0f,   //2
-        1.0f,   -1.0f,  -1.0f,      1.0f,   1.0f    //3
-    };
-    unsigned int indices[] = {
-        1, 0, 2,
-        3, 2, 0
-    };
-    unsigned int VBO;
-    glGenBuffers(1, &VBO);
-    unsigned int VAO;
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-    unsigned int EBO;
-    glGenBuffers(1, &EBO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+//Writes out what is left; records arriving after this are dropped
+void closeJournal(JOURNAL* j) {
+    j->running = 0;
+    if (j->thread != NULL) {
+        WaitForSingleObject(j->thread, INFINITE);
+        CloseHandle(j->thread);
+        j->thread = NULL;
+    }
+    journalFlush(j);
+    AcquireSRWLockExclusive(&journalLock);
+    CloseHandle(j->file);
+    j->file = NULL;
+    ReleaseSRWLockExclusive(&journalLock);
+}
 
-    float slY1 = 0.7657407407f;
-    float overlayVertices[] = {
-        //POSITIONAL VERTICES       TEXTURE COORDS
-        -1.0f,  -1.0f,  1.0f,       0.0f,   0.0f,   //0
-        -1.0f,  1.0f,   1.0f,       0.0f,   1.0f,   //1
-        1.0f,   1.0f,   1.0f,       1.0f,   1.0f,   //2
-        1.0f,   -1.0f,  1.0f,       1.0f,   0.0f,   //3
-    };
-    float slideVertices[] = {
-        -1.0f,  -slY1,  0.0f,       0.0f,   0.0f,   //0
-        -1.0f,  slY1,   0.0f,       0.0f,   1.0f,   //1
-        1.0f,   slY1,   0.0f,       1.0f,   1.0f,   //2
-        1.0f,   -slY1,  0.0f,       1.0f,   0.0f    //3
-    };
-    float dotVertices[] = {
-        0.0f,  -1.0f,  0.0f,      0.0f,   0.0f,   //0
-        0.0f,  1.0f,   0.0f,      0.0f,   1.0f,   //1
-        2.0f,   1.0f,   0.0f,     1.0f,   1.0f,   //2
-        2.0f,   -1.0f,  0.0f,     1.0f,   0.0f,   //3
-    };
-    unsigned int oVBO;
-    glGenBuffers(1, &oVBO);
-    unsigned int oVAO;
-    glGenVertexArrays(1, &oVAO);
-    glBindVertexArray(oVAO);
-    
-    glBindBuffer(GL_ARRAY_BUFFER, oVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(overlayVertices), overlayVertices, GL_STATIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+void journalSnapshot(JSTAGE* js, INSTANCE* instance, ANIMATION* anim, SCENE* scene, int width, int height, unsigned int slideCount) {
+    JSNAPSHOT snapshot = {};
+    memcpy(snapshot.data, instance->glData->data, sizeof(snapshot.data));
+    snapshot.width = width;
+    snapshot.height = height;
+    snapshot.slideCount = slideCount;
+    snapshot.theme = instance->themeRequest;
+    snapshot.anim = *anim;
+    snapshot.scene = *scene;
+    memcpy(js->data, snapshot.data, sizeof(js->data));
+    js->theme = snapshot.theme;
+    journalWrite(&showJournal, J_SNAPSHOT, 0, instance->index, anim->frameCount, &snapshot, sizeof(snapshot));
+}
 
-    unsigned int sVBO;
-    glGenBuffers(1, &sVBO);
-    unsigned int sVAO;
-    glGenVertexArrays(1, &sVAO);
-    glBindVertexArray(sVAO);
+//Records the span of thread data that changed since the last call, and the theme
+void journalData(JSTAGE* js, INSTANCE* instance, unsigned int frame, int source) {
+    char data[256];
+    memcpy(data, instance->glData->data, sizeof(data));
+    int first = 0, last = sizeof(data) - 1, theme = instance->themeRequest;
+    while (first <= last && data[first] == js->data[first]) first++;
+    while (last >= first && data[last] == js->data[last]) last--;
+    if (first > last && theme == js->theme) return;
+    LONG tagged = InterlockedExchange(&instance->journalSource, 0);
+    if (tagged != 0) source = tagged;
+    if (first <= last) {
+        char payload[257];
+        payload[0] = (char)first;
+        memcpy(payload + 1, data + first, last - first + 1);
+        memcpy(js->data + first, data + first, last - first + 1);
+        journalWrite(&showJournal, J_DATA, source, instance->index, frame, payload, last - first + 2);
+    }
+    if (theme != js->theme) {
+        js->theme = theme;
+        journalWrite(&showJournal, J_THEME, source, instance->index, frame, &theme, sizeof(theme));
+    }
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, sVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(slideVertices), slideVertices, GL_STATIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+//Copied rather than assigned so the padding compares equal too
+void journalMark(JSTAGE* js, ANIMATION* anim, SCENE* scene) {
+    memcpy(&js->anim, anim, sizeof(ANIMATION));
+    memcpy(&js->scene, scene, sizeof(SCENE));
+}
 
-    unsigned int tVBO;
-    glGenBuffers(1, &tVBO);
-    unsigned int tVAO;
-    glGenVertexArrays(1, &tVAO);
-    glBindVertexArray(tVAO);
+//After the controls have run, against what journalMark took before them
+void journalControls(JSTAGE* js, INSTANCE* instance, ANIMATION* anim, SCENE* scene) {
+    journalData(js, instance, anim->frameCount, J_CONTROL);
+    if (memcmp(&js->anim, anim, sizeof(ANIMATION)) != 0) journalWrite(&showJournal, J_ANIM, J_CONTROL, instance->index, anim->frameCount, anim, sizeof(ANIMATION));
+    if (memcmp(&js->scene, scene, sizeof(SCENE)) != 0) journalWrite(&showJournal, J_SCENE, J_CONTROL, instance->index, anim->frameCount, scene, sizeof(SCENE));
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, tVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float)*6*4, NULL, GL_DYNAMIC_DRAW);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2*sizeof(float)));
-    glEnableVertexAttribArray(1);
+void swPresent(void* data, GLFWwindow* window) {
+    SWDATA* sw = (SWDATA*)data;
+    BITMAPINFO bmi = {};
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = sw->width;
+    bmi.bmiHeader.biHeight = sw->height; //Bottom up, same row order as GL
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+    HWND hwnd = glfwGetWin32Window(window);
+    RECT rect;
+    GetClientRect(hwnd, &rect);
+    HDC dc = GetDC(hwnd);
+    SetStretchBltMode(dc, COLORONCOLOR);
+    StretchDIBits(dc, 0, 0, rect.right - rect.left, rect.bottom - rect.top, 0, 0, sw->width, sw->height, sw->pixels, &bmi, DIB_RGB_COLORS, SRCCOPY);
+    ReleaseDC(hwnd, dc);
+}
 
-    unsigned int dVBO;
-    glGenBuffers(1, &dVBO);
-    unsigned int dVAO;
-    glGenVertexArrays(1, &dVAO);
-    glBindVertexArray(dVAO);
+GLFWwindow* openBanner(INSTANCE* instance, GLFWmonitor* monitor, int backend) {
+    AcquireSRWLockExclusive(&glfwLock);
+    const GLFWvidmode* mode = glfwGetVideoMode(monitor);
+    if (backend == R_OPENGL && shareRoot == NULL) {
+        //Never shown or drawn to; it only anchors the share group so any instance can come and go
+        glfwDefaultWindowHints();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_CONTEXT_ROBUSTNESS, GLFW_LOSE_CONTEXT_ON_RESET);
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, glDebug ? GLFW_TRUE : GLFW_FALSE);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        shareRoot = glfwCreateWindow(1, 1, "", NULL, NULL);
+    }
+    glfwDefaultWindowHints();
+    if (backend == R_OPENGL) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        //Lets a driver reset (TDR) surface through glGetGraphicsResetStatus instead of killing the show
+        glfwWindowHint(GLFW_CONTEXT_ROBUSTNESS, GLFW_LOSE_CONTEXT_ON_RESET);
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, glDebug ? GLFW_TRUE : GLFW_FALSE);
+    }else glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    glfwWindowHint(GLFW_RED_BITS, mode->redBits);
+    glfwWindowHint(GLFW_GREEN_BITS, mode->greenBits);
+    glfwWindowHint(GLFW_BLUE_BITS, mode->blueBits);
+    glfwWindowHint(GLFW_REFRESH_RATE, mode->refreshRate);
+    glfwWindowHint(GLFW_AUTO_ICONIFY, GLFW_FALSE);
+    GLFWwindow* share = backend == R_OPENGL ? shareRoot : NULL;
+    GLFWwindow* window;
+    if (exportDir != NULL) glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    if (exportDir != NULL) window = glfwCreateWindow(instance->width, instance->height, "Nashville Nights Band Digital Banner", NULL, share);
+    else window = glfwCreateWindow(mode->width, mode->height, "Nashville Nights Band Digital Banner", monitor, share);
+    ReleaseSRWLockExclusive(&glfwLock);
+    if (!window) return NULL;
+    glfwSetWindowUserPointer(window, instance);
+    if (backend == R_OPENGL) glfwMakeContextCurrent(window);
+    std::cout << "GLFW: Window Created" << std::endl;
+    if (backend == R_OPENGL) glfwSetFramebufferSizeCallback(window, resizeCanvas);
 
-    glBindBuffer(GL_ARRAY_BUFFER, dVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(dotVertices), dotVertices, GL_STATIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+    CIMAGE* iconImage = cacheImage("./img/icon.png", 0);
+    if (iconImage == NULL) {
+        errorCallback(-1, stbi_failure_reason());
+    }else {
+        GLFWimage icon = { iconImage->width, iconImage->height, iconImage->pixels };
+        glfwSetWindowIcon(window, 1, &icon);
+        releaseImage(iconImage);
+    }
+    std::cout << "Image loaded!" << std::endl;
+    return window;
+}
 
-    std::cout << "Generating Textures..." << std::endl;
-    struct texture texture = generateTexture("./img/nnb.png", GL_TEXTURE0);
-    struct texture normal = generateTexture("./img/normal.png", GL_TEXTURE0);
-    struct texture specular = generateTexture("./img/alpha.png", GL_TEXTURE0);
+void closeBanner(GLFWwindow* window) {
+    AcquireSRWLockExclusive(&glfwLock);
+    glfwDestroyWindow(window);
+    ReleaseSRWLockExclusive(&glfwLock);
+}
 
-    unsigned int FBO[3];
-    unsigned int cbuffers[4];
-    glGenFramebuffers(1, FBO);
-    glGenFramebuffers(2, FBO + 1);
-    glGenTextures(4, cbuffers);
-    for (int i = 0; i < 2; i++) {
-        glBindFramebuffer(GL_FRAMEBUFFER, FBO[0]);
-        glBindTexture(GL_TEXTURE_2D, cbuffers[i]);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGBA, GL_FLOAT, NULL);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, cbuffers[i], 0);
+DWORD WINAPI GLmain (LPVOID lpParam) {
+    INSTANCE* instance = (INSTANCE*) lpParam;
+    TDATA* threadData = instance->glData;
+    std::cout << "GL thread initialized" << std::endl;
+    threadData->status = T_LOADING;
+    char* FLAGS = threadData->data +  D_FLAGS;
+    /*Map of thread data:
+    * 0 [ COLOR1 ][ COLOR2 ][ COLOR3 ][000PMBAS]
+    * 4 [            SHOWTIME (int)            ]
+    * 8 [ VENUE N][AME GOES][HERE ...][  etc...]
+    */
 
-        glBindFramebuffer(GL_FRAMEBUFFER, FBO[i + 1]);
-        glBindTexture(GL_TEXTURE_2D, cbuffers[i + 2]);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGBA, GL_FLOAT, NULL);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, cbuffers[i + 2], 0);
+    AcquireSRWLockExclusive(&glfwLock);
+    glfwSetErrorCallback(errorCallback);
+    int glfwReady = glfwInit();
+    ReleaseSRWLockExclusive(&glfwLock);
+    if (!glfwReady) {
+        threadData->status = T_ERROR;
+        return glfwGetError(NULL);
     }
-    glBindFramebuffer(GL_FRAMEBUFFER, FBO[0]);
-    unsigned int attachments[2] = { GL_COLOR_ATTACHMENT0,GL_COLOR_ATTACHMENT1 };
-    glDrawBuffers(2, attachments);
-
-    GLint uPM = glGetUniformLocation(BGprogram, "uPM");
-    GLint uRL = glGetUniformLocation(BGprogram, "uRL");
-    GLint uGL = glGetUniformLocation(BGprogram, "uGL");
-    GLint uBL = glGetUniformLocation(BGprogram, "uBL");
-    GLint uWL = glGetUniformLocation(BGprogram, "uWL");
-    GLint uTS = glGetUniformLocation(BGprogram, "diff");
-    GLint uNS = glGetUniformLocation(BGprogram, "norm");
-    GLint uSS = glGetUniformLocation(BGprogram, "smap");
-    GLint uRC = glGetUniformLocation(BGprogram, "red");
-    GLint uGC = glGetUniformLocation(BGprogram, "green");
-    GLint uBC = glGetUniformLocation(BGprogram, "blue");
+    std::cout << "GLFW: Initialized" << std::endl;
+    int backend = rendererType;
 
-    GLint bBB = glGetUniformLocation(bloom, "bb");
-    GLint bH = glGetUniformLocation(bloom, "horizontal");
-    GLint bW = glGetUniformLocation(bloom, "weight");
+    GLRES glres = {};
+    glres.themes.request = &instance->themeRequest;
+    glres.plugins.stage = instance->index;
+    VKDATA vkdata = {};
+    vkdata.themeRequest = &instance->themeRequest;
+    SWDATA swdata = {};
+    swdata.themeRequest = &instance->themeRequest;
+    RENDERER renderer = { "OpenGL", &glres, glInit, glDrawFrame, glPresent };
+    if (backend == R_VULKAN) {
+        if (glfwVulkanSupported()) renderer = { "Vulkan", &vkdata, vkInit, vkDrawFrame, vkPresent };
+        else {
+            errorCallback(-1, "Vulkan is not available, falling back to OpenGL.");
+            backend = R_OPENGL;
+        }
+    }
+    if (backend == R_SOFTWARE) renderer = { "Software", &swdata, swInit, swDrawFrame, swPresent };
+    if (exportDir != NULL) {
+        //Export reads back through PBOs, so it is GL only and never opens the preview
+        backend = R_OPENGL;
+        renderer = { "OpenGL", &glres, glInit, glDrawFrame, glPresent };
+        writeFlags(FLAGS, F_PREVIEW, 0);
+    }
 
-    GLint cE = glGetUniformLocation(assembly, "exposure");
-    GLint cF = glGetUniformLocation(assembly, "frag");
-    GLint cB = glGetUniformLocation(assembly, "bloom");
-    GLint cX = glGetUniformLocation(assembly, "xOffs");
+    //Each stage goes fullscreen on its own monitor when there are enough of them
+    AcquireSRWLockExclusive(&glfwLock);
+    int monitorCount;
+    GLFWmonitor** monitors = glfwGetMonitors(&monitorCount);
+    GLFWmonitor* monitor = instance->index < monitorCount ? monitors[instance->index] : glfwGetPrimaryMonitor();
+    ReleaseSRWLockExclusive(&glfwLock);
 
-    GLint sX = glGetUniformLocation(fullbanner, "xOffs");
+    //A GPU backend that can't open or initialise drops to the software renderer
+    GLFWwindow* window = NULL;
+    instance->width = 1920;
+    instance->height = 1080;
+    while (TRUE) {
+        window = openBanner(instance, monitor, backend);
+        if (window) {
+            if (!renderer.init(renderer.data, window, instance->width, instance->height)) break;
+            if (backend == R_VULKAN) vkShutdown(&vkdata);
+            closeBanner(window);
+        }
+        if (backend == R_SOFTWARE || exportDir != NULL) {
+            threadData->status = T_ERROR;
+            return -1;
+        }
+        errorCallback(-1, "GPU renderer failed, falling back to the software renderer.");
+        backend = R_SOFTWARE;
+        renderer = { "Software", &swdata, swInit, swDrawFrame, swPresent };
+    }
+    std::cout << renderer.name << " renderer ready." << std::endl;
+    unsigned int slideCount = backend == R_OPENGL ? glres.slideCount : backend == R_VULKAN ? vkdata.slideCount : swdata.slideCount;
 
-    GLint tP = glGetUniformLocation(textprog, "proj");
-    GLint tT = glGetUniformLocation(textprog, "text");
-    GLint tC = glGetUniformLocation(textprog, "textColor");
+    SCENE scene;
+    startScene(&scene);
+    ANIMATION anim;
+    startAnimation(&anim);
 
-    GLint dO = glGetUniformLocation(dots, "offs");
-    GLint dR = glGetUniformLocation(dots, "rot");
+    PDATA preview = {};
+    preview.textprog = glres.textprog;
+    preview.tP = glres.tP;
+    preview.tC = glres.tC;
+    double lastPreview = 0.0;
+    FRAME frame = {};
 
-    std::cout << "Loading font..." << std::endl;
-    FT_Library ft;
-    if (FT_Init_FreeType(&ft)) {
-        std::cout << "Couldn't load FreeType." << std::endl;
-        ExitProcess(-1);
+    EDATA exporter = {};
+    int exportFrames = exportSeconds * exportFps;
+    std::time_t exportClock = std::time(0);
+    if (exportDir != NULL) {
+        if (openExport(&exporter, instance->width, instance->height, exportFrames)) {
+            glfwTerminate();
+            threadData->status = T_ERROR;
+            return -1;
+        }
+        glres.target = exporter.fbo;
     }
-    FT_Face face;
-    if (FT_New_Face(ft, "./fonts/Times New Roman Bold.ttf", 0, &face)) {
-        std::cout << "Couldn't load font." << std::endl;
-        ExitProcess(-1);
+    SHMDATA shm = {};
+    char shmName[64];
+    shmRingName(shmName, instance->index);
+    int shmOn = shmOutput;
+    if (shmOn && (backend != R_OPENGL || openShm(&shm, instance->width, instance->height, shmName))) {
+        errorCallback(-1, "Shared frame output needs the OpenGL renderer.");
+        shmOn = 0;
     }
-    FT_Set_Pixel_Sizes(face, 0, 92);
-
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    for (unsigned char c = 0; c < 128; c++) {
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
-            std::cout << "Failed to load '" << c << "'." << std::endl;
-            continue;
-        }
-        unsigned int tex;
-        glGenTextures(1, &tex);
-        glBindTexture(GL_TEXTURE_2D, tex);
-        FT_GlyphSlot g = face->glyph;
-        FT_Bitmap b = g->bitmap;
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, b.width, b.rows, 0, GL_RED, GL_UNSIGNED_BYTE, b.buffer);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        Glyph character;
-        character.texture = tex;
-        character.size = glm::ivec2(b.width, b.rows);
-        character.bearing = glm::ivec2(g->bitmap_left, g->bitmap_top);
-        character.advance = g->advance.x;
-        charMap.insert(std::pair<char, Glyph>(c, character));
+    //The LED map describes one wall, so only the first stage drives it
+    LEDDATA led = {};
+    int ledOn = ledMap != NULL && instance->index == 0;
+    if (ledOn && backend != R_OPENGL) {
+        //Nothing is opened, and GL may never have been loaded, so there is nothing to close
+        errorCallback(-1, "LED output needs the OpenGL renderer.");
+        ledOn = 0;
+    }else if (ledOn && openLed(&led, ledMap, instance->width, instance->height)) {
+        errorCallback(-1, "LED output needs a valid map.");
+        closeLed(&led);
+        ledOn = 0;
     }
-    FT_Done_Face(face);
-    FT_Done_FreeType(ft);
-
-    float rl[3] = { 5.0f, 1.5f, -0.1f };
-    float gl[3] = { -5.0f, 1.5f, -0.1f };
-    float bl[3] = { 0.0f, 1.5f, -0.1f };
-    float wl[3] = { 0.0f,-2.0f, -0.1f };
-    float rc[3] = { 0.0f,0.0f,0.0f };
-    float gc[3] = { 0.0f,0.0f,0.0f };
-    float bc[3] = { 0.0f,0.0f,0.0f };
-
-    unsigned int frameCount = 0;
-    double phase = 0;
-    float slideTransition = 0.0f;
-    float bannerTransition = 0.0f;
-    unsigned int slideID = 0;
-    unsigned int slides[32];
-    unsigned int slideCount = 0;
-    char* fileContents;
-    char slidePath[60] = "./http/slides/s0.png";
-    std::ifstream slideFile;
-    for (; slideCount < 32; slideCount++) {
-        sprintf_s(slidePath, "./http/slides/s%d.png",slideCount);
-        slideFile.open(slidePath);
-        if (!slideFile.is_open()) break; //No more slides
-        slideFile.close();
-        slides[slideCount] = generateTexture(slidePath, GL_TEXTURE2 + slideCount).texture;
+    //Light output needs no GL, so it stays up through recoveries and on the software renderer
+    DMXDATA dmx = {};
+    int dmxOn = dmxPatch != NULL && instance->index == 0;
+    if (dmxOn && openDmx(&dmx, dmxPatch)) {
+        closeDmx(&dmx);
+        dmxOn = 0;
     }
-    unsigned int slideOverlay = generateTexture("./img/90banner.png", GL_TEXTURE0).texture;
-    unsigned int dotMatrix = generateTexture("./img/dotmatrix.png", GL_TEXTURE1).texture;
+    DMXINPUT console = {};
+    int consoleOn = dmxInput != NULL ? openDmxInput(&console, dmxInput, instance->index) == 0 : 0;
+    if (!consoleOn) closeDmxInput(&console);
+    //Footswitches drive the first stage, like the CLI does by default
+    GAMEPAD pad = {};
+    int padOn = gamepadInput && instance->index == 0 && openGamepad(&pad, gamepadMap) == 0;
+    SYNCDATA sync = {};
+    int syncOn = syncRole != NULL && instance->index == 0 && exportDir == NULL && openSync(&sync, syncRole, syncGroup, syncPort) == 0;
+    const char* stageSlides = slideDir;
+    unsigned int lastSlide = 0;
+    JSTAGE journalStage = {};
+    int journalOn = journalPath != NULL && exportDir == NULL;
+    if (journalOn) journalSnapshot(&journalStage, instance, &anim, &scene, instance->width, instance->height, slideCount);
 
     threadData->status = T_RUNNING;
     double time_span = 0.0f;
+    int hudKey = 0;
+    std::chrono::high_resolution_clock::time_point lastFrame = std::chrono::high_resolution_clock::now();
     while (!glfwWindowShouldClose(window)) {
         std::chrono::high_resolution_clock::time_point before = std::chrono::high_resolution_clock::now();
-        GLint vp[4];
-        glGetIntegerv(GL_VIEWPORT, vp);
-        processInput(window);
-        if (readFlags(FLAGS, F_SLIDESHOW_MODE) == 0) {
-            glm::mat4 pm = glm::perspective(2.65625f, (1.0f * vp[2]) / vp[3], 0.1f, 100.0f);
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
-            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT);
-            glUseProgram(BGprogram);
-            glUniformMatrix4fv(uPM, 1, true, &pm[0][0]);
-            glUniform3fv(uRL, 1, rl);
-            glUniform3fv(uGL, 1, gl);
-            glUniform3fv(uBL, 1, bl);
-            glUniform3fv(uWL, 1, wl);
-            glUniform3fv(uRC, 1, rc);
-            glUniform3fv(uGC, 1, gc);
-            glUniform3fv(uBC, 1, bc);
-            for (int i = 0; i < 3; i++) {
-                float rt = colors[*COLOR1][i];
-                if (rc[i] > rt) rc[i] -= 0.01;
-                else if (rc[i] < rt) rc[i] += 0.01;
-                float gt = colors[*COLOR2][i];
-                if (gc[i] > gt) gc[i] -= 0.01;
-                else if (gc[i] < gt) gc[i] += 0.01;
-                float bt = colors[*COLOR3][i];
-                if (bc[i] > bt) bc[i] -= 0.01;
-                else if (bc[i] < bt) bc[i] += 0.01;
-            }
-            glUniform1i(uTS, 0);
-            glUniform1i(uNS, 1);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, texture.texture);
-            glActiveTexture(GL_TEXTURE1);
-            glBindTexture(GL_TEXTURE_2D, normal.texture);
-            glActiveTexture(GL_TEXTURE2);
-            glBindTexture(GL_TEXTURE_2D, specular.texture);
-            glBindVertexArray(VAO);
-            glBindFramebuffer(GL_FRAMEBUFFER, FBO[0]);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-            glUseProgram(bloom);
-            glUniform1i(bBB, 0);
-            glActiveTexture(GL_TEXTURE0);
-            glBindVertexArray(VAO);
-
-            glUniform1i(bH, GL_TRUE);
-            glBindFramebuffer(GL_FRAMEBUFFER, FBO[1]);
-            glClear(GL_COLOR_BUFFER_BIT);
-            glBindTexture(GL_TEXTURE_2D, cbuffers[1]);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-            glUniform1i(bH, GL_FALSE);
-            glBindFramebuffer(GL_FRAMEBUFFER, FBO[2]);
-            glClear(GL_COLOR_BUFFER_BIT);
-            glBindTexture(GL_TEXTURE_2D, cbuffers[2]);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-            for (int i = 0; i < 6; i++) {
-                glUniform1i(bH, GL_TRUE);
-                glBindFramebuffer(GL_FRAMEBUFFER, FBO[1]);
-                glClear(GL_COLOR_BUFFER_BIT);
-                glBindTexture(GL_TEXTURE_2D, cbuffers[3]);
-                glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-                glUniform1i(bH, GL_FALSE);
-                glBindFramebuffer(GL_FRAMEBUFFER, FBO[2]);
-                glClear(GL_COLOR_BUFFER_BIT);
-                glBindTexture(GL_TEXTURE_2D, cbuffers[2]);
-                glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-            }
-
-            glUseProgram(assembly);
-            glUniform1f(cX, 0.0f);
-            glUniform1f(cE, 1.0f);
-            glUniform1i(cF, 0);
-            glUniform1i(cB, 1);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, cbuffers[0]);
-            glActiveTexture(GL_TEXTURE1);
-            glBindTexture(GL_TEXTURE_2D, cbuffers[3]);
-            glBindVertexArray(VAO);
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
-            glClear(GL_COLOR_BUFFER_BIT);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-            slideTransition = 0;
+        if (backend == R_OPENGL && exportDir == NULL && glLost(&glres)) {
+            //Device reset: rebuild the context and everything in it from the asset cache
+            double started = glfwGetTime();
+            errorCallback(-1, "GL context lost, recovering...");
+            if (preview.window) closePreview(&preview);
+            if (shmOn) closeShm(&shm);
+            shm = {};
+            if (ledOn) closeLed(&led);
+            glShutdown(&glres);
+            closeBanner(window);
+            //A reset takes every context down; whichever instance notices first rebuilds the share group
+            AcquireSRWLockExclusive(&glfwLock);
+            if (glres.generation == gpuGeneration) {
+                if (shareRoot != NULL) glfwDestroyWindow(shareRoot);
+                shareRoot = NULL;
+                resetAssets();
+            }
+            ReleaseSRWLockExclusive(&glfwLock);
+            glres = {};
+            glres.themes.request = &instance->themeRequest;
+            glres.plugins.stage = instance->index;
+            window = openBanner(instance, monitor, backend);
+            if (window == NULL || glInit(&glres, window, instance->width, instance->height)) {
+                errorCallback(-1, "GL recovery failed, falling back to the software renderer.");
+                if (window != NULL) closeBanner(window);
+                backend = R_SOFTWARE;
+                renderer = { "Software", &swdata, swInit, swDrawFrame, swPresent };
+                window = openBanner(instance, monitor, backend);
+                if (window == NULL || swInit(&swdata, window, instance->width, instance->height)) break;
+                slideCount = swdata.slideCount;
+                shmOn = 0;
+                ledOn = 0;
+            }else {
+                slideCount = glres.slideCount;
+                preview.textprog = glres.textprog;
+                preview.tP = glres.tP;
+                preview.tC = glres.tC;
+                if (shmOn && openShm(&shm, instance->width, instance->height, shmName)) shmOn = 0;
+                if (ledOn && openLed(&led, ledMap, instance->width, instance->height)) {
+                    closeLed(&led);
+                    ledOn = 0;
+                }
+            }
+            if (anim.slideID >= slideCount) anim.slideID = 0;
+            metrics.recoveryMs = (float)((glfwGetTime() - started) * 1000);
+            InterlockedIncrement(&metrics.recoveries);
+            std::cout << "Recovered in " << metrics.recoveryMs << " ms." << std::endl;
+            lastFrame = std::chrono::high_resolution_clock::now();
+            continue;
+        }
+        processInput(window, FLAGS, &hudKey);
+        if (backend == R_OPENGL) {
+            GLint vp[4];
+            glGetIntegerv(GL_VIEWPORT, vp);
+            frame.width = vp[2];
+            frame.height = vp[3];
         }else {
-            glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT);
-            for (int i = 0; i < 3; i++) {
-                rc[i] = 0;
-                gc[i] = 0;
-                bc[i] = 0;
-            }
-            glUseProgram(dots);
-            glm::mat4 rotation = glm::rotate(glm::mat4(1.0), (float)PI / 3, glm::vec3(0, 0, 1));
-            for (int i = 0; i < 4; i++) rotation[i][1] = rotation[i][1] * vp[2] / vp[3];
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, dotMatrix);
-            glBindVertexArray(dVAO);
-            glUniformMatrix4fv(dR, 1, GL_FALSE, &rotation[0][0]);
-            glUniform1f(dO, (float)0x3p-13 * frameCount);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-            rotation = glm::rotate(glm::mat4(1.0), (float)PI*7 / 6, glm::vec3(0, 0, 1));
-            for (int i = 0; i < 4; i++) rotation[i][1] = rotation[i][1] * vp[2] / vp[3];
-            glUniformMatrix4fv(dR, 1, GL_FALSE, &rotation[0][0]);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-            
-            glUseProgram(fullbanner);
-            glUniform1f(sX, 0.0f);
-            glBindTexture(GL_TEXTURE_2D, slides[slideID]);
-            glBindVertexArray(sVAO);
-            glUniform1f(sX, -slideTransition);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-            glUniform1f(sX, -slideTransition + 2.0f);
-            int nextSlide = slideID + 1;
-            if (nextSlide >= slideCount) nextSlide = 0;
-            glBindTexture(GL_TEXTURE_2D, slides[nextSlide]);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-            glUniform1f(sX, 0.0f);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, slideOverlay);
-            glBindVertexArray(oVAO);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-
-            setTextColor(1.0f, 1.0f, 1.0f);
-            glm::mat4 orth = glm::ortho(0.0f, (float)vp[2], 0.0f, (float)vp[3], -1.f, 1.f);
-            glUseProgram(textprog);
-            glUniformMatrix4fv(tP, 1, GL_FALSE, &orth[0][0]);
-            glUniform3fv(tC, 1, textColor);
-            glActiveTexture(GL_TEXTURE0);
-            glBindVertexArray(tVAO);
-            char message[32] = "Current time = 11:11 PM";
-            const std::time_t now = std::time(0);
-            std::tm t;
-            localtime_s(&t, &now);
-            int hr = t.tm_hour;
-            int mn = t.tm_min;
-            char pm = 'A';
-            if (hr >= 12) {
-                hr -= 12;
-                pm = 'P';
-            }
-            if (hr == 0) hr = 12;
-            sprintf_s(message, "Current time: %d%d:%d%d %cM", hr/10, hr%10, mn/10, mn%10, pm);
-            drawText(message, 100, vp[3] - 50, 0.5f, tVBO);
-
-            hr = *SHOWTIME / 60;
-            mn = *SHOWTIME % 60;
-            if (readFlags(FLAGS, F_AUTOSTART) && hr == t.tm_hour && mn == t.tm_min) writeFlags(FLAGS, F_SLIDESHOW_MODE, 0);
-            pm = 'A';
-            if (hr >= 12) {
-                hr -= 12;
-                pm = 'P';
-            }
-            if (hr == 0) hr = 12;
-            sprintf_s(message, "Showtime: %d%d:%d%d %cM", hr / 10, hr % 10, mn / 10, mn % 10, pm);
-            drawText(message, 100, vp[3] - 105, 0.5f, tVBO);
-
-            setTextColor(0.97647f, 0.92549f, 0.35686f);
-            glUniform3fv(tC, 1, textColor);
-            drawText(VENUE_NAME, 650, vp[3] - 90, 0.7f, tVBO);
-            
-            if ((frameCount & 1023) == 0) phase = 0;
-            if (phase < PI) {
-                phase += 0.03125;
-                slideTransition = -cos(phase)+1;
-                if (phase >= PI) {
-                    phase = PI;
-                    slideTransition = 0;
-                    slideID++;
-                    if (slideID >= slideCount) slideID = 0;
+            AcquireSRWLockExclusive(&glfwLock);
+            glfwGetFramebufferSize(window, &frame.width, &frame.height);
+            ReleaseSRWLockExclusive(&glfwLock);
+        }
+        if (preview.window && (!readFlags(FLAGS, F_PREVIEW) || glfwWindowShouldClose(preview.window))) {
+            closePreview(&preview);
+            writeFlags(FLAGS, F_PREVIEW, 0);
+        }else if (!preview.window && readFlags(FLAGS, F_PREVIEW)) {
+            if (backend != R_OPENGL || !openPreview(&preview, window, frame.width, frame.height)) {
+                errorCallback(-1, "The preview window needs the OpenGL renderer.");
+                writeFlags(FLAGS, F_PREVIEW, 0);
+            }
+            glfwMakeContextCurrent(backend == R_OPENGL ? window : NULL);
+        }
+
+        if (journalOn) {
+            journalData(&journalStage, instance, anim.frameCount, J_CONTROL);
+            journalMark(&journalStage, &anim, &scene);
+        }
+        if (padOn) gamepadFrame(&pad, threadData->data, &anim, slideCount, instance);
+        if (osc.running) oscFrame(&osc.stages[instance->index], threadData->data, &scene, &anim, slideCount, instance);
+        if (consoleOn) dmxInputFrame(&console, &scene, threadData->data, instance);
+        LONG preset = InterlockedExchange(&instance->presetRequest, -1);
+        if (preset >= 0) {
+            AcquireSRWLockShared(&presetLock);
+            if (preset < presetCount) {
+                applyPreset(&presets[preset], threadData, instance, &scene);
+                instance->preset = preset;
+                std::cout << "Preset " << presets[preset].name << " recalled." << std::endl;
+            }
+            ReleaseSRWLockShared(&presetLock);
+        }
+        //Synced slides are uploaded a slide a frame, then go in as one slide leaves or straight away while the slides are hidden
+        const char* staged = assetStaged;
+        if (staged != NULL && staged != stageSlides) {
+            if (backend != R_OPENGL) {
+                stageSlides = staged;
+                errorCallback(-1, "New slides are synced; restart the banner to show them on this renderer.");
+            }else {
+                glStageSlides(&glres, staged);
+                if (glres.stagingDone && anim.slideTransition == 0 && (anim.slideID != lastSlide || !readFlags(FLAGS, F_SLIDESHOW_MODE))) {
+                    stageSlides = staged;
+                    glSwapSlides(&glres);
+                    slideCount = glres.slideCount;
+                    if (anim.slideID >= slideCount) anim.slideID = 0;
+                    InterlockedIncrement(&metrics.assetSwaps);
                 }
             }
         }
-        frameCount++;
-        rl[0] = 6 * sin(phase);
-        gl[0] = 6 * sin(phase + 2 * PI / 3);
-        bl[0] = 6 * sin(phase - 2 * PI / 3);
-        rl[1] = 1.5f + abs(cos(phase));
-        gl[1] = 1.5f + abs(cos(phase + 2 * PI / 3));
-        bl[1] = 1.5f + abs(cos(phase - 2 * PI / 3));
+        lastSlide = anim.slideID;
+
+        double dt = std::chrono::duration_cast<std::chrono::duration<double>>(before - lastFrame).count();
+        if (exportDir != NULL) dt = 1.0 / exportFps;
+        std::time_t now = exportDir != NULL ? exportClock + anim.frameCount / exportFps : std::time(0);
+        if (syncOn) syncFrame(&sync, &anim, threadData->data, slideCount, dt, time_span);
+        if (journalOn) journalControls(&journalStage, instance, &anim, &scene);
+        buildFrame(&frame, &anim, threadData->data, &scene, slideCount, dt, now);
+        if (journalOn) journalData(&journalStage, instance, anim.frameCount, J_AUTOSTART);
+        frame.hud = readFlags(FLAGS, F_HUD) != 0 && backend == R_OPENGL;
+        frame.cpuMs = (float)(time_span * 1000);
+
+        renderer.draw(renderer.data, &frame);
+        if (dmxOn) dmxFrame(&dmx, &frame);
+        if (exportDir != NULL) {
+            exportFrame(&exporter, anim.frameCount);
+            if (anim.frameCount + 1 >= exportFrames) glfwSetWindowShouldClose(window, GLFW_TRUE);
+        }
+        if (shmOn) shmFrame(&shm, glres.target);
+        if (ledOn) ledFrame(&led, glres.target, frame.width, frame.height);
 
         std::chrono::high_resolution_clock::time_point after = std::chrono::high_resolution_clock::now();
         time_span = std::chrono::duration_cast<std::chrono::duration<double>>(after - before).count();
-        double fps = 1 / time_span;
-        phase += time_span/5;
+        if (exportDir != NULL) time_span = 1.0 / exportFps;
+        if (journalOn) {
+            JFRAME timing = { (float)dt, (float)time_span, (unsigned int)(now - showJournal.clock) };
+            journalWrite(&showJournal, J_FRAME, 0, instance->index, anim.frameCount, &timing, sizeof(timing));
+        }
+        advanceAnimation(&anim, frame.slideshow, slideCount, time_span);
+
+        if (preview.window) {
+            double now = glfwGetTime();
+            if (now - lastPreview >= 1.0 / previewRate) {
+                lastPreview = now;
+                preview.frameMs = (float)(frame.dt * 1000);
+                preview.renderMs = (float)(time_span * 1000);
+                preview.slideshow = frame.slideshow;
+                blitPreview(&preview, frame.width, frame.height);
+            }
+        }
+        lastFrame = before;
 
-        glfwSwapBuffers(window);
+        if (exportDir == NULL) renderer.present(renderer.data, window);
+        if (consoleOn) dmxInputPresented(&console, (float)(frame.dt * 1000));
+        if (padOn) gamepadPresented(&pad, (float)(frame.dt * 1000));
+        AcquireSRWLockExclusive(&glfwLock);
         glfwPollEvents();
+        ReleaseSRWLockExclusive(&glfwLock);
     }
 
-    glfwTerminate();
+    if (preview.window) closePreview(&preview);
+    if (exportDir != NULL) closeExport(&exporter);
+    if (shmOn) closeShm(&shm);
+    if (ledOn) closeLed(&led);
+    if (dmxOn) closeDmx(&dmx);
+    if (consoleOn) closeDmxInput(&console);
+    if (padOn) closeGamepad(&pad);
+    if (syncOn) closeSync(&sync);
+    if (backend == R_OPENGL) glShutdown(&glres);
+    if (backend == R_VULKAN) vkShutdown(&vkdata);
+    if (backend == R_SOFTWARE && swdata.running) swShutdown(&swdata);
+    if (window != NULL) closeBanner(window);
+    //main exits the process once every instance has stopped
     threadData->status = T_STOPPED;
-    ExitProcess(0);
     return 0;
 }
 
@@ -905,7 +10769,16 @@ DWORD WINAPI CLImain(LPVOID lpParam) {
                 "ADDRESS: Display control panel URL\n"
                 "DOWNBEAT [TIME]: Change show start time (military 24-hour time HHMM)\n"
                 "VENUE [NAME]: Change the name of the venue to be displayed\n"
-                "AUTOSTART: Automatically switch slideshow off at showtime\n";
+                "AUTOSTART: Automatically switch slideshow off at showtime\n"
+                "PREVIEW [FPS]: Toggle the operator preview window, optionally setting its refresh rate\n"
+                "STATS: Display render and streaming counters\n"
+                "MEMORY: Display GPU memory by object type and owner, and any leaks\n"
+                "HUD: Toggle the on-screen performance HUD (or press F3 on the banner)\n"
+                "DEBUG: Display the most frequent GL debug messages (run with -gldebug)\n"
+                "THEME [NAME]: Crossfade the banner to another theme, or list the themes\n"
+                "STAGE [N]: Direct the following commands to another stage's banner\n"
+                "PRESET [NAME]: Recall a scene preset, or list the presets\n"
+                "PRESET SAVE [NAME]: Save the current look as a preset\n";
         }else if(streq(command, "AUTOSTART", 0, 10)){
             threadData->data[0] = 'a';
             threadData->status = T_WAITING;
@@ -913,6 +10786,138 @@ DWORD WINAPI CLImain(LPVOID lpParam) {
             std::cout << "Autostart is now ";
             if (threadData->data[1]) std::cout << "ENABLED." << std::endl;
             else std::cout << "DISABLED." << std::endl;
+        }else if(streq(command, "STATS", 0, 6)){
+            std::cout << "Animated slides: " << metrics.clipFrames << " frames shown, "
+                << metrics.clipDropped << " dropped, " << metrics.clipLate << " late" << std::endl;
+            std::cout << "Upload bandwidth: " << metrics.uploadMBps << " MB/s, latency " << metrics.uploadLatencyMs << " ms" << std::endl;
+            std::cout << "Device resets: " << metrics.recoveries << ", last recovery " << metrics.recoveryMs << " ms" << std::endl;
+            std::cout << "Social wall: " << metrics.wallPosts << " cards baked, last in " << metrics.wallBakeMs << " ms" << std::endl;
+            std::cout << "GPU leaks: " << metrics.gpuLeaks << " objects (see MEMORY)" << std::endl;
+            if (ledMap != NULL) std::cout << "LED output: " << metrics.ledFrames << " frames in " << metrics.ledPackets << " packets, "
+                << metrics.ledDropped << " dropped, " << metrics.ledLate << " ticks late, " << metrics.ledLatencyMs << " ms from readback" << std::endl;
+            if (dmxPatch != NULL) std::cout << "DMX output: " << metrics.dmxFrames << " frames in " << metrics.dmxPackets << " packets, "
+                << metrics.dmxLate << " ticks late, " << metrics.dmxJitterMs << " ms jitter" << std::endl;
+            if (dmxInput != NULL) std::cout << "Console input: " << metrics.dmxInPackets << " packets, " << metrics.dmxInLatencyMs << " ms to the screen (max "
+                << metrics.dmxInLatencyMaxMs << "), " << metrics.dmxInLate << " over a frame" << std::endl;
+            if (oscPort > 0) std::cout << "OSC: " << metrics.oscMessages << " messages in " << metrics.oscBundles << " bundles, "
+                << metrics.oscDropped << " not understood, " << metrics.oscApplied << " changes drawn" << std::endl;
+            if (gamepadInput) std::cout << "Gamepad: " << metrics.gamepadPresses << " presses, " << metrics.gamepadLatencyMs << " ms to the screen (max "
+                << metrics.gamepadLatencyMaxMs << "), " << metrics.gamepadLate << " late" << std::endl;
+            if (syncRole != NULL) std::cout << "Sync: " << metrics.syncPackets << " states, offset " << metrics.syncOffsetMs << " ms over "
+                << metrics.syncDelayMs << " ms, last transition off by " << metrics.syncErrorMs << " ms, " << metrics.syncStale << " stale frames" << std::endl;
+            if (assetSource != NULL) std::cout << "Slide sync: " << metrics.assetChecks << " checks, " << metrics.assetChunks << " chunks ("
+                << metrics.assetBytes / 1048576.0 << " MB) fetched, " << metrics.assetFailed << " failed, " << metrics.assetSwaps
+                << " swaps, last sync " << metrics.assetSyncMs << " ms" << std::endl;
+            if (journalPath != NULL) std::cout << "Journal: " << metrics.journalRecords << " records, " << metrics.journalBytes / 1048576.0
+                << " MB written, " << metrics.journalDropped << " dropped" << std::endl;
+            if (glDebug) std::cout << "GL debug: " << metrics.glErrors << " errors, " << metrics.glPerformance << " performance warnings (see DEBUG)" << std::endl;
+            for (int i = 0; i < pluginModuleCount; i++) for (int s = 0; s < instanceCount; s++) {
+                PMODULE* m = &pluginModules[i];
+                PSTATS* stats = &m->stages[s];
+                const char* quality[] = { "skipped", "reduced", "full" };
+                std::cout << "Plugin " << m->api->name << " on stage " << s + 1 << ": " << stats->gpuMs << " ms GPU, " << stats->cpuMs << " ms CPU of "
+                    << m->api->budgetMs << " ms, " << (stats->quality == PLUGIN_FAULTED ? "faulted" : quality[stats->quality])
+                    << ", skipped " << stats->skipped << " times" << std::endl;
+            }
+        }else if(streq(command, "MEMORY", 0, 7)){
+            GTOTALS totals;
+            gpuTotals(&totals);
+            std::cout << "GPU memory: " << totals.total / 1048576.0 << " MB in " << totals.objects << " objects" << std::endl;
+            for (int k = 0; k < GPU_KINDS; k++) {
+                if (totals.count[k] > 0) std::cout << "  " << gpuKindNames[k] << ": " << totals.count[k] << ", " << totals.bytes[k] / 1048576.0 << " MB" << std::endl;
+            }
+            for (int o = 0; o < totals.owners; o++) {
+                std::cout << "  " << totals.owner[o] << ": " << totals.ownerCount[o] << " objects, " << totals.ownerBytes[o] / 1048576.0 << " MB" << std::endl;
+            }
+            if (totals.leaked > 0) std::cout << "\033[0;93m" << totals.leaked << " leaked objects holding " << totals.leakedBytes / 1048576.0 << " MB\033[0m" << std::endl;
+        }else if(streq(command, "DEBUG", 0, 6)){
+            if (!glDebug) std::cout << "GL debug output is off. Restart with -gldebug to collect messages." << std::endl;
+            else {
+                std::cout << metrics.glMessages << " GL messages, " << metrics.glErrors << " errors, " << metrics.glPerformance
+                    << " performance warnings, " << metrics.glDropped << " not logged (table full)" << std::endl;
+                //Most frequent first
+                int shown[GLDEBUG_SLOTS] = {};
+                for (int n = 0; n < 20; n++) {
+                    int best = -1;
+                    for (int i = 0; i < GLDEBUG_SLOTS; i++) {
+                        if (shown[i] || !glDebugLog[i].ready) continue;
+                        if (best < 0 || glDebugLog[i].count > glDebugLog[best].count) best = i;
+                    }
+                    if (best < 0) break;
+                    shown[best] = 1;
+                    GLDEBUGENTRY* entry = &glDebugLog[best];
+                    std::cout << entry->count << "x " << glDebugName(entry->severity) << " " << glDebugName(entry->type) << " from "
+                        << glDebugName(entry->source) << " #" << entry->id << " in " << (entry->pass >= 0 ? passNames[entry->pass] : "frame")
+                        << ": " << entry->text << std::endl;
+                }
+            }
+        }else if(streq(command, "HUD", 0, 4)){
+            threadData->data[0] = 'u';
+            threadData->status = T_WAITING;
+            while (threadData->status == T_WAITING) {}
+            std::cout << "Performance HUD is now ";
+            if (threadData->data[1]) std::cout << "ENABLED." << std::endl;
+            else std::cout << "DISABLED." << std::endl;
+        }else if(streq(command, "PREVIEW", 0, 8)){
+            std::string rate;
+            std::getline(std::cin, rate);
+            *((int*)(threadData->data + 4)) = atoi(rate.c_str());
+            threadData->data[0] = 'p';
+            threadData->status = T_WAITING;
+            while (threadData->status == T_WAITING) {}
+            std::cout << "Preview window is now ";
+            if (threadData->data[1]) std::cout << "ENABLED at " << previewRate << " fps." << std::endl;
+            else std::cout << "DISABLED." << std::endl;
+        }else if(streq(command, "STAGE", 0, 6)){
+            std::string stage;
+            std::getline(std::cin, stage);
+            int n = atoi(stage.c_str());
+            if (n >= 1 && n <= instanceCount) cliStage = n - 1;
+            else if (stage.length() > 1) std::cout << "Invalid stage. Please select 1-" << instanceCount << "." << std::endl;
+            std::cout << "Commands now control stage " << cliStage + 1 << " of " << instanceCount << "." << std::endl;
+        }else if(streq(command, "PRESET", 0, 7)){
+            std::string preset;
+            std::getline(std::cin, preset);
+            const char* name = preset.length() > 1 ? preset.c_str() + 1 : "";
+            if (_strnicmp(name, "SAVE ", 5) == 0 && name[5] != '\0') {
+                sprintf_s(threadData->data + 2, 32, "%s", name + 5);
+                threadData->data[0] = 'k';
+                threadData->status = T_WAITING;
+                while (threadData->status == T_WAITING) {}
+                if (threadData->data[1] < 0) std::cout << "No room for another preset (" << PRESET_MAX << " max)." << std::endl;
+                else std::cout << "Saved preset \"" << threadData->data + 2 << "\"." << std::endl;
+            }else if (name[0] != '\0') {
+                AcquireSRWLockShared(&presetLock);
+                int index = findPreset(name);
+                ReleaseSRWLockShared(&presetLock);
+                if (index < 0) std::cout << "Unknown preset \"" << name << "\"." << std::endl;
+                else {
+                    threadData->data[0] = 'n';
+                    threadData->data[1] = index;
+                    threadData->status = T_WAITING;
+                    while (threadData->status == T_WAITING) {}
+                    std::cout << "Recalled preset \"" << name << "\"." << std::endl;
+                }
+            }else {
+                std::cout << "Presets:" << std::endl;
+                AcquireSRWLockShared(&presetLock);
+                for (int i = 0; i < presetCount; i++) std::cout << presets[i].name << " (" << presets[i].fade << "s fade)" << std::endl;
+                ReleaseSRWLockShared(&presetLock);
+            }
+        }else if(streq(command, "THEME", 0, 6)){
+            std::string theme;
+            std::getline(std::cin, theme);
+            threadData->data[1] = -1;
+            if (theme.length() > 1) {
+                sprintf_s(threadData->data + 2, D_NAMESIZE, "%s", theme.c_str() + 1);
+                threadData->data[1] = findTheme(threadData->data + 2);
+                if (threadData->data[1] < 0) std::cout << "Unknown theme \"" << threadData->data + 2 << "\"." << std::endl;
+            }
+            threadData->data[0] = 'h';
+            threadData->status = T_WAITING;
+            while (threadData->status == T_WAITING) {}
+            std::cout << "Available themes:" << std::endl;
+            for (int i = 0; i < themeCount; i++) std::cout << themeTable[i].name << (i == threadData->data[1] ? " (current)" : "") << std::endl;
         }else if(streq(command, "VENUE", 0, 6)){
             std::string venue;
             std::getline(std::cin, venue);
@@ -951,7 +10956,7 @@ DWORD WINAPI CLImain(LPVOID lpParam) {
             std::cout << "Time updated." << std::endl;
         }else if (streq(command, "ADDRESS", 0, 8)) {
             std::wcout << "Address: http://" << hostname << std::endl;
-            std::cout << "HTTP port 80" << std::endl;
+            for (int i = 0; i < instanceCount; i++) std::cout << "Stage " << i + 1 << ": HTTP port " << 80 + i << std::endl;
             std::cout << "Ensure both your device and this device are connected to the Nashville Nights Band Wifi" << std::endl;
         }else if (streq(command, "COLORS", 0, 7)) {
             threadData->data[0] = 'r';
@@ -1009,7 +11014,47 @@ DWORD WINAPI CLImain(LPVOID lpParam) {
     return 0;
 }
 
-DWORD DoReceiveRequests(TDATA* threadData, HANDLE queue) {
+int writeMetrics(char* buffer, int size) {
+    int length = sprintf_s(buffer, size,
+        "{\"clipFrames\":%ld,\"clipDropped\":%ld,\"clipLate\":%ld,"
+        "\"uploadMBps\":%.2f,\"uploadLatencyMs\":%.2f,\"exportFps\":%.2f,"
+        "\"shmFrames\":%ld,\"shmDropped\":%ld,\"recoveries\":%ld,\"recoveryMs\":%.2f,"
+        "\"wallPosts\":%ld,\"wallBakeMs\":%.2f,\"gpuLeaks\":%ld,"
+        "\"glMessages\":%ld,\"glErrors\":%ld,\"glPerformance\":%ld,"
+        "\"ledFrames\":%ld,\"ledPackets\":%ld,\"ledDropped\":%ld,\"ledLate\":%ld,\"ledLatencyMs\":%.2f,"
+        "\"dmxFrames\":%ld,\"dmxPackets\":%ld,\"dmxLate\":%ld,\"dmxJitterMs\":%.2f,"
+        "\"dmxInPackets\":%ld,\"dmxInLate\":%ld,\"dmxInLatencyMs\":%.2f,\"dmxInLatencyMaxMs\":%.2f,"
+        "\"oscMessages\":%ld,\"oscBundles\":%ld,\"oscDropped\":%ld,\"oscApplied\":%ld,"
+        "\"gamepadPresses\":%ld,\"gamepadLate\":%ld,\"gamepadLatencyMs\":%.2f,\"gamepadLatencyMaxMs\":%.2f,"
+        "\"syncPackets\":%ld,\"syncStale\":%ld,\"syncOffsetMs\":%.3f,\"syncDelayMs\":%.3f,\"syncErrorMs\":%.3f,"
+        "\"assetChecks\":%ld,\"assetChunks\":%ld,\"assetBytes\":%lld,\"assetFailed\":%ld,\"assetSwaps\":%ld,\"assetSyncMs\":%.2f,"
+        "\"journalRecords\":%ld,\"journalBytes\":%lld,\"journalDropped\":%ld,\"plugins\":[",
+        metrics.clipFrames, metrics.clipDropped, metrics.clipLate,
+        metrics.uploadMBps, metrics.uploadLatencyMs, metrics.exportFps,
+        metrics.shmFrames, metrics.shmDropped, metrics.recoveries, metrics.recoveryMs,
+        metrics.wallPosts, metrics.wallBakeMs, metrics.gpuLeaks,
+        metrics.glMessages, metrics.glErrors, metrics.glPerformance,
+        metrics.ledFrames, metrics.ledPackets, metrics.ledDropped, metrics.ledLate, metrics.ledLatencyMs,
+        metrics.dmxFrames, metrics.dmxPackets, metrics.dmxLate, metrics.dmxJitterMs,
+        metrics.dmxInPackets, metrics.dmxInLate, metrics.dmxInLatencyMs, metrics.dmxInLatencyMaxMs,
+        metrics.oscMessages, metrics.oscBundles, metrics.oscDropped, metrics.oscApplied,
+        metrics.gamepadPresses, metrics.gamepadLate, metrics.gamepadLatencyMs, metrics.gamepadLatencyMaxMs,
+        metrics.syncPackets, metrics.syncStale, metrics.syncOffsetMs, metrics.syncDelayMs, metrics.syncErrorMs,
+        metrics.assetChecks, metrics.assetChunks, metrics.assetBytes, metrics.assetFailed, metrics.assetSwaps, metrics.assetSyncMs,
+        metrics.journalRecords, metrics.journalBytes, metrics.journalDropped);
+    for (int i = 0; i < pluginModuleCount; i++) for (int s = 0; s < instanceCount && length < size - 170; s++) {
+        PMODULE* m = &pluginModules[i];
+        PSTATS* stats = &m->stages[s];
+        char name[64];
+        jsonEscape(m->api->name, name, sizeof(name));
+        length += sprintf_s(buffer + length, size - length, "%s{\"name\":\"%s\",\"stage\":%d,\"gpuMs\":%.3f,\"cpuMs\":%.3f,\"budgetMs\":%.2f,\"quality\":%ld,\"skipped\":%ld}",
+            i + s > 0 ? "," : "", name, s, stats->gpuMs, stats->cpuMs, m->api->budgetMs, stats->quality, stats->skipped);
+    }
+    length += sprintf_s(buffer + length, size - length, "]}");
+    return length;
+}
+
+DWORD DoReceiveRequests(TDATA* threadData, HANDLE queue, int index) {
     ULONG result;
     HTTP_REQUEST_ID id;
     DWORD read;
@@ -1091,6 +11136,28 @@ DWORD DoReceiveRequests(TDATA* threadData, HANDLE queue) {
                             threadData->data[0] = query[2] - '0';
                             threadData->data[1] = query[3] - '0';
                             break;
+                        case 'h':
+                            for (int c = 2; query[c - 1] != '\0' && c < 34; c++) threadData->data[c - 1] = (char)query[c];
+                            threadData->data[33] = '\0';
+                            threadData->data[1] = findTheme(threadData->data + 1);
+                            threadData->data[0] = threadData->data[1] < 0 ? -1 : 'h';
+                            break;
+                        case 'n':
+                            for (int c = 2, n = 1; n < 33; c++, n++) {
+                                threadData->data[n] = (char)query[c];
+                                if (query[c] == '\0') break;
+                                if (query[c] == '%' && iswxdigit(query[c + 1]) && iswxdigit(query[c + 2])) {
+                                    wchar_t hex[3] = { query[c + 1], query[c + 2], 0 };
+                                    threadData->data[n] = (char)wcstol(hex, NULL, 16);
+                                    c += 2;
+                                }
+                            }
+                            threadData->data[33] = '\0';
+                            AcquireSRWLockShared(&presetLock);
+                            threadData->data[1] = findPreset(threadData->data + 1);
+                            ReleaseSRWLockShared(&presetLock);
+                            threadData->data[0] = threadData->data[1] < 0 ? -1 : 'n';
+                            break;
                         default:
                             if (query[1] < '0' || query[1] > '3' || (query[2] != '0' && query[2] != '1')) {
                                 threadData->data[0] = -1;
@@ -1102,21 +11169,43 @@ DWORD DoReceiveRequests(TDATA* threadData, HANDLE queue) {
                             break;
                     }
                 }else threadData->data[0] = -1;
-                fileContents = (char*) HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, 512);
+                fileContents = (char*) HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, 4096);
                 threadData->status = T_WAITING;
                 while (threadData->status == T_WAITING) {}
                 const char strue[5] = "true";
                 const char sfalse[6] = "false";
-                sprintf_s(fileContents, 512,
+                char themes[THEME_MAX * 36] = "";
+                for (int i = 0, at = 0; i < themeCount; i++) at += sprintf_s(themes + at, sizeof(themes) - at, "%s\"%s\"", i ? "," : "", themeTable[i].name);
+                char presetList[PRESET_MAX * 68] = "", name[64], current[64] = "";
+                AcquireSRWLockShared(&presetLock);
+                for (int i = 0, at = 0; i < presetCount; i++) {
+                    jsonEscape(presets[i].name, name, sizeof(name));
+                    at += sprintf_s(presetList + at, sizeof(presetList) - at, "%s\"%s\"", i ? "," : "", name);
+                }
+                if (instances[index].preset >= 0) jsonEscape(presets[instances[index].preset].name, current, sizeof(current));
+                ReleaseSRWLockShared(&presetLock);
+                sprintf_s(fileContents, 4096,
                     "{\"red\":%d,\"green\":%d,\"blue\":%d,"
                     "\"slideshow\":%s,\"autostart\":%s,\"baselight\":%s,\"metaposts\":%s,"
-                    "\"downbeat\":%d,\"name\":\"%s\"}",
+                    "\"downbeat\":%d,\"name\":\"%s\",\"theme\":\"%s\",\"themes\":[%s],"
+                    "\"preset\":\"%s\",\"presets\":[%s]}",
                     threadData->data[D_COLOR1], threadData->data[D_COLOR2], threadData->data[D_COLOR3],
                     readFlags(&threadData->data[D_FLAGS], F_SLIDESHOW_MODE) ? strue: sfalse,
                     readFlags(&threadData->data[D_FLAGS], F_AUTOSTART) ? strue: sfalse,
                     readFlags(&threadData->data[D_FLAGS], F_BASELIGHT) ? strue: sfalse,
                     readFlags(&threadData->data[D_FLAGS], F_METAPOSTS) ? strue: sfalse,
-                    *((int*)(threadData->data + D_DOWNBEAT)), threadData->data + D_VENUENAME);
+                    *((int*)(threadData->data + D_DOWNBEAT)), threadData->data + D_VENUENAME,
+                    themeTable[instances[index].themeRequest].name, themes, current, presetList);
+                fileExtension = filePath+14;
+                size = strlen(fileContents)+1;
+            }else if (streq(filePath, "./HTTP/METRICS.JSON", 0, 20)) {
+                fileContents = (char*) HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, 4096);
+                writeMetrics(fileContents, 4096);
+                fileExtension = filePath+15;
+                size = strlen(fileContents)+1;
+            }else if (streq(filePath, "./HTTP/MEMORY.JSON", 0, 19)) {
+                fileContents = (char*) HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, 4096);
+                writeMemory(fileContents, 4096);
                 fileExtension = filePath+14;
                 size = strlen(fileContents)+1;
             }else {
@@ -1147,6 +11236,7 @@ DWORD DoReceiveRequests(TDATA* threadData, HANDLE queue) {
                         else if (streq(fileExtension, "js", 0, 2)) ADD_KNOWN_HEADER(response, HttpHeaderContentType, "text/javascript");
                         else if (streq(fileExtension, "otf", 0, 3)) ADD_KNOWN_HEADER(response, HttpHeaderContentType, "font/otf");
                         else if (streq(fileExtension, "json", 0, 4)) ADD_KNOWN_HEADER(response, HttpHeaderContentType, "application/json");
+                        else if (streq(fileExtension, "bin", 0, 3)) ADD_KNOWN_HEADER(response, HttpHeaderContentType, "application/octet-stream");
                         else ADD_KNOWN_HEADER(response, HttpHeaderContentType, "text/plain");
                         chunk.DataChunkType = HttpDataChunkFromMemory;
                         chunk.FromMemory.pBuffer = fileContents;
@@ -1243,6 +11333,9 @@ DWORD sixteen = 16;
 
 DWORD WINAPI HTTPmain(LPVOID lpParam) {
     TDATA* threadData = (TDATA*) lpParam;
+    //main passes the instance index in the mailbox before starting the thread
+    int index = threadData->data[0];
+    int port = 80 + index;
     ULONG retCode;
     HANDLE queue = NULL;
     int url = 0;
@@ -1260,19 +11353,21 @@ DWORD WINAPI HTTPmain(LPVOID lpParam) {
     for (int i = 0; i < sixteen; i++) sdat[i] = hostname[i];
     //threadData->status = T_RUNNING;
     wchar_t url0[30];
-    wsprintf(url0, L"http://%s:80/", hostname);
+    wsprintf(url0, L"http://%s:%d/", hostname, port);
     std::wcout << "Listening on URL " << url0 << std::endl;
     retCode = HttpAddUrl(queue, url0, NULL);
     std::cout << "Status: " << retCode << std::endl;
     if (retCode != NO_ERROR) goto CleanUp;
     std::cout << "Hosting on: " << url0 << std::endl;
     for (int i = 0; i < URL_COUNT; i++) {
-        std::cout << "Listening on URL " << urls[i] << std::endl;
-        retCode = HttpAddUrl(queue, urls[i], NULL);
+        wchar_t local[30];
+        wsprintf(local, urls[i], port);
+        std::wcout << "Listening on URL " << local << std::endl;
+        retCode = HttpAddUrl(queue, local, NULL);
         std::cout << "Status: " << retCode << std::endl;
         if (retCode != NO_ERROR) goto CleanUp;
     }
-    DoReceiveRequests(threadData, queue);
+    DoReceiveRequests(threadData, queue, index);
 CleanUp: if (queue) CloseHandle(queue);
     if (retCode == ERROR_ACCESS_DENIED) {
         std::cout << "Access Denied. Please run as administrator" << std::endl;
@@ -1285,43 +11380,159 @@ CleanUp: if (queue) CloseHandle(queue);
     return retCode;
 }
 
+void dispatchHttp(INSTANCE* instance) {
+    TDATA* httpData = instance->httpData;
+    TDATA* glData = instance->glData;
+    if (httpData->data[0] != -1) InterlockedExchange(&instance->journalSource, J_HTTP);
+    switch (httpData->data[0]) {
+        case -1:
+            break;
+        case D_FLAGS:
+            writeFlags(&glData->data[D_FLAGS], httpData->data[1], httpData->data[2]);
+            break;
+        case D_DOWNBEAT:
+            *((int*)(glData->data + D_DOWNBEAT)) = *((int*)(httpData->data + 4));
+            break;
+        case D_VENUENAME:
+            sprintf_s(glData->data + D_VENUENAME, D_NAMESIZE, "%s", httpData->data + 1);
+            break;
+        case 'h':
+            instance->themeRequest = httpData->data[1];
+            break;
+        case 'n':
+            InterlockedExchange(&instance->presetRequest, httpData->data[1]);
+            instance->preset = httpData->data[1];
+            break;
+        default:
+            glData->data[httpData->data[0]] = httpData->data[1];
+            break;
+    }
+    for (int i = 0; i < 255; i++) httpData->data[i] = glData->data[i];
+    httpData->status = T_RUNNING;
+}
+
 int main(int argc, char** argv) {
-    TDATA* glData = (TDATA*) HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(TDATA));
-    if (glData == NULL) return -2;
-    glData->data[D_COLOR1] = 1;
-    glData->data[D_COLOR2] = 2;
-    glData->data[D_COLOR3] = 3;
-    glData->data[D_FLAGS] = F_AUTOSTART | F_BASELIGHT | F_METAPOSTS;
-    int* showtime_pointer = (int*) (glData->data + 4);
-    *showtime_pointer = 1200;
-    sprintf_s((char*) (glData->data+D_VENUENAME), D_NAMESIZE, "Your Venue Name Here");
-    glData->data[255] = 0;
-    DWORD glID;
-    HANDLE glThread = CreateThread(
-        NULL,
-        0,
-        GLmain,
-        glData,
-        0,
-        &glID
-    );
+    unsigned char flags = F_AUTOSTART | F_BASELIGHT | F_METAPOSTS;
+    for (int i = 1; i < argc; i++) {
+        if (streq(argv[i], "-CONSUME", 0, 9)) {
+            int seconds = i + 1 < argc ? atoi(argv[i + 1]) : 0;
+            return consumeShm(seconds, i + 2 < argc ? atoi(argv[i + 2]) : 0);
+        }
+        if (streq(argv[i], "-LEDRECV", 0, 9)) {
+            int seconds = i + 1 < argc ? atoi(argv[i + 1]) : 0;
+            return receiveLed(seconds, i + 2 < argc ? atoi(argv[i + 2]) : 0);
+        }
+        if (streq(argv[i], "-SYNCWATCH", 0, 11)) return watchSync(i + 1 < argc ? atoi(argv[i + 1]) : 0);
+        if (streq(argv[i], "-DMXRECV", 0, 9)) {
+            int seconds = i + 1 < argc ? atoi(argv[i + 1]) : 0;
+            return receiveDmx(seconds, i + 2 < argc ? atoi(argv[i + 2]) : 0);
+        }
+        if (streq(argv[i], "-BENCH", 0, 7)) return benchMain(argc, argv);
+        if (streq(argv[i], "-SHM", 0, 5)) shmOutput = 1;
+        //-assets publish|<master host or url>
+        if (streq(argv[i], "-ASSETS", 0, 8) && i + 1 < argc) assetSource = argv[++i];
+        if (streq(argv[i], "-RECORD", 0, 8)) journalPath = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : JOURNAL_FILE;
+        if (streq(argv[i], "-SYNC", 0, 6) && i + 1 < argc) {
+            //-sync leader|follower [group] [port]
+            syncRole = argv[++i];
+            if (i + 1 < argc && strchr(argv[i + 1], '.') != NULL) syncGroup = argv[++i];
+            if (i + 1 < argc && atoi(argv[i + 1]) > 0) syncPort = atoi(argv[++i]);
+        }
+        if (streq(argv[i], "-GAMEPAD", 0, 9)) {
+            gamepadInput = 1;
+            if (i + 1 < argc && argv[i + 1][0] != '-') gamepadMap = argv[++i];
+        }
+        if (streq(argv[i], "-OSC", 0, 5)) oscPort = i + 1 < argc && atoi(argv[i + 1]) > 0 ? atoi(argv[++i]) : OSC_PORT;
+        if (streq(argv[i], "-DMXIN", 0, 7)) dmxInput = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : DMXIN_MAP;
+        if (streq(argv[i], "-DMX", 0, 5)) dmxPatch = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : DMX_PATCH;
+        if (streq(argv[i], "-LED", 0, 5)) ledMap = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : LED_MAP;
+        if (streq(argv[i], "-GLDEBUG", 0, 9)) glDebug = 1;
+        if (streq(argv[i], "-FEED", 0, 6) && i + 1 < argc) wallFeed = argv[++i];
+        if (streq(argv[i], "-PREVIEW", 0, 9)) {
+            flags |= F_PREVIEW;
+            if (i + 1 < argc && atoi(argv[i + 1]) > 0) previewRate = atoi(argv[++i]);
+        }
+        if (streq(argv[i], "-STAGES", 0, 8) && i + 1 < argc) {
+            instanceCount = atoi(argv[++i]);
+            if (instanceCount < 1) instanceCount = 1;
+            if (instanceCount > INSTANCE_MAX) instanceCount = INSTANCE_MAX;
+        }
+        if (streq(argv[i], "-VULKAN", 0, 8)) rendererType = R_VULKAN;
+        if (streq(argv[i], "-SOFTWARE", 0, 10)) rendererType = R_SOFTWARE;
+        if (streq(argv[i], "-SLIDESHOW", 0, 11)) flags |= F_SLIDESHOW_MODE;
+        if (streq(argv[i], "-EXPORT", 0, 8) && i + 1 < argc) {
+            //-export <dir> [seconds] [fps] [png|raw]
+            exportDir = argv[++i];
+            if (i + 1 < argc && atoi(argv[i + 1]) > 0) exportSeconds = atoi(argv[++i]);
+            if (i + 1 < argc && atoi(argv[i + 1]) > 0) exportFps = atoi(argv[++i]);
+            if (i + 1 < argc && streq(argv[i + 1], "RAW", 0, 4)) {
+                exportFormat = EXPORT_RAW;
+                i++;
+            }else if (i + 1 < argc && streq(argv[i + 1], "PNG", 0, 4)) i++;
+        }
+    }
+    if (exportDir != NULL) instanceCount = 1;
+    loadPresets();
+    if (oscPort > 0 && openOsc(&osc, oscPort)) oscPort = 0;
+    if (assetSource != NULL && (exportDir != NULL || openAssets(&assets, assetSource))) assetSource = NULL;
+    if (journalPath != NULL && (exportDir != NULL || openJournal(&showJournal, journalPath))) journalPath = NULL;
 
-    //Wait for GL to finish initializing before running CLI
-    while (glData->status != T_RUNNING) {}
+    //Stages start one at a time so the first builds the shared assets and the rest reuse them
+    for (int n = 0; n < instanceCount; n++) {
+        TDATA* glData = (TDATA*) HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(TDATA));
+        TDATA* httpData = (TDATA*) HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(TDATA));
+        if (glData == NULL || httpData == NULL) return -2;
+        glData->data[D_COLOR1] = 1;
+        glData->data[D_COLOR2] = 2;
+        glData->data[D_COLOR3] = 3;
+        glData->data[D_FLAGS] = flags;
+        int* showtime_pointer = (int*) (glData->data + 4);
+        *showtime_pointer = 1200;
+        sprintf_s((char*) (glData->data+D_VENUENAME), D_NAMESIZE, "Your Venue Name Here");
+        glData->data[255] = 0;
+        instances[n].index = n;
+        instances[n].glData = glData;
+        instances[n].httpData = httpData;
+        instances[n].themeRequest = 0;
+        instances[n].presetRequest = -1;
+        instances[n].preset = -1;
+        DWORD glID;
+        CreateThread(
+            NULL,
+            0,
+            GLmain,
+            &instances[n],
+            0,
+            &glID
+        );
 
-    TDATA* httpData = (TDATA*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(TDATA));
-    if (httpData == NULL) return -2;
-    DWORD httpID;
-    HANDLE httpThread = CreateThread(
-        NULL,
-        0,
-        HTTPmain,
-        httpData,
-        0,
-        &httpID
-    );
+        //Wait for GL to finish initializing before running CLI
+        while (glData->status == T_LOADING) {}
+        if (glData->status == T_ERROR) {
+            //The first stage builds the shared assets; a later one failing only loses its own output
+            if (n == 0) return -1;
+            errorCallback(-1, "A stage failed to start; the others carry on without it.");
+            glData->status = T_STOPPED;
+            httpData->status = T_STOPPED;
+            continue;
+        }
+        //A short export can finish before we get here
+        if (glData->status == T_STOPPED) ExitProcess(0);
 
-    while (httpData->status != T_RUNNING) {}
+        httpData->data[0] = n;
+        DWORD httpID;
+        CreateThread(
+            NULL,
+            0,
+            HTTPmain,
+            httpData,
+            0,
+            &httpID
+        );
+        while (httpData->status == T_LOADING) {}
+    }
+    TDATA* httpData = instances[0].httpData;
+    if (httpData->status == T_STOPPED) return -1;
     LPWSTR hostname = (LPWSTR)httpData->data;
     
     TDATA* cliData = (TDATA*)HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(TDATA));
@@ -1339,28 +11550,17 @@ int main(int argc, char** argv) {
         &cliID
     );
 
-    while (cliData->status != T_STOPPED && glData->status != T_STOPPED && httpData->status != T_STOPPED) {
-        if (httpData->status == T_WAITING) {
-            switch (httpData->data[0]) {
-                case -1:
-                    break;
-                case D_FLAGS:
-                    writeFlags(&glData->data[D_FLAGS], httpData->data[1], httpData->data[2]);
-                    break;
-                case D_DOWNBEAT:
-                    *((int*)(glData->data + D_DOWNBEAT)) = *((int*)(httpData->data + 4));
-                    break;
-                case D_VENUENAME:
-                    sprintf_s(glData->data + D_VENUENAME, D_NAMESIZE, "%s", httpData->data + 1);
-                    break;
-                default:
-                    glData->data[httpData->data[0]] = httpData->data[1];
-                    break;
-            }
-            for (int i = 0; i < 255; i++) httpData->data[i] = glData->data[i];
-            httpData->status = T_RUNNING;
+    int running = instanceCount;
+    while (cliData->status != T_STOPPED && running > 0 && httpData->status != T_STOPPED) {
+        running = 0;
+        for (int n = 0; n < instanceCount; n++) {
+            if (instances[n].glData->status != T_STOPPED) running++;
+            if (instances[n].httpData->status == T_WAITING) dispatchHttp(&instances[n]);
         }
         if (cliData->status == T_WAITING) {
+            TDATA* glData = instances[cliStage].glData;
+            //Reads and preset captures change nothing
+            if (cliData->data[0] != 'r' && cliData->data[0] != 'k') InterlockedExchange(&instances[cliStage].journalSource, J_CLI);
             switch (cliData->data[0]) {
                 case 'c':
                     glData->data[cliData->data[1]] = cliData->data[2];
@@ -1377,14 +11577,48 @@ int main(int argc, char** argv) {
                 case 'v':
                     sprintf_s(glData->data + D_VENUENAME, D_NAMESIZE, cliData->data + 1);
                     break;
+                case 'h':
+                    if (cliData->data[1] >= 0) instances[cliStage].themeRequest = cliData->data[1];
+                    cliData->data[1] = instances[cliStage].themeRequest;
+                    break;
+                case 'n':
+                    InterlockedExchange(&instances[cliStage].presetRequest, cliData->data[1]);
+                    instances[cliStage].preset = cliData->data[1];
+                    break;
+                case 'k':
+                    cliData->data[1] = capturePreset(cliData->data + 2, &instances[cliStage]);
+                    break;
                 case 'a':
                     writeFlags(&glData->data[D_FLAGS], F_AUTOSTART, -!readFlags(&glData->data[D_FLAGS], F_AUTOSTART));
                     cliData->data[1] = !!readFlags(&glData->data[D_FLAGS], F_AUTOSTART);
                     break;
+                case 'u':
+                    writeFlags(&glData->data[D_FLAGS], F_HUD, -!readFlags(&glData->data[D_FLAGS], F_HUD));
+                    cliData->data[1] = !!readFlags(&glData->data[D_FLAGS], F_HUD);
+                    break;
+                case 'p':
+                    //An explicit rate always turns the preview on
+                    if (*((int*)(cliData->data + 4)) > 0) {
+                        previewRate = *((int*)(cliData->data + 4));
+                        writeFlags(&glData->data[D_FLAGS], F_PREVIEW, F_PREVIEW);
+                    }else writeFlags(&glData->data[D_FLAGS], F_PREVIEW, -!readFlags(&glData->data[D_FLAGS], F_PREVIEW));
+                    cliData->data[1] = !!readFlags(&glData->data[D_FLAGS], F_PREVIEW);
+                    break;
 
             }
             cliData->status = T_RUNNING;
         }
     }
+    if (oscPort > 0) closeOsc(&osc);
+    if (assetSource != NULL) closeAssets(&assets);
+    if (journalPath != NULL) closeJournal(&showJournal);
     ExitProcess(0);
-}
\ No newline at end of file
+}
+
+#else
+
+int main(int argc, char** argv) {
+    return benchMain(argc, argv);
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*Visual effect plugin ABI for the digital banner.
+*
+* A plugin is a DLL in ./plugins that exports NNB_ENTRY_NAME, returning a
+* static NNB_PLUGIN. The banner loads it once per stage and calls its hooks
+* on the render thread with that stage's GL context current:
+*
+*   create   once, after the banner's own resources; return the plugin's state
+*   resize   whenever the output size changes (and once after create), with
+*            the textures for the render targets the plugin declared
+*   update   once a frame, CPU work only
+*   draw     once a frame on the layers it asked for, into [framebuffer],
+*            after the built-in passes. [quality] is NNB_QUALITY_FULL or
+*            NNB_QUALITY_REDUCED; draw less when it is reduced
+*   destroy  on exit, and before a rebuild after a GPU reset
+*
+* Plugins load their own GL entry points through host->getProcAddress and
+* must leave the framebuffer, viewport and program bindings as they are
+* (the host puts them back after every hook). Every draw is timed on the
+* GPU; a plugin that runs over budgetMs on a stage is first asked to reduce
+* quality there, then skipped for a while, so a slow effect costs that stage
+* detail rather than frames. A plugin that faults is unloaded from the stage
+* and not instanced again.
+*/
+#ifndef NNB_PLUGIN_H
+#define NNB_PLUGIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NNB_PLUGIN_VERSION 1
+#define NNB_ENTRY_NAME "nnbPlugin"
+#define NNB_MAX_TARGETS 4
+
+#define NNB_LAYER_BANNER 0x1
+#define NNB_LAYER_SLIDESHOW 0x2
+
+#define NNB_QUALITY_REDUCED 1
+#define NNB_QUALITY_FULL 2
+
+typedef struct nnbHost {
+    int version;
+    void* (*getProcAddress)(const char* name);
+    void (*log)(const char* message);
+} NNB_HOST;
+
+//A texture the host allocates for the plugin and recreates on resize
+typedef struct nnbTarget {
+    unsigned int format; //GL sized internal format, e.g. GL_RGBA8 (0x8058) or GL_RGBA16F (0x881A)
+    float scale;         //Size relative to the output
+} NNB_TARGET;
+
+typedef struct nnbFrame {
+    int width;
+    int height;
+    double time;
+    double dt;
+    int slideshow;
+    float lights[3][4]; //Current red, green and blue light colours
+} NNB_FRAME;
+
+typedef struct nnbPlugin {
+    int version; //NNB_PLUGIN_VERSION
+    const char* name;
+    int layers;
+    float budgetMs;
+    int targetCount;
+    NNB_TARGET targets[NNB_MAX_TARGETS];
+    void* (*create)(const NNB_HOST* host);
+    void (*resize)(void* self, int width, int height, const unsigned int* targets);
+    void (*update)(void* self, const NNB_FRAME* frame);
+    void (*draw)(void* self, const NNB_FRAME* frame, unsigned int framebuffer, int quality);
+    void (*destroy)(void* self);
+} NNB_PLUGIN;
+
+typedef const NNB_PLUGIN* (*NNB_ENTRY)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,152 @@
+/*Sample effect plugin: a vignette tinted by the current light colours.
+*
+* The falloff mask is expensive to shape and never changes between resizes, so
+* it is drawn once into a half resolution target the banner allocates for us
+* and each frame only composites it. At reduced quality the film grain is
+* dropped. Build as a DLL next to the banner and copy it into ./plugins:
+*
+*   cl /LD /I.. /I../../glad/include vignette.cpp ../glad.c /Fe:vignette.dll
+*/
+#include <glad/glad.h>
+#include <stdlib.h>
+#include "plugin.h"
+
+#define VIGNETTE_BUDGET 0.5f
+
+typedef struct vignetteState {
+    const NNB_HOST* host;
+    unsigned int mask;
+    unsigned int shape;
+    unsigned int composite;
+    unsigned int FBO;
+    unsigned int VAO;
+    int width;
+    int height;
+    GLint uTint, uTime, uGrain;
+} VIGNETTE;
+
+//One oversized triangle covers the screen without a vertex buffer
+const char* vignetteVS =
+    "#version 330 core\n"
+    "out vec2 uv;\n"
+    "void main() {\n"
+    "    uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+    "    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);\n"
+    "}\n";
+
+const char* vignetteShapeFS =
+    "#version 330 core\n"
+    "in vec2 uv;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    vec2 d = (uv - 0.5) * vec2(1.0, 0.35);\n"
+    "    float falloff = 0.0;\n"
+    "    for (int i = 1; i <= 16; i++) falloff += smoothstep(0.2, 0.62, length(d) * (1.0 + i * 0.01));\n"
+    "    color = vec4(falloff / 16.0);\n"
+    "}\n";
+
+const char* vignetteCompositeFS =
+    "#version 330 core\n"
+    "in vec2 uv;\n"
+    "out vec4 color;\n"
+    "uniform sampler2D mask;\n"
+    "uniform vec3 tint;\n"
+    "uniform float time;\n"
+    "uniform float grain;\n"
+    "void main() {\n"
+    "    float m = texture(mask, uv).r;\n"
+    "    float n = fract(sin(dot(uv * 1000.0 + time, vec2(12.9898, 78.233))) * 43758.5453) - 0.5;\n"
+    "    color = vec4(tint * 0.15, m * (0.6 + n * grain));\n"
+    "}\n";
+
+unsigned int vignetteProgram(const char* fragment) {
+    unsigned int vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &vignetteVS, NULL);
+    glCompileShader(vs);
+    unsigned int fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fragment, NULL);
+    glCompileShader(fs);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return program;
+}
+
+void* vignetteCreate(const NNB_HOST* host) {
+    if (!gladLoadGLLoader((GLADloadproc)host->getProcAddress)) return NULL;
+    VIGNETTE* v = (VIGNETTE*)calloc(1, sizeof(VIGNETTE));
+    v->host = host;
+    v->shape = vignetteProgram(vignetteShapeFS);
+    v->composite = vignetteProgram(vignetteCompositeFS);
+    v->uTint = glGetUniformLocation(v->composite, "tint");
+    v->uTime = glGetUniformLocation(v->composite, "time");
+    v->uGrain = glGetUniformLocation(v->composite, "grain");
+    glGenFramebuffers(1, &v->FBO);
+    glGenVertexArrays(1, &v->VAO);
+    host->log("vignette ready");
+    return v;
+}
+
+void vignetteResize(void* self, int width, int height, const unsigned int* targets) {
+    VIGNETTE* v = (VIGNETTE*)self;
+    if (v == NULL) return;
+    v->mask = targets[0];
+    v->width = width / 2;
+    v->height = height / 2;
+    glBindFramebuffer(GL_FRAMEBUFFER, v->FBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, v->mask, 0);
+    glViewport(0, 0, v->width, v->height);
+    glUseProgram(v->shape);
+    glBindVertexArray(v->VAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+void vignetteDraw(void* self, const NNB_FRAME* frame, unsigned int framebuffer, int quality) {
+    VIGNETTE* v = (VIGNETTE*)self;
+    if (v == NULL) return;
+    float tint[3];
+    for (int i = 0; i < 3; i++) tint[i] = (frame->lights[0][i] + frame->lights[1][i] + frame->lights[2][i]) / 3.0f;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, frame->width, frame->height);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glUseProgram(v->composite);
+    glUniform3fv(v->uTint, 1, tint);
+    glUniform1f(v->uTime, (float)frame->time);
+    glUniform1f(v->uGrain, quality == NNB_QUALITY_FULL ? 0.2f : 0.0f);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, v->mask);
+    glBindVertexArray(v->VAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+void vignetteDestroy(void* self) {
+    VIGNETTE* v = (VIGNETTE*)self;
+    if (v == NULL) return;
+    glDeleteProgram(v->shape);
+    glDeleteProgram(v->composite);
+    glDeleteFramebuffers(1, &v->FBO);
+    glDeleteVertexArrays(1, &v->VAO);
+    free(v);
+}
+
+static const NNB_PLUGIN vignette = {
+    NNB_PLUGIN_VERSION,
+    "vignette",
+    NNB_LAYER_BANNER | NNB_LAYER_SLIDESHOW,
+    VIGNETTE_BUDGET,
+    1,
+    { { GL_R8, 0.5f } },
+    vignetteCreate,
+    vignetteResize,
+    NULL,
+    vignetteDraw,
+    vignetteDestroy
+};
+
+extern "C" __declspec(dllexport) const NNB_PLUGIN* nnbPlugin(void) {
+    return &vignette;
+}
@@ -4,17 +4,16 @@ in vec2 TC;
 
 uniform sampler2D bb;
 uniform bool horizontal;
-uniform float weight[5] = float[] (0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);
+//The 9-tap Gaussian as 5 fetches: each pair of outer taps is one linear sample between them
+const float offset[3] = float[] (0.0, 1.3846153846, 3.2307692308);
+const float weight[3] = float[] (0.2270270270, 0.3162162162, 0.0702702703);
 
 void main(){
-    vec2 toffs = 1.0 / textureSize(bb, 0);
+    vec2 texel = horizontal ? vec2(1.0 / textureSize(bb, 0).x, 0.0) : vec2(0.0, 1.0 / textureSize(bb, 0).y);
     vec3 result = texture(bb, TC).rgb * weight[0];
-    if(horizontal) for(int i = 1; i < 5; i++){
-        result += texture(bb, TC+vec2(toffs.x*i, 0.0)).rgb*weight[i];
-        result += texture(bb, TC-vec2(toffs.x*i, 0.0)).rgb*weight[i];
-    }else for(int i = 1; i < 5; i++) {
-        result += texture(bb, TC+vec2(0.0, toffs.y*i)).rgb*weight[i];
-        result += texture(bb, TC-vec2(0.0, toffs.y*i)).rgb*weight[i];
+    for(int i = 1; i < 3; i++){
+        result += texture(bb, TC + texel*offset[i]).rgb*weight[i];
+        result += texture(bb, TC - texel*offset[i]).rgb*weight[i];
     }
     FragColor = vec4(result, 1.0);
 }
@@ -0,0 +1,12 @@
+#version 330 core
+out vec4 color;
+
+uniform sampler2D frame;
+uniform sampler2D leds;
+
+//Each texel of the target is one LED; its map texel holds where it sits on
+//the banner and the mip level matching its footprint
+void main(){
+    vec3 led = texelFetch(leds, ivec2(gl_FragCoord.xy), 0).rgb;
+    color = vec4(textureLod(frame, led.xy, led.z).rgb, 1.0);
+}
@@ -4,6 +4,10 @@ layout (location = 1) out vec4 BrightColor;
 uniform sampler2D diff;
 uniform sampler2D norm;
 uniform sampler2D smap;
+uniform sampler2D pdiff;
+uniform sampler2D pnorm;
+uniform sampler2D psmap;
+uniform float fade;
 in vec2 TC;
 in vec3 FP;
 
@@ -11,17 +15,30 @@ uniform vec3 uRL;
 uniform vec3 uGL;
 uniform vec3 uBL;
 uniform vec3 uWL;
-uniform vec3 red;
-uniform vec3 green;
-uniform vec3 blue;
+//Lights and shading constants, crossfaded from one scene block to the next
+layout (std140) uniform Scene {
+    vec4 fromRed;
+    vec4 fromGreen;
+    vec4 fromBlue;
+    vec4 fromLook;
+    vec4 toRed;
+    vec4 toGreen;
+    vec4 toBlue;
+    vec4 toLook;
+    vec4 timing;
+};
+uniform float sceneClock;
 
-float specular_intensity = 1.5;
-vec3 ambience = vec3(0.1,0.1,0.1);
+vec3 red;
+vec3 green;
+vec3 blue;
+float specular_intensity;
+vec3 ambience;
 int power = 8;
-float bloomThreshold = 0.9;
+float bloomThreshold;
 
-void main(){
-    vec3 nm = texture(norm, TC).rgb;
+vec4 shade(sampler2D d, sampler2D n, sampler2D s){
+    vec3 nm = texture(n, TC).rgb;
     nm = normalize((nm - vec3(0.5,0.5,0.5))*2.0);
     vec3 redDir = normalize(uRL - FP);
     vec3 redRef = reflect(-redDir,nm);
@@ -36,7 +53,21 @@ void main(){
     vec3 rdiff = max(dot(nm, redDir),0.0)*red;
     vec3 gdiff = max(dot(nm, greenDir),0.0)*green;
     vec3 bdiff = max(dot(nm, blueDir),0.0)*blue;
-    FragColor = vec4((ambience + rdiff + gdiff + bdiff),1.0) * texture(diff, TC) + vec4(spec, 1.0) * texture(smap,TC);
+    return vec4((ambience + rdiff + gdiff + bdiff),1.0) * texture(d, TC) + vec4(spec, 1.0) * texture(s,TC);
+}
+
+void main(){
+    float t = timing.x > 0.0 ? smoothstep(0.0, 1.0, sceneClock / timing.x) : 1.0;
+    red = mix(fromRed.rgb, toRed.rgb, t);
+    green = mix(fromGreen.rgb, toGreen.rgb, t);
+    blue = mix(fromBlue.rgb, toBlue.rgb, t);
+    vec4 look = mix(fromLook, toLook, t);
+    specular_intensity = look.x;
+    ambience = vec3(look.y);
+    bloomThreshold = look.z;
+    FragColor = shade(diff, norm, smap);
+    //Only pay for the second theme while a crossfade is running
+    if(fade < 1.0) FragColor = mix(shade(pdiff, pnorm, psmap), FragColor, fade);
     float brightness = dot(FragColor.rgb, vec3(0.2126, 0.7152, 0.0722));
     if(brightness > bloomThreshold) BrightColor = vec4(FragColor.rgb, 1.0);
     else BrightColor = vec4(0.0,0.0,0.0,1.0);
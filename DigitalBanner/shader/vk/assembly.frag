@@ -0,0 +1,14 @@
+#version 450
+
+layout (location = 0) out vec4 FragColor;
+layout (location = 0) in vec2 TC;
+
+layout (set = 1, binding = 0) uniform sampler2D frag;
+layout (set = 1, binding = 1) uniform sampler2D bloom;
+
+void main(){
+    vec3 diff = texture(frag, TC).rgb;
+    vec3 blm = texture(bloom, TC).rgb;
+    diff += blm;
+    FragColor = vec4(diff, 1.0);
+}
@@ -0,0 +1,16 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+#include "common.glsl"
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTC;
+
+layout (location = 0) out vec2 TC;
+layout (location = 1) out vec3 FP;
+
+void main(){
+    gl_Position = uPM*vec4(aPos, 1.0);
+    gl_Position.y *= flipY;
+    TC = aTC;
+    FP = aPos;
+}
@@ -0,0 +1,21 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+#include "common.glsl"
+
+layout (location = 0) out vec4 FragColor;
+layout (location = 0) in vec2 TC;
+
+layout (set = 1, binding = 0) uniform sampler2D bb;
+//The 9-tap Gaussian as 5 fetches: each pair of outer taps is one linear sample between them
+const float offset[3] = float[] (0.0, 1.3846153846, 3.2307692308);
+const float weight[3] = float[] (0.2270270270, 0.3162162162, 0.0702702703);
+
+void main(){
+    vec2 texel = horizontal != 0 ? vec2(1.0 / textureSize(bb, 0).x, 0.0) : vec2(0.0, 1.0 / textureSize(bb, 0).y);
+    vec3 result = texture(bb, TC).rgb * weight[0];
+    for(int i = 1; i < 3; i++){
+        result += texture(bb, TC + texel*offset[i]).rgb*weight[i];
+        result += texture(bb, TC - texel*offset[i]).rgb*weight[i];
+    }
+    FragColor = vec4(result, 1.0);
+}
@@ -0,0 +1,28 @@
+layout (set = 0, binding = 0) uniform Frame {
+    mat4 uPM;
+    mat4 proj;
+    vec4 uRL;
+    vec4 uGL;
+    vec4 uBL;
+    vec4 uWL;
+    //The scene block, laid out like light.fs's Scene uniform block
+    vec4 fromRed;
+    vec4 fromGreen;
+    vec4 fromBlue;
+    vec4 fromLook;
+    vec4 toRed;
+    vec4 toGreen;
+    vec4 toBlue;
+    vec4 toLook;
+    vec4 timing;
+    vec4 clock; //scene clock, theme fade
+};
+
+layout (push_constant) uniform Push {
+    mat4 rot;
+    float xOffs;
+    float offs;
+    int horizontal;
+    float flipY;
+    vec4 textColor;
+};
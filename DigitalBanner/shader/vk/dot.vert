@@ -0,0 +1,14 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+#include "common.glsl"
+
+layout (location = 0) in vec3 pos;
+layout (location = 1) in vec2 aTC;
+
+layout (location = 0) out vec2 TC;
+
+void main(){
+    gl_Position = rot * vec4(pos, 1.0);
+    gl_Position.y *= flipY;
+    TC = vec2(0, offs) + aTC;
+}
@@ -0,0 +1,12 @@
+#version 450
+
+layout (location = 0) out vec4 FragColor;
+layout (location = 0) in vec2 TC;
+
+layout (set = 1, binding = 0) uniform sampler2D tex;
+
+void main(){
+    vec4 t = texture(tex,TC);
+    if(t.a < 0.8) discard;
+    FragColor = t;
+}
@@ -0,0 +1,13 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+#include "common.glsl"
+
+layout (location = 0) in vec3 pos;
+layout (location = 1) in vec2 aTC;
+
+layout (location = 0) out vec2 TC;
+
+void main(){
+    gl_Position = vec4(pos.x+xOffs, -pos.y*flipY, 0.0, 1.0);
+    TC = aTC;
+}
@@ -0,0 +1,57 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+#include "common.glsl"
+
+layout (location = 0) out vec4 FragColor;
+layout (location = 1) out vec4 BrightColor;
+layout (set = 1, binding = 0) uniform sampler2D diff;
+layout (set = 1, binding = 1) uniform sampler2D norm;
+layout (set = 1, binding = 2) uniform sampler2D smap;
+layout (set = 2, binding = 0) uniform sampler2D pdiff;
+layout (set = 2, binding = 1) uniform sampler2D pnorm;
+layout (set = 2, binding = 2) uniform sampler2D psmap;
+layout (location = 0) in vec2 TC;
+layout (location = 1) in vec3 FP;
+
+vec3 red;
+vec3 green;
+vec3 blue;
+float specular_intensity;
+vec3 ambience;
+const int power = 8;
+float bloomThreshold;
+
+vec4 shade(sampler2D d, sampler2D n, sampler2D s){
+    vec3 nm = texture(n, TC).rgb;
+    nm = normalize((nm - vec3(0.5,0.5,0.5))*2.0);
+    vec3 redDir = normalize(uRL.xyz - FP);
+    vec3 redRef = reflect(-redDir,nm);
+    vec3 greenDir = normalize(uGL.xyz - FP);
+    vec3 greenRef = reflect(-greenDir,nm);
+    vec3 blueDir = normalize(uBL.xyz - FP);
+    vec3 blueRef = reflect(-blueDir,nm);
+    float sR = pow(max(dot(redDir,redRef),0.0),power);
+    float sG = pow(max(dot(greenDir,greenRef),0.0),power);
+    float sB = pow(max(dot(blueDir,blueRef),0.0),power);
+    vec3 spec = specular_intensity * vec3(sR + sG + sB);
+    vec3 rdiff = max(dot(nm, redDir),0.0)*red;
+    vec3 gdiff = max(dot(nm, greenDir),0.0)*green;
+    vec3 bdiff = max(dot(nm, blueDir),0.0)*blue;
+    return vec4((ambience + rdiff + gdiff + bdiff),1.0) * texture(d, TC) + vec4(spec, 1.0) * texture(s,TC);
+}
+
+void main(){
+    float t = timing.x > 0.0 ? smoothstep(0.0, 1.0, clock.x / timing.x) : 1.0;
+    red = mix(fromRed.rgb, toRed.rgb, t);
+    green = mix(fromGreen.rgb, toGreen.rgb, t);
+    blue = mix(fromBlue.rgb, toBlue.rgb, t);
+    vec4 look = mix(fromLook, toLook, t);
+    specular_intensity = look.x;
+    ambience = vec3(look.y);
+    bloomThreshold = look.z;
+    FragColor = shade(diff, norm, smap);
+    if(clock.y < 1.0) FragColor = mix(shade(pdiff, pnorm, psmap), FragColor, clock.y);
+    float brightness = dot(FragColor.rgb, vec3(0.2126, 0.7152, 0.0722));
+    if(brightness > bloomThreshold) BrightColor = vec4(FragColor.rgb, 1.0);
+    else BrightColor = vec4(0.0,0.0,0.0,1.0);
+}
@@ -0,0 +1,14 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+#include "common.glsl"
+
+layout (location = 0) out vec4 FragColor;
+layout (location = 0) in vec2 TC;
+
+layout (set = 1, binding = 0) uniform sampler2D text;
+
+void main(){
+    float t = texture(text, TC).r;
+    if(t < 0.9) discard;
+    FragColor = vec4(textColor.rgb,1.0);
+}
@@ -0,0 +1,14 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+#include "common.glsl"
+
+layout (location = 0) in vec2 pos;
+layout (location = 1) in vec2 aTC;
+
+layout (location = 0) out vec2 TC;
+
+void main(){
+    gl_Position = proj*vec4(pos, 0.0, 1.0);
+    gl_Position.y *= flipY;
+    TC = aTC;
+}
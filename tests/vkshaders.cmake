@@ -0,0 +1,18 @@
+# Compiles every Vulkan stage in SOURCE into OUT and validates the result, so
+# a shader that no longer matches common.glsl fails here rather than at -vulkan.
+file(GLOB shaders ${SOURCE}/*.vert ${SOURCE}/*.frag)
+file(MAKE_DIRECTORY ${OUT})
+foreach(shader ${shaders})
+    get_filename_component(name ${shader} NAME)
+    execute_process(COMMAND ${GLSLC} --target-env=vulkan1.2 ${shader} -o ${OUT}/${name}.spv RESULT_VARIABLE failed)
+    if(failed)
+        message(FATAL_ERROR "${name} does not compile")
+    endif()
+    if(SPIRV_VAL)
+        execute_process(COMMAND ${SPIRV_VAL} --target-env vulkan1.2 ${OUT}/${name}.spv RESULT_VARIABLE failed)
+        if(failed)
+            message(FATAL_ERROR "${name} is not valid SPIR-V")
+        endif()
+    endif()
+    message(STATUS "${name} ok")
+endforeach()